@@ -0,0 +1,391 @@
+/************************************************************************************************
+Copyright (c) 2025, Juan Manuel Guariste <juanmaguariste@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** @file bench_leds.c
+ ** @brief Microbenchmark of the LED API against an instrumented port
+ **
+ ** Usage: bench_leds.elf <results.json> [baseline.json]
+ **
+ ** Every workload reports the port reads and writes per operation, which are exact, and the
+ ** best time per operation of several repetitions, which depends on the host. A workload that
+ ** needs more port accesses than the baseline makes the benchmark fail.
+ **/
+
+/* === Headers files inclusions =============================================================== */
+
+#include "leds.h"
+#include "leds_sequencer.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+/* === Macros definitions ====================================================================== */
+
+//! Times every workload is run, the best one is reported
+#define REPETITIONS 5
+
+//! Ports of the bank used by the bank workloads
+#define BANK_PORTS LEDS_MAX_PORTS
+
+//! Words of the bank used by the bank workloads
+#define BANK_WORDS (BANK_PORTS * LEDS_PER_PORT / LEDS_WORD_BITS)
+
+//! Maximum number of workloads read from a baseline
+#define MAX_BASELINE 16
+
+//! Margin for the rounding of the port accesses written to the JSON file
+#define ACCESS_TOLERANCE 0.005
+
+//! Nanoseconds in a second
+#define NS_PER_S 1000000000ULL
+
+/* === Private data type declarations ========================================================== */
+
+/**
+ * @brief Workload of the benchmark.
+ */
+typedef struct {
+    const char * name;             //!< Name used in the results
+    void (*setup)(void);           //!< Prepares the LEDs before every repetition
+    void (*run)(uint32_t op);      //!< Performs one operation
+    uint32_t ops;                  //!< Operations per repetition
+} Workload_t;
+
+/**
+ * @brief Results of a workload.
+ */
+typedef struct {
+    char name[64];       //!< Name of the workload
+    uint32_t ops;        //!< Operations per repetition
+    double readsPerOp;   //!< Port reads per operation
+    double writesPerOp;  //!< Port writes per operation
+    double nsPerOp;      //!< Best time per operation, in nanoseconds
+} Result_t;
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/**
+ * @brief Returns the monotonic time of the host.
+ *
+ * @return uint64_t Time in nanoseconds.
+ */
+static uint64_t nowNs(void);
+
+/**
+ * @brief Runs a workload and measures it.
+ *
+ * @param workload Workload to run.
+ *
+ * @param result Where to store the results.
+ */
+static void measure(const Workload_t * workload, Result_t * result);
+
+/**
+ * @brief Writes the results to a JSON file.
+ *
+ * @param path Path of the file.
+ *
+ * @param results Results of every workload.
+ *
+ * @param count Number of workloads.
+ *
+ * @return true if the file was written.
+ */
+static bool writeResults(const char * path, const Result_t * results, uint8_t count);
+
+/**
+ * @brief Reads the results of a previous run, written by writeResults().
+ *
+ * @param path Path of the file.
+ *
+ * @param results Where to store the results.
+ *
+ * @return uint8_t Number of workloads read, 0 if there is no baseline.
+ */
+static uint8_t readResults(const char * path, Result_t * results);
+
+/**
+ * @brief Prints the results next to the baseline and checks the port accesses.
+ *
+ * @param results Results of every workload.
+ *
+ * @param count Number of workloads.
+ *
+ * @param baseline Results of the baseline.
+ *
+ * @param baselineCount Number of workloads of the baseline.
+ *
+ * @return true if no workload needs more port accesses than in the baseline.
+ */
+static bool compare(const Result_t * results, uint8_t count, const Result_t * baseline,
+                    uint8_t baselineCount);
+
+static void setupSingle(void);
+static void runSingleToggle(uint32_t op);
+static void runSingleQuery(uint32_t op);
+static void runMaskUpdate(uint32_t op);
+static void setupBank(void);
+static void runBankAll(uint32_t op);
+static void runBankPerLed(uint32_t op);
+static void runBankWords(uint32_t op);
+static void setupAnimation(void);
+static void runAnimationFrame(uint32_t op);
+
+/* === Public variable definitions ============================================================= */
+
+uint64_t benchPortReads;
+uint64_t benchPortWrites;
+
+/* === Private variable definitions ============================================================ */
+
+//! Port of the single port workloads
+static uint16_t singlePort;
+
+//! Ports of the bank workloads
+static uint16_t bankPorts[BANK_PORTS];
+
+//! Addresses of the ports of the bank workloads
+static uint16_t * bankAddresses[BANK_PORTS];
+
+//! Group of the bank workloads
+static Leds_t bank;
+
+//! Sequencer of the animation workload
+static LedsSeq_t sequencer;
+
+//! Keeps the results of the queries alive
+static volatile bool sink;
+
+//! Frames of the animation workload, a dot running over the first byte
+static const LedsFrame_t ANIMATION_FRAMES[] = {
+    {0x01, 10}, {0x02, 10}, {0x04, 10}, {0x08, 10},
+    {0x10, 10}, {0x20, 10}, {0x40, 10}, {0x80, 10},
+};
+
+//! Animation of the animation workload
+static const LedsAnimation_t ANIMATION = {
+    .frames = ANIMATION_FRAMES,
+    .count = sizeof(ANIMATION_FRAMES) / sizeof(ANIMATION_FRAMES[0]),
+    .mask = 0xFF,
+    .loop = true,
+};
+
+//! Workloads of the benchmark
+static const Workload_t WORKLOADS[] = {
+    {"single_toggle", setupSingle, runSingleToggle, 1000000},
+    {"single_query", setupSingle, runSingleQuery, 1000000},
+    {"mask_update", setupSingle, runMaskUpdate, 1000000},
+    {"bank_all_on_off", setupBank, runBankAll, 100000},
+    {"bank_per_led", setupBank, runBankPerLed, 10000},
+    {"bank_words", setupBank, runBankWords, 100000},
+    {"animation_frame", setupAnimation, runAnimationFrame, 1000000},
+};
+
+/* === Private function implementation ========================================================= */
+
+uint64_t nowNs(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * NS_PER_S + (uint64_t)now.tv_nsec;
+}
+
+void setupSingle(void) {
+    Leds_init(&singlePort);
+}
+
+void runSingleToggle(uint32_t op) {
+    uint16_t led = (uint16_t)(op % LEDS_PER_PORT + 1);
+    if (op & LEDS_PER_PORT) {
+        Leds_turnOffSingle(led);
+    } else {
+        Leds_turnOnSingle(led);
+    }
+}
+
+void runSingleQuery(uint32_t op) {
+    sink = Leds_isLedTurnedOn((uint16_t)(op % LEDS_PER_PORT + 1));
+}
+
+void runMaskUpdate(uint32_t op) {
+    Leds_writeMasked(0x00FF, (uint16_t)op);
+}
+
+void setupBank(void) {
+    for (uint8_t port = 0; port < BANK_PORTS; port++) {
+        bankAddresses[port] = &bankPorts[port];
+    }
+    LedsBank_t ports = {.ports = bankAddresses, .count = BANK_PORTS};
+    LedsGroup_initBank(&bank, &ports);
+}
+
+void runBankAll(uint32_t op) {
+    if (op & 1) {
+        LedsGroup_turnOffAllLeds(&bank);
+    } else {
+        LedsGroup_turnOnAllLeds(&bank);
+    }
+}
+
+void runBankPerLed(uint32_t op) {
+    for (uint16_t led = 1; led <= BANK_PORTS * LEDS_PER_PORT; led++) {
+        if ((led + op) & 1) {
+            LedsGroup_turnOnSingle(&bank, led);
+        } else {
+            LedsGroup_turnOffSingle(&bank, led);
+        }
+    }
+}
+
+void runBankWords(uint32_t op) {
+    LedsWord_t pattern = (op & 1) ? (LedsWord_t)0x5555555555555555ULL
+                                  : (LedsWord_t)0xAAAAAAAAAAAAAAAAULL;
+    for (uint8_t word = 0; word < BANK_WORDS; word++) {
+        LedsGroup_writeWord(&bank, word, (LedsWord_t)~0ULL, pattern);
+    }
+}
+
+void setupAnimation(void) {
+    Leds_init(&singlePort);
+    LedsSeq_init(&sequencer, Leds_getDefault(), 0);
+    LedsSeq_play(&sequencer, 0, &ANIMATION, 0);
+}
+
+void runAnimationFrame(uint32_t op) {
+    LedsSeq_tick(&sequencer, (op + 1) * ANIMATION_FRAMES[0].durationMs);
+}
+
+void measure(const Workload_t * workload, Result_t * result) {
+    uint64_t best = UINT64_MAX;
+    for (uint8_t repetition = 0; repetition < REPETITIONS; repetition++) {
+        workload->setup();
+        uint64_t reads = benchPortReads;
+        uint64_t writes = benchPortWrites;
+        uint64_t start = nowNs();
+        for (uint32_t op = 0; op < workload->ops; op++) {
+            workload->run(op);
+        }
+        uint64_t elapsed = nowNs() - start;
+        if (elapsed < best) {
+            best = elapsed;
+        }
+        result->readsPerOp = (double)(benchPortReads - reads) / workload->ops;
+        result->writesPerOp = (double)(benchPortWrites - writes) / workload->ops;
+    }
+    snprintf(result->name, sizeof(result->name), "%s", workload->name);
+    result->ops = workload->ops;
+    result->nsPerOp = (double)best / workload->ops;
+}
+
+bool writeResults(const char * path, const Result_t * results, uint8_t count) {
+    FILE * file = fopen(path, "w");
+    if (file == NULL) {
+        return false;
+    }
+    fprintf(file, "{\n  \"config\": {\"word_bits\": %d, \"shadow\": %d},\n  \"workloads\": {\n",
+            LEDS_WORD_BITS, LEDS_USE_SHADOW);
+    for (uint8_t index = 0; index < count; index++) {
+        fprintf(file,
+                "    \"%s\": {\"ops\": %u, \"reads_per_op\": %.3f, \"writes_per_op\": %.3f, "
+                "\"ns_per_op\": %.2f}%s\n",
+                results[index].name, results[index].ops, results[index].readsPerOp,
+                results[index].writesPerOp, results[index].nsPerOp,
+                (index + 1 < count) ? "," : "");
+    }
+    fprintf(file, "  }\n}\n");
+    return fclose(file) == 0;
+}
+
+uint8_t readResults(const char * path, Result_t * results) {
+    FILE * file = fopen(path, "r");
+    char line[256];
+    uint8_t count = 0;
+    if (file == NULL) {
+        return 0;
+    }
+    while (count < MAX_BASELINE && fgets(line, sizeof(line), file) != NULL) {
+        Result_t * result = &results[count];
+        if (sscanf(line,
+                   " \"%63[^\"]\": {\"ops\": %u, \"reads_per_op\": %lf, \"writes_per_op\": %lf, "
+                   "\"ns_per_op\": %lf}",
+                   result->name, &result->ops, &result->readsPerOp, &result->writesPerOp,
+                   &result->nsPerOp) == 5) {
+            count++;
+        }
+    }
+    fclose(file);
+    return count;
+}
+
+bool compare(const Result_t * results, uint8_t count, const Result_t * baseline,
+             uint8_t baselineCount) {
+    bool passed = true;
+    printf("%-18s %16s %16s %12s %12s %8s\n", "workload", "accesses/op", "baseline", "ns/op",
+           "baseline", "change");
+    for (uint8_t index = 0; index < count; index++) {
+        const Result_t * result = &results[index];
+        const Result_t * previous = NULL;
+        for (uint8_t other = 0; other < baselineCount; other++) {
+            if (strcmp(baseline[other].name, result->name) == 0) {
+                previous = &baseline[other];
+            }
+        }
+        double accesses = result->readsPerOp + result->writesPerOp;
+        if (previous == NULL) {
+            printf("%-18s %16.3f %16s %12.2f %12s %8s\n", result->name, accesses, "-",
+                   result->nsPerOp, "-", "new");
+            continue;
+        }
+        double previousAccesses = previous->readsPerOp + previous->writesPerOp;
+        double change = 100.0 * (result->nsPerOp - previous->nsPerOp) / previous->nsPerOp;
+        bool worse = accesses > previousAccesses + ACCESS_TOLERANCE;
+        printf("%-18s %16.3f %16.3f %12.2f %12.2f %+7.1f%%%s\n", result->name, accesses,
+               previousAccesses, result->nsPerOp, previous->nsPerOp, change,
+               worse ? "  MORE PORT ACCESSES" : "");
+        passed = passed && !worse;
+    }
+    return passed;
+}
+
+/* === Public function implementation ========================================================== */
+
+int main(int argc, char * argv[]) {
+    const uint8_t count = sizeof(WORKLOADS) / sizeof(WORKLOADS[0]);
+    Result_t results[sizeof(WORKLOADS) / sizeof(WORKLOADS[0])];
+    Result_t baseline[MAX_BASELINE];
+
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s <results.json> [baseline.json]\n", argv[0]);
+        return 2;
+    }
+    for (uint8_t index = 0; index < count; index++) {
+        measure(&WORKLOADS[index], &results[index]);
+    }
+    if (!writeResults(argv[1], results, count)) {
+        fprintf(stderr, "cannot write %s\n", argv[1]);
+        return 2;
+    }
+    uint8_t baselineCount = (argc > 2) ? readResults(argv[2], baseline) : 0;
+    return compare(results, count, baseline, baselineCount) ? 0 : 1;
+}
+
+/* === End of documentation ==================================================================== */
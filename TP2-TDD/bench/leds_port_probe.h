@@ -0,0 +1,50 @@
+/************************************************************************************************
+Copyright (c) 2025, Juan Manuel Guariste <juanmaguariste@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef LEDS_PORT_PROBE_H
+#define LEDS_PORT_PROBE_H
+
+/** @file leds_port_probe.h
+ ** @brief Instrumented LED port accesses, forced into every benchmark translation unit
+ **/
+
+/* === Headers files inclusions ================================================================ */
+#include <stdint.h>
+
+/* === Public macros definitions =============================================================== */
+
+//! Writes a LED port and counts the access
+#define LEDS_PORT_WRITE(address, value) (benchPortWrites++, *(address) = (value))
+
+//! Reads a LED port and counts the access
+#define LEDS_PORT_READ(address) (benchPortReads++, *(address))
+
+/* === Public variable declarations ============================================================ */
+
+//! Number of LED port reads since the start of the benchmark
+extern uint64_t benchPortReads;
+
+//! Number of LED port writes since the start of the benchmark
+extern uint64_t benchPortWrites;
+
+/* === End of documentation ==================================================================== */
+
+#endif /* LEDS_PORT_PROBE_H */
@@ -38,6 +38,42 @@ extern "C" {
 
 /* === Public macros definitions =============================================================== */
 
+#ifndef LEDS_USE_SHADOW
+/**
+ * @brief Selects how the driver knows the state of the LEDs.
+ *
+ * - 0: direct mode, the output port is read back before every update and query.
+ *
+ * - 1: shadow mode, a RAM copy of the port is kept and the port is only ever written. Use it
+ *   when the output register is write-only or reads back the pin state. Updates are atomic
+ *   (C11 atomics on the copy), so LEDs can be changed from tasks and interrupt handlers
+ *   without masking interrupts.
+ */
+#define LEDS_USE_SHADOW 0
+#endif
+
+#if LEDS_USE_SHADOW
+#include <stdatomic.h>
+#endif
+
+//! Number of LEDs driven by every port word of a bank
+#define LEDS_PER_PORT 16
+
+#ifndef LEDS_MAX_PORTS
+//! Maximum number of port words in a LED bank (LEDS_PER_PORT LEDs each)
+#define LEDS_MAX_PORTS 16
+#endif
+
+#ifndef LEDS_WORD_BITS
+//! Width in bits of the word-wide operations (32 or 64)
+#define LEDS_WORD_BITS 32
+#endif
+
+#ifndef LEDS_MAX_FRAME_GROUPS
+//! Maximum number of groups buffering frames at the same time
+#define LEDS_MAX_FRAME_GROUPS 4
+#endif
+
 /* === Public data type declarations =========================================================== */
 /**
  * @brief Enumeration for LED states.
@@ -52,6 +88,64 @@ extern "C" {
  */
 typedef enum { LED_OFF = 0, LED_ON = 1 } LedState_t;
 
+/**
+ * @brief LED mask used by the word-wide operations.
+ *
+ * Bit 0 of word n is LED n * LEDS_WORD_BITS + 1.
+ */
+#if LEDS_WORD_BITS == 64
+typedef uint64_t LedsWord_t;
+#else
+typedef uint32_t LedsWord_t;
+#endif
+
+/**
+ * @brief Description of a LED bank spread over several output ports.
+ *
+ * Every port drives LEDS_PER_PORT LEDs: LED n is bit (n - 1) % LEDS_PER_PORT of the port
+ * ports[(n - 1) / LEDS_PER_PORT]. The ports do not need to be contiguous in memory. When the
+ * last port is only partly wired, ledCount limits the LEDs of the bank.
+ */
+typedef struct {
+    uint16_t * const * ports; //!< Address of every output port, in LED order
+    uint8_t count;            //!< Number of ports in the bank (1 to LEDS_MAX_PORTS)
+    uint16_t ledCount;        //!< LEDs of the bank, 0 for LEDS_PER_PORT on every port
+} LedsBank_t;
+
+/**
+ * @brief Port writes made by the frame commits of a group.
+ */
+typedef struct {
+    uint32_t frames;     //!< Frames committed
+    uint32_t writes;     //!< Port writes made by all the commits
+    uint16_t lastWrites; //!< Port writes made by the last commit
+} LedsFrameStats_t;
+
+/**
+ * @brief State of an independent group of LEDs.
+ *
+ * Every group drives its own bank of ports. The storage is provided by the caller (a static or
+ * automatic variable) and must only be accessed through the LedsGroup_ functions. The Leds_
+ * functions work on a default group owned by the library.
+ */
+typedef struct {
+    uint16_t * portAddress[LEDS_MAX_PORTS]; //!< Address of every output port of the bank
+    uint8_t portCount;                      //!< Number of ports of the bank
+    uint16_t ledCount;                      //!< Number of LEDs of the bank
+#if LEDS_USE_SHADOW
+    _Atomic uint16_t portShadow[LEDS_MAX_PORTS];     //!< RAM copy of the state of every port
+    volatile uint32_t * setResetAddress[LEDS_MAX_PORTS]; //!< Set/reset registers, NULL if unused
+    volatile uint32_t * frontSetReset[LEDS_MAX_PORTS];   //!< Set/reset registers while buffered
+#endif
+    uint16_t * frontAddress[LEDS_MAX_PORTS]; //!< Output ports while the group is buffered
+    uint16_t frame[LEDS_MAX_PORTS];          //!< Working frame written while buffered
+    uint16_t front[LEDS_MAX_PORTS];          //!< State of the ports at the last commit
+    uint16_t ready[LEDS_MAX_PORTS];          //!< Frame latched for the next tick commit
+    volatile bool commitPending;             //!< A frame waits for the next tick commit
+    bool buffered;                           //!< Writes go to the working frame
+    LedsFrameStats_t frameStats;             //!< Port writes made by the commits
+} Leds_t;
+
 /* === Public variable declarations ============================================================ */
 
 /* === Public function declarations ============================================================ */
@@ -67,26 +161,64 @@ typedef enum { LED_OFF = 0, LED_ON = 1 } LedState_t;
  */
 void Leds_init(uint16_t * address);
 
+/**
+ * @brief Initializes the LED library on a bank of several output ports.
+ *
+ * @note This function, or Leds_init(), must be called before using any other function in the
+ * library. The bank description is copied, so it does not need to outlive the call.
+ *
+ * @param bank Description of the ports that make up the bank.
+ *
+ * @return true if the bank was accepted, false if it is empty, has too many ports or more LEDs
+ * than its ports can drive.
+ */
+bool Leds_initBank(const LedsBank_t * bank);
+
+/**
+ * @brief Returns the number of LEDs in the bank.
+ *
+ * @return uint16_t Number of LEDs, LEDS_PER_PORT for every port of the bank unless the bank
+ * gave its ledCount.
+ */
+uint16_t Leds_getCount(void);
+
+#if LEDS_USE_SHADOW
+/**
+ * @brief Initializes the LED library on a port with a set/reset register (BSRR style).
+ *
+ * Writing a 1 to bit n of the register turns LED n+1 on, writing a 1 to bit n+16 turns it off.
+ * Every update writes only the bits it changes, so no read-modify-write of the port is needed.
+ * The bank is made of this single port.
+ *
+ * @note Only available in shadow mode (LEDS_USE_SHADOW = 1).
+ *
+ * @param address Pointer to the set/reset register of the LEDs output port.
+ *
+ * @return void
+ */
+void Leds_initSetReset(volatile uint32_t * address);
+#endif
+
 /**
  * @brief Turns on a single LED.
  *
- * @param led LED number to turn on (1 to 16).
+ * @param led LED number to turn on (1 to Leds_getCount()).
  *
  * @return void
  */
-void Leds_turnOnSingle(uint8_t led);
+void Leds_turnOnSingle(uint16_t led);
 
 /**
  * @brief Turns off a single LED.
  *
- * @param led LED number to turn off (1 to 16).
+ * @param led LED number to turn off (1 to Leds_getCount()).
  *
  * @return void
  */
-void Leds_turnOffSingle(uint8_t led);
+void Leds_turnOffSingle(uint16_t led);
 
 /**
- * @brief Turns on all LEDs.
+ * @brief Turns on all LEDs of the bank.
  *
  * @param void
  *
@@ -95,7 +227,7 @@ void Leds_turnOffSingle(uint8_t led);
 void Leds_turnOnAllLeds();
 
 /**
- * @brief Turns off all LEDs.
+ * @brief Turns off all LEDs of the bank.
  *
  * @param void
  *
@@ -106,20 +238,463 @@ void Leds_turnOffAllLeds(void);
 /**
  * @brief Checks if a LED is turned on.
  *
- * @param led LED number to check (1 to 16).
+ * @param led LED number to check (1 to Leds_getCount()).
  *
  * @return true if the LED is turned on, false otherwise.
  */
-bool Leds_isLedTurnedOn(uint8_t led);
+bool Leds_isLedTurnedOn(uint16_t led);
 
 /**
  * @brief Checks if a LED is turned off.
  *
- * @param led LED number to check (1 to 16).
+ * @param led LED number to check (1 to Leds_getCount()).
  *
  * @return true if the LED is turned off, false otherwise.
  */
-bool Leds_isLedTurnedOff(uint8_t led);
+bool Leds_isLedTurnedOff(uint16_t led);
+
+/**
+ * @brief Turns on every LED of the first port whose bit is set in a mask.
+ *
+ * @param mask Bit mask of LEDs to turn on (bit 0 is LED 1).
+ *
+ * @return void
+ */
+void Leds_setMask(uint16_t mask);
+
+/**
+ * @brief Turns off every LED of the first port whose bit is set in a mask.
+ *
+ * @param mask Bit mask of LEDs to turn off (bit 0 is LED 1).
+ *
+ * @return void
+ */
+void Leds_clearMask(uint16_t mask);
+
+/**
+ * @brief Inverts the state of every LED of the first port whose bit is set in a mask.
+ *
+ * @param mask Bit mask of LEDs to toggle (bit 0 is LED 1).
+ *
+ * @return void
+ */
+void Leds_toggleMask(uint16_t mask);
+
+/**
+ * @brief Writes the LEDs of the first port selected by a mask, leaving the others unchanged.
+ *
+ * @param mask Bit mask of LEDs to write (bit 0 is LED 1).
+ *
+ * @param value New state of the selected LEDs, bits outside the mask are ignored.
+ *
+ * @return void
+ */
+void Leds_writeMasked(uint16_t mask, uint16_t value);
+
+/**
+ * @brief Reads the state of all LEDs of the first port at once.
+ *
+ * @return uint16_t Bit mask with a 1 for every LED that is on (bit 0 is LED 1).
+ */
+uint16_t Leds_getAll(void);
+
+/**
+ * @brief Turns on every LED whose bit is set in a word-wide mask.
+ *
+ * Each port covered by the word is written at most once, ports without any bit set in the mask
+ * are not touched.
+ *
+ * @param word Index of the word (word 0 holds LEDs 1 to LEDS_WORD_BITS).
+ *
+ * @param mask Bit mask of LEDs to turn on (bit 0 is the first LED of the word).
+ *
+ * @return void
+ */
+void Leds_setWord(uint8_t word, LedsWord_t mask);
+
+/**
+ * @brief Turns off every LED whose bit is set in a word-wide mask.
+ *
+ * Each port covered by the word is written at most once, ports without any bit set in the mask
+ * are not touched.
+ *
+ * @param word Index of the word (word 0 holds LEDs 1 to LEDS_WORD_BITS).
+ *
+ * @param mask Bit mask of LEDs to turn off (bit 0 is the first LED of the word).
+ *
+ * @return void
+ */
+void Leds_clearWord(uint8_t word, LedsWord_t mask);
+
+/**
+ * @brief Inverts the state of every LED whose bit is set in a word-wide mask.
+ *
+ * Each port covered by the word is written at most once, ports without any bit set in the mask
+ * are not touched.
+ *
+ * @param word Index of the word (word 0 holds LEDs 1 to LEDS_WORD_BITS).
+ *
+ * @param mask Bit mask of LEDs to toggle (bit 0 is the first LED of the word).
+ *
+ * @return void
+ */
+void Leds_toggleWord(uint8_t word, LedsWord_t mask);
+
+/**
+ * @brief Writes the LEDs of a word selected by a mask, leaving the others unchanged.
+ *
+ * Each port covered by the word is written at most once, ports without any bit set in the mask
+ * are not touched.
+ *
+ * @param word Index of the word (word 0 holds LEDs 1 to LEDS_WORD_BITS).
+ *
+ * @param mask Bit mask of LEDs to write (bit 0 is the first LED of the word).
+ *
+ * @param value New state of the selected LEDs, bits outside the mask are ignored.
+ *
+ * @return void
+ */
+void Leds_writeWord(uint8_t word, LedsWord_t mask, LedsWord_t value);
+
+/**
+ * @brief Reads the state of all LEDs of a word at once.
+ *
+ * @param word Index of the word (word 0 holds LEDs 1 to LEDS_WORD_BITS).
+ *
+ * @return LedsWord_t Bit mask with a 1 for every LED that is on, LEDs beyond the end of the
+ * bank read as off.
+ */
+LedsWord_t Leds_getWord(uint8_t word);
+
+/**
+ * @brief Sends the writes of the default group to a working frame instead of the ports.
+ *
+ * While buffered, every Leds_ write changes a RAM copy of the ports and the queries return the
+ * working frame, so the outputs keep the last committed frame and never show half-built states.
+ * Leaving the buffered mode commits the working frame.
+ *
+ * @param enabled true to buffer the writes, false to write the ports directly again.
+ *
+ * @return true if the mode was changed, false if LEDS_MAX_FRAME_GROUPS groups are already
+ * buffered.
+ */
+bool Leds_setBuffered(bool enabled);
+
+/**
+ * @brief Publishes the working frame of the default group.
+ *
+ * Every port that changed since the last commit is written once, the others are not touched.
+ * Does nothing if the group is not buffered.
+ *
+ * @return uint16_t Number of port writes made.
+ */
+uint16_t Leds_commit(void);
+
+/**
+ * @brief Latches the working frame of the default group to be published by Leds_commitTick().
+ *
+ * The application can keep building the next frame right away, the latched one is not affected.
+ *
+ * @return void
+ */
+void Leds_commitOnTick(void);
+
+/**
+ * @brief Publishes the latched frames of every buffered group.
+ *
+ * Call it from the tick interrupt or task, so all the groups that called Leds_commitOnTick() or
+ * LedsGroup_commitOnTick() change on the same edge. A frame latched while the tick runs is
+ * published by the next one.
+ *
+ * @return void
+ */
+void Leds_commitTick(void);
+
+/**
+ * @brief Reads the port writes made by the commits of the default group.
+ *
+ * @return LedsFrameStats_t Counters since the group was initialized.
+ */
+LedsFrameStats_t Leds_getFrameStats(void);
+
+/**
+ * @brief Returns the default group used by the Leds_ functions.
+ *
+ * @return Leds_t * Pointer to the default group, to combine both APIs.
+ */
+Leds_t * Leds_getDefault(void);
+
+/**
+ * @brief Initializes a group of LEDs on a single output port.
+ *
+ * @note This function, or LedsGroup_initBank(), must be called before using the group with any
+ * other function. Calling it again resets the group.
+ *
+ * @param group Storage of the group, provided by the caller.
+ *
+ * @param address Pointer to the memory address where the LEDs are stored.
+ *
+ * @return void
+ */
+void LedsGroup_init(Leds_t * group, uint16_t * address);
+
+/**
+ * @brief Initializes a group of LEDs on a bank of several output ports.
+ *
+ * @param group Storage of the group, provided by the caller.
+ *
+ * @param bank Description of the ports that make up the bank, it is copied into the group.
+ *
+ * @return true if the bank was accepted, false if it is empty, has too many ports or more LEDs
+ * than its ports can drive.
+ */
+bool LedsGroup_initBank(Leds_t * group, const LedsBank_t * bank);
+
+#if LEDS_USE_SHADOW
+/**
+ * @brief Initializes a group of LEDs on a port with a set/reset register (BSRR style).
+ *
+ * @note Only available in shadow mode (LEDS_USE_SHADOW = 1). See Leds_initSetReset().
+ *
+ * @param group Storage of the group, provided by the caller.
+ *
+ * @param address Pointer to the set/reset register of the LEDs output port.
+ *
+ * @return void
+ */
+void LedsGroup_initSetReset(Leds_t * group, volatile uint32_t * address);
+#endif
+
+/**
+ * @brief Returns the number of LEDs of a group.
+ *
+ * @param group Group of LEDs.
+ *
+ * @return uint16_t Number of LEDs, LEDS_PER_PORT for every port of the bank.
+ */
+uint16_t LedsGroup_getCount(const Leds_t * group);
+
+/**
+ * @brief Turns on a single LED of a group.
+ *
+ * @param group Group of LEDs.
+ *
+ * @param led LED number to turn on (1 to LedsGroup_getCount()).
+ *
+ * @return void
+ */
+void LedsGroup_turnOnSingle(Leds_t * group, uint16_t led);
+
+/**
+ * @brief Turns off a single LED of a group.
+ *
+ * @param group Group of LEDs.
+ *
+ * @param led LED number to turn off (1 to LedsGroup_getCount()).
+ *
+ * @return void
+ */
+void LedsGroup_turnOffSingle(Leds_t * group, uint16_t led);
+
+/**
+ * @brief Turns on all LEDs of a group.
+ *
+ * @param group Group of LEDs.
+ *
+ * @return void
+ */
+void LedsGroup_turnOnAllLeds(Leds_t * group);
+
+/**
+ * @brief Turns off all LEDs of a group.
+ *
+ * @param group Group of LEDs.
+ *
+ * @return void
+ */
+void LedsGroup_turnOffAllLeds(Leds_t * group);
+
+/**
+ * @brief Checks if a LED of a group is turned on.
+ *
+ * @param group Group of LEDs.
+ *
+ * @param led LED number to check (1 to LedsGroup_getCount()).
+ *
+ * @return true if the LED is turned on, false otherwise.
+ */
+bool LedsGroup_isLedTurnedOn(Leds_t * group, uint16_t led);
+
+/**
+ * @brief Checks if a LED of a group is turned off.
+ *
+ * @param group Group of LEDs.
+ *
+ * @param led LED number to check (1 to LedsGroup_getCount()).
+ *
+ * @return true if the LED is turned off, false otherwise.
+ */
+bool LedsGroup_isLedTurnedOff(Leds_t * group, uint16_t led);
+
+/**
+ * @brief Turns on every LED of the first port of a group whose bit is set in a mask.
+ *
+ * @param group Group of LEDs.
+ *
+ * @param mask Bit mask of LEDs to turn on (bit 0 is LED 1).
+ *
+ * @return void
+ */
+void LedsGroup_setMask(Leds_t * group, uint16_t mask);
+
+/**
+ * @brief Turns off every LED of the first port of a group whose bit is set in a mask.
+ *
+ * @param group Group of LEDs.
+ *
+ * @param mask Bit mask of LEDs to turn off (bit 0 is LED 1).
+ *
+ * @return void
+ */
+void LedsGroup_clearMask(Leds_t * group, uint16_t mask);
+
+/**
+ * @brief Inverts every LED of the first port of a group whose bit is set in a mask.
+ *
+ * @param group Group of LEDs.
+ *
+ * @param mask Bit mask of LEDs to toggle (bit 0 is LED 1).
+ *
+ * @return void
+ */
+void LedsGroup_toggleMask(Leds_t * group, uint16_t mask);
+
+/**
+ * @brief Writes the LEDs of the first port of a group selected by a mask.
+ *
+ * @param group Group of LEDs.
+ *
+ * @param mask Bit mask of LEDs to write (bit 0 is LED 1).
+ *
+ * @param value New state of the selected LEDs, bits outside the mask are ignored.
+ *
+ * @return void
+ */
+void LedsGroup_writeMasked(Leds_t * group, uint16_t mask, uint16_t value);
+
+/**
+ * @brief Reads the state of all LEDs of the first port of a group at once.
+ *
+ * @param group Group of LEDs.
+ *
+ * @return uint16_t Bit mask with a 1 for every LED that is on (bit 0 is LED 1).
+ */
+uint16_t LedsGroup_getAll(Leds_t * group);
+
+/**
+ * @brief Turns on every LED of a group whose bit is set in a word-wide mask.
+ *
+ * @param group Group of LEDs.
+ *
+ * @param word Index of the word (word 0 holds LEDs 1 to LEDS_WORD_BITS).
+ *
+ * @param mask Bit mask of LEDs to turn on (bit 0 is the first LED of the word).
+ *
+ * @return void
+ */
+void LedsGroup_setWord(Leds_t * group, uint8_t word, LedsWord_t mask);
+
+/**
+ * @brief Turns off every LED of a group whose bit is set in a word-wide mask.
+ *
+ * @param group Group of LEDs.
+ *
+ * @param word Index of the word (word 0 holds LEDs 1 to LEDS_WORD_BITS).
+ *
+ * @param mask Bit mask of LEDs to turn off (bit 0 is the first LED of the word).
+ *
+ * @return void
+ */
+void LedsGroup_clearWord(Leds_t * group, uint8_t word, LedsWord_t mask);
+
+/**
+ * @brief Inverts every LED of a group whose bit is set in a word-wide mask.
+ *
+ * @param group Group of LEDs.
+ *
+ * @param word Index of the word (word 0 holds LEDs 1 to LEDS_WORD_BITS).
+ *
+ * @param mask Bit mask of LEDs to toggle (bit 0 is the first LED of the word).
+ *
+ * @return void
+ */
+void LedsGroup_toggleWord(Leds_t * group, uint8_t word, LedsWord_t mask);
+
+/**
+ * @brief Writes the LEDs of a word of a group selected by a mask.
+ *
+ * @param group Group of LEDs.
+ *
+ * @param word Index of the word (word 0 holds LEDs 1 to LEDS_WORD_BITS).
+ *
+ * @param mask Bit mask of LEDs to write (bit 0 is the first LED of the word).
+ *
+ * @param value New state of the selected LEDs, bits outside the mask are ignored.
+ *
+ * @return void
+ */
+void LedsGroup_writeWord(Leds_t * group, uint8_t word, LedsWord_t mask, LedsWord_t value);
+
+/**
+ * @brief Reads the state of all LEDs of a word of a group at once.
+ *
+ * @param group Group of LEDs.
+ *
+ * @param word Index of the word (word 0 holds LEDs 1 to LEDS_WORD_BITS).
+ *
+ * @return LedsWord_t Bit mask with a 1 for every LED that is on.
+ */
+LedsWord_t LedsGroup_getWord(Leds_t * group, uint8_t word);
+
+/**
+ * @brief Sends the writes of a group to a working frame instead of the ports.
+ *
+ * @param group Group of LEDs.
+ *
+ * @param enabled true to buffer the writes, false to commit the working frame and write the
+ * ports directly again.
+ *
+ * @return true if the mode was changed, false if LEDS_MAX_FRAME_GROUPS groups are already
+ * buffered.
+ */
+bool LedsGroup_setBuffered(Leds_t * group, bool enabled);
+
+/**
+ * @brief Publishes the working frame of a group, writing once every port that changed.
+ *
+ * @param group Group of LEDs.
+ *
+ * @return uint16_t Number of port writes made, 0 if the group is not buffered.
+ */
+uint16_t LedsGroup_commit(Leds_t * group);
+
+/**
+ * @brief Latches the working frame of a group to be published by Leds_commitTick().
+ *
+ * @param group Group of LEDs.
+ *
+ * @return void
+ */
+void LedsGroup_commitOnTick(Leds_t * group);
+
+/**
+ * @brief Reads the port writes made by the commits of a group.
+ *
+ * @param group Group of LEDs.
+ *
+ * @return LedsFrameStats_t Counters since the group was initialized.
+ */
+LedsFrameStats_t LedsGroup_getFrameStats(const Leds_t * group);
 
 /* === End of documentation ==================================================================== */
 
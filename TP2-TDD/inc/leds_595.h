@@ -0,0 +1,116 @@
+/************************************************************************************************
+Copyright (c) 2025, Juan Manuel Guariste <juanmaguariste@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef LEDS_595_H
+#define LEDS_595_H
+
+/** @file leds_595.h
+ ** @brief LED backend for a chain of 74HC595 shift registers driven by SPI with DMA
+ **/
+
+/* === Headers files inclusions ================================================================ */
+#include "leds.h"
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+
+#ifndef LEDS_595_MAX_REGISTERS
+//! Maximum number of shift registers in a chain (8 LEDs each)
+#define LEDS_595_MAX_REGISTERS 32
+#endif
+
+//! Number of port words needed to hold the LEDs of the longest chain
+#define LEDS_595_MAX_PORTS ((LEDS_595_MAX_REGISTERS + 1) / 2)
+
+/* === Public data type declarations =========================================================== */
+
+/**
+ * @brief State of a chain of 74HC595 shift registers.
+ *
+ * The storage is provided by the caller and must only be accessed through the Leds595_
+ * functions. The group of LEDs works on RAM port words held here; every frame serialises them
+ * into the DMA buffer. LED 1 is output QA of the register connected to the microcontroller,
+ * LED 9 is QA of the next register, and so on.
+ */
+typedef struct {
+    Leds_t * group;                         //!< Group of LEDs shown on the chain
+    uint8_t registers;                      //!< Number of registers in the chain
+    uint16_t image[LEDS_595_MAX_PORTS];     //!< Port words of the group
+    uint16_t sent[LEDS_595_MAX_PORTS];      //!< Port words of the last frame sent
+    uint8_t buffer[LEDS_595_MAX_REGISTERS]; //!< Serialised frame, in transmission order
+    volatile bool busy;                     //!< A frame is being sent
+    bool resend;                            //!< The next update must send a frame
+    uint32_t frames;                        //!< Number of frames sent
+} Leds595_t;
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+
+/**
+ * @brief Initializes a chain and a group of LEDs shown on it, with every LED off.
+ *
+ * The first call to Leds595_update() sends a frame, so the chain starts in a known state.
+ *
+ * @param chain Storage of the chain, provided by the caller.
+ *
+ * @param group Storage of the group of LEDs, provided by the caller.
+ *
+ * @param registers Number of registers in the chain (1 to LEDS_595_MAX_REGISTERS).
+ *
+ * @return true if the chain was initialized, false if the number of registers is not valid.
+ */
+bool Leds595_init(Leds595_t * chain, Leds_t * group, uint8_t registers);
+
+/**
+ * @brief Sends a frame if the state of the LEDs changed since the last frame.
+ *
+ * Must be called periodically, typically from the millisecond tick. The frame is sent by DMA
+ * and latched from the transfer complete interrupt, so the outputs change all at once. While a
+ * frame is in flight the call does nothing, the change goes in a later frame.
+ *
+ * @param chain Chain of registers.
+ *
+ * @return true if a frame was started, false otherwise.
+ */
+bool Leds595_update(Leds595_t * chain);
+
+/**
+ * @brief Returns the number of frames sent since the chain was initialized.
+ *
+ * @param chain Chain of registers.
+ *
+ * @return uint32_t Number of frames.
+ */
+uint32_t Leds595_getFrames(const Leds595_t * chain);
+
+/* === End of documentation ==================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LEDS_595_H */
@@ -0,0 +1,163 @@
+/************************************************************************************************
+Copyright (c) 2025, Juan Manuel Guariste <juanmaguariste@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef LEDS_BLINK_H
+#define LEDS_BLINK_H
+
+/** @file leds_blink.h
+ ** @brief Independent blink timers for many LEDs on a hashed timer wheel
+ **/
+
+/* === Headers files inclusions ================================================================ */
+#include "leds.h"
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+
+#ifndef LEDS_BLINK_SLOTS
+//! Number of slots of the timer wheel, must be a power of two
+#define LEDS_BLINK_SLOTS 64
+#endif
+
+//! Number of blinks that makes a LED blink until it is cancelled
+#define LEDS_BLINK_FOREVER 0
+
+/* === Public data type declarations =========================================================== */
+
+/**
+ * @brief Blink timer of one LED.
+ */
+typedef struct {
+    uint32_t expiry;    //!< Tick of the next transition
+    uint16_t onMs;      //!< Time the LED stays on in every blink
+    uint16_t offMs;     //!< Time the LED stays off between blinks
+    uint16_t remaining; //!< Blinks left, LEDS_BLINK_FOREVER if unlimited
+    uint8_t next;       //!< Next timer in the same wheel slot
+    bool on;            //!< State of the LED set by the last transition
+    bool active;        //!< The timer is linked in the wheel
+} LedsBlinkTimer_t;
+
+/**
+ * @brief State of a blink scheduler for the LEDs of one word of a group.
+ *
+ * The storage is provided by the caller and must only be accessed through the LedsBlink_
+ * functions. Every timer is linked in the wheel slot of its next transition, so a tick only
+ * visits the timers hashed to the current slot.
+ */
+typedef struct {
+    Leds_t * group;                          //!< Group of LEDs driven by the scheduler
+    uint8_t word;                            //!< Word of the group driven by the scheduler
+    uint32_t tick;                           //!< Last tick processed
+    uint8_t slots[LEDS_BLINK_SLOTS];         //!< First timer of every slot of the wheel
+    LedsBlinkTimer_t timers[LEDS_WORD_BITS]; //!< Timer of every LED of the word
+} LedsBlink_t;
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+
+/**
+ * @brief Initializes a blink scheduler with no timer running.
+ *
+ * @param blink Storage of the scheduler, provided by the caller.
+ *
+ * @param group Group of LEDs driven by the scheduler, already initialized.
+ *
+ * @param word Index of the word of the group driven by the scheduler.
+ *
+ * @param now Current time in milliseconds.
+ *
+ * @return void
+ */
+void LedsBlink_init(LedsBlink_t * blink, Leds_t * group, uint8_t word, uint32_t now);
+
+/**
+ * @brief Starts blinking a LED, replacing any blink already running on it.
+ *
+ * The LED turns on at the next tick, together with every other transition of that tick.
+ *
+ * @param blink Blink scheduler.
+ *
+ * @param led LED number inside the word (1 to LEDS_WORD_BITS).
+ *
+ * @param onMs Time the LED stays on in every blink, at least 1 ms.
+ *
+ * @param offMs Time the LED stays off between blinks.
+ *
+ * @param count Number of blinks before the LED is left off, LEDS_BLINK_FOREVER to blink until
+ * cancelled. A single blink turns the LED on for onMs, which makes a time out.
+ *
+ * @return true if the blink was scheduled, false if the LED or the on time is not valid.
+ */
+bool LedsBlink_start(LedsBlink_t * blink, uint8_t led, uint16_t onMs, uint16_t offMs,
+                     uint16_t count);
+
+/**
+ * @brief Stops blinking a LED and turns it off.
+ *
+ * @param blink Blink scheduler.
+ *
+ * @param led LED number inside the word (1 to LEDS_WORD_BITS).
+ *
+ * @return void
+ */
+void LedsBlink_cancel(LedsBlink_t * blink, uint8_t led);
+
+/**
+ * @brief Checks if a LED is blinking.
+ *
+ * @param blink Blink scheduler.
+ *
+ * @param led LED number inside the word (1 to LEDS_WORD_BITS).
+ *
+ * @return true if the LED has a blink running, false otherwise.
+ */
+bool LedsBlink_isActive(const LedsBlink_t * blink, uint8_t led);
+
+/**
+ * @brief Processes the timers that expire up to the current time.
+ *
+ * Must be called every millisecond, a late call processes the missed ticks one by one, up to
+ * one revolution of the wheel (LEDS_BLINK_SLOTS ticks). The timers due before that revolution
+ * are brought up to date without visiting the skipped ticks, keeping their phase. Every tick
+ * only visits the timers of its wheel slot, and all the transitions of the call are merged into
+ * a single masked write of the word.
+ *
+ * @param blink Blink scheduler.
+ *
+ * @param now Current time in milliseconds.
+ *
+ * @return void
+ */
+void LedsBlink_tick(LedsBlink_t * blink, uint32_t now);
+
+/* === End of documentation ==================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LEDS_BLINK_H */
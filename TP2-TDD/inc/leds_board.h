@@ -0,0 +1,95 @@
+/************************************************************************************************
+Copyright (c) 2025, Juan Manuel Guariste <juanmaguariste@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef LEDS_BOARD_H
+#define LEDS_BOARD_H
+
+/** @file leds_board.h
+ ** @brief Wiring of the logical LEDs to the bits of the output port on every board
+ **/
+
+/* === Headers files inclusions ================================================================ */
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+
+/*
+ * Every board defines LEDS_MAP_LED1 to LEDS_MAP_LED16 with LEDS_PIN(bit, polarity): the port bit
+ * (0 to 15) that drives the logical LED and whether it lights with the output high or low. The
+ * bits must be all different, leds_map.c checks it at compile time.
+ */
+
+#if defined(LEDS_BOARD_TEST)
+/* Scrambled wiring with some active-low outputs, used by test_leds_map.c */
+#define LEDS_MAP_LED1  LEDS_PIN(5, LEDS_ACTIVE_HIGH)
+#define LEDS_MAP_LED2  LEDS_PIN(0, LEDS_ACTIVE_HIGH)
+#define LEDS_MAP_LED3  LEDS_PIN(7, LEDS_ACTIVE_LOW)
+#define LEDS_MAP_LED4  LEDS_PIN(2, LEDS_ACTIVE_LOW)
+#define LEDS_MAP_LED5  LEDS_PIN(15, LEDS_ACTIVE_HIGH)
+#define LEDS_MAP_LED6  LEDS_PIN(14, LEDS_ACTIVE_HIGH)
+#define LEDS_MAP_LED7  LEDS_PIN(1, LEDS_ACTIVE_HIGH)
+#define LEDS_MAP_LED8  LEDS_PIN(3, LEDS_ACTIVE_HIGH)
+#define LEDS_MAP_LED9  LEDS_PIN(8, LEDS_ACTIVE_LOW)
+#define LEDS_MAP_LED10 LEDS_PIN(9, LEDS_ACTIVE_HIGH)
+#define LEDS_MAP_LED11 LEDS_PIN(13, LEDS_ACTIVE_HIGH)
+#define LEDS_MAP_LED12 LEDS_PIN(12, LEDS_ACTIVE_HIGH)
+#define LEDS_MAP_LED13 LEDS_PIN(4, LEDS_ACTIVE_HIGH)
+#define LEDS_MAP_LED14 LEDS_PIN(6, LEDS_ACTIVE_HIGH)
+#define LEDS_MAP_LED15 LEDS_PIN(11, LEDS_ACTIVE_HIGH)
+#define LEDS_MAP_LED16 LEDS_PIN(10, LEDS_ACTIVE_LOW)
+#else
+/* Direct wiring: LED n on bit n - 1, every output active-high */
+#define LEDS_MAP_LED1  LEDS_PIN(0, LEDS_ACTIVE_HIGH)
+#define LEDS_MAP_LED2  LEDS_PIN(1, LEDS_ACTIVE_HIGH)
+#define LEDS_MAP_LED3  LEDS_PIN(2, LEDS_ACTIVE_HIGH)
+#define LEDS_MAP_LED4  LEDS_PIN(3, LEDS_ACTIVE_HIGH)
+#define LEDS_MAP_LED5  LEDS_PIN(4, LEDS_ACTIVE_HIGH)
+#define LEDS_MAP_LED6  LEDS_PIN(5, LEDS_ACTIVE_HIGH)
+#define LEDS_MAP_LED7  LEDS_PIN(6, LEDS_ACTIVE_HIGH)
+#define LEDS_MAP_LED8  LEDS_PIN(7, LEDS_ACTIVE_HIGH)
+#define LEDS_MAP_LED9  LEDS_PIN(8, LEDS_ACTIVE_HIGH)
+#define LEDS_MAP_LED10 LEDS_PIN(9, LEDS_ACTIVE_HIGH)
+#define LEDS_MAP_LED11 LEDS_PIN(10, LEDS_ACTIVE_HIGH)
+#define LEDS_MAP_LED12 LEDS_PIN(11, LEDS_ACTIVE_HIGH)
+#define LEDS_MAP_LED13 LEDS_PIN(12, LEDS_ACTIVE_HIGH)
+#define LEDS_MAP_LED14 LEDS_PIN(13, LEDS_ACTIVE_HIGH)
+#define LEDS_MAP_LED15 LEDS_PIN(14, LEDS_ACTIVE_HIGH)
+#define LEDS_MAP_LED16 LEDS_PIN(15, LEDS_ACTIVE_HIGH)
+#endif
+
+/* === Public data type declarations =========================================================== */
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+
+/* === End of documentation ==================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LEDS_BOARD_H */
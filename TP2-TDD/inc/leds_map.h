@@ -0,0 +1,229 @@
+/************************************************************************************************
+Copyright (c) 2025, Juan Manuel Guariste <juanmaguariste@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef LEDS_MAP_H
+#define LEDS_MAP_H
+
+/** @file leds_map.h
+ ** @brief Control of LEDs by logical number, remapped to the board wiring at compile time
+ **/
+
+/* === Headers files inclusions ================================================================ */
+#include "leds.h"
+#include "leds_board.h"
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+
+//! The LED lights with the port bit set
+#define LEDS_ACTIVE_HIGH 0
+//! The LED lights with the port bit cleared
+#define LEDS_ACTIVE_LOW 1
+
+//! Describes the port bit (0 to 15) and the polarity of a logical LED
+#define LEDS_PIN(bit, polarity) (((polarity) << 4) | (bit))
+//! Port mask of a pin described with LEDS_PIN
+#define LEDS_PIN_MASK(pin) ((uint16_t)(1u << ((pin) & 0x0F)))
+//! Port mask of a pin described with LEDS_PIN if it is active-low, 0 otherwise
+#define LEDS_PIN_LOW_MASK(pin) (((pin) >> 4) ? LEDS_PIN_MASK(pin) : 0)
+
+//! Port mask of logical LED n (1 to 16), a constant expression
+#define LEDS_MAP_MASK(n) LEDS_PIN_MASK(LEDS_MAP_LED##n)
+
+//! Port bits whose LED lights with the output low
+#define LEDS_MAP_ACTIVE_LOW                                                                        \
+    ((uint16_t)(LEDS_PIN_LOW_MASK(LEDS_MAP_LED1) | LEDS_PIN_LOW_MASK(LEDS_MAP_LED2) |             \
+                LEDS_PIN_LOW_MASK(LEDS_MAP_LED3) | LEDS_PIN_LOW_MASK(LEDS_MAP_LED4) |             \
+                LEDS_PIN_LOW_MASK(LEDS_MAP_LED5) | LEDS_PIN_LOW_MASK(LEDS_MAP_LED6) |             \
+                LEDS_PIN_LOW_MASK(LEDS_MAP_LED7) | LEDS_PIN_LOW_MASK(LEDS_MAP_LED8) |             \
+                LEDS_PIN_LOW_MASK(LEDS_MAP_LED9) | LEDS_PIN_LOW_MASK(LEDS_MAP_LED10) |            \
+                LEDS_PIN_LOW_MASK(LEDS_MAP_LED11) | LEDS_PIN_LOW_MASK(LEDS_MAP_LED12) |           \
+                LEDS_PIN_LOW_MASK(LEDS_MAP_LED13) | LEDS_PIN_LOW_MASK(LEDS_MAP_LED14) |           \
+                LEDS_PIN_LOW_MASK(LEDS_MAP_LED15) | LEDS_PIN_LOW_MASK(LEDS_MAP_LED16)))
+
+/* === Public data type declarations =========================================================== */
+
+/* === Public variable declarations ============================================================ */
+
+/**
+ * @brief Port mask of every logical LED, index 0 is an invalid LED with no bit.
+ *
+ * Kept in the header so that single-LED calls with a constant LED number fold into a constant.
+ */
+static const uint16_t ledsMapMasks[17] = {
+    0,                 LEDS_MAP_MASK(1),  LEDS_MAP_MASK(2),  LEDS_MAP_MASK(3),  LEDS_MAP_MASK(4),
+    LEDS_MAP_MASK(5),  LEDS_MAP_MASK(6),  LEDS_MAP_MASK(7),  LEDS_MAP_MASK(8),  LEDS_MAP_MASK(9),
+    LEDS_MAP_MASK(10), LEDS_MAP_MASK(11), LEDS_MAP_MASK(12), LEDS_MAP_MASK(13), LEDS_MAP_MASK(14),
+    LEDS_MAP_MASK(15), LEDS_MAP_MASK(16),
+};
+
+/* === Public function declarations ============================================================ */
+
+/**
+ * @brief Converts a logical LED number into its port mask.
+ *
+ * @param led Logical LED number (1 to 16).
+ *
+ * @return uint16_t Port mask of the LED, 0 if the LED is out of range.
+ */
+static inline uint16_t LedsMap_ledToMask(uint8_t led) {
+    return (led <= 16) ? ledsMapMasks[led] : 0;
+}
+
+/**
+ * @brief Turns on a logical LED of the first port of a group.
+ *
+ * With a constant LED number this is a single masked write with constant mask and value.
+ *
+ * @param group Group of LEDs.
+ *
+ * @param led Logical LED number (1 to 16).
+ *
+ * @return void
+ */
+static inline void LedsMap_turnOnSingle(Leds_t * group, uint8_t led) {
+    LedsGroup_writeMasked(group, LedsMap_ledToMask(led), (uint16_t)~LEDS_MAP_ACTIVE_LOW);
+}
+
+/**
+ * @brief Turns off a logical LED of the first port of a group.
+ *
+ * @param group Group of LEDs.
+ *
+ * @param led Logical LED number (1 to 16).
+ *
+ * @return void
+ */
+static inline void LedsMap_turnOffSingle(Leds_t * group, uint8_t led) {
+    LedsGroup_writeMasked(group, LedsMap_ledToMask(led), LEDS_MAP_ACTIVE_LOW);
+}
+
+/**
+ * @brief Checks if a logical LED of the first port of a group is turned on.
+ *
+ * @param group Group of LEDs.
+ *
+ * @param led Logical LED number (1 to 16).
+ *
+ * @return true if the LED is turned on, false if it is off or out of range.
+ */
+static inline bool LedsMap_isLedTurnedOn(Leds_t * group, uint8_t led) {
+    return ((LedsGroup_getAll(group) ^ LEDS_MAP_ACTIVE_LOW) & LedsMap_ledToMask(led)) != 0;
+}
+
+/**
+ * @brief Converts a mask of logical LEDs into the port mask of the same LEDs.
+ *
+ * Uses two precomputed 256-entry permutation tables, one per byte of the mask.
+ *
+ * @param logical Mask of logical LEDs (bit 0 is LED 1).
+ *
+ * @return uint16_t Port mask of the LEDs.
+ */
+uint16_t LedsMap_toPhysical(uint16_t logical);
+
+/**
+ * @brief Converts a port mask into the mask of the logical LEDs wired to those bits.
+ *
+ * @param physical Port mask.
+ *
+ * @return uint16_t Mask of logical LEDs (bit 0 is LED 1).
+ */
+uint16_t LedsMap_toLogical(uint16_t physical);
+
+/**
+ * @brief Initializes a group of LEDs on a remapped port, with every logical LED off.
+ *
+ * @param group Storage of the group, provided by the caller.
+ *
+ * @param address Pointer to the output port.
+ *
+ * @return void
+ */
+void LedsMap_init(Leds_t * group, uint16_t * address);
+
+/**
+ * @brief Turns on every logical LED whose bit is set in a mask, with a single port write.
+ *
+ * @param group Group of LEDs.
+ *
+ * @param mask Mask of logical LEDs (bit 0 is LED 1).
+ *
+ * @return void
+ */
+void LedsMap_setMask(Leds_t * group, uint16_t mask);
+
+/**
+ * @brief Turns off every logical LED whose bit is set in a mask, with a single port write.
+ *
+ * @param group Group of LEDs.
+ *
+ * @param mask Mask of logical LEDs (bit 0 is LED 1).
+ *
+ * @return void
+ */
+void LedsMap_clearMask(Leds_t * group, uint16_t mask);
+
+/**
+ * @brief Inverts every logical LED whose bit is set in a mask, with a single port write.
+ *
+ * @param group Group of LEDs.
+ *
+ * @param mask Mask of logical LEDs (bit 0 is LED 1).
+ *
+ * @return void
+ */
+void LedsMap_toggleMask(Leds_t * group, uint16_t mask);
+
+/**
+ * @brief Writes the logical LEDs selected by a mask, with a single port write.
+ *
+ * @param group Group of LEDs.
+ *
+ * @param mask Mask of logical LEDs to write (bit 0 is LED 1).
+ *
+ * @param value New state of the selected LEDs, 1 is on whatever the polarity.
+ *
+ * @return void
+ */
+void LedsMap_writeMasked(Leds_t * group, uint16_t mask, uint16_t value);
+
+/**
+ * @brief Reads the state of all logical LEDs at once.
+ *
+ * @param group Group of LEDs.
+ *
+ * @return uint16_t Mask with a 1 for every logical LED that is on (bit 0 is LED 1).
+ */
+uint16_t LedsMap_getAll(Leds_t * group);
+
+/* === End of documentation ==================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LEDS_MAP_H */
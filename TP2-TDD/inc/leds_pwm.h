@@ -0,0 +1,144 @@
+/************************************************************************************************
+Copyright (c) 2025, Juan Manuel Guariste <juanmaguariste@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef LEDS_PWM_H
+#define LEDS_PWM_H
+
+/** @file leds_pwm.h
+ ** @brief Brightness control of LEDs by bit-angle modulation (BAM)
+ **/
+
+/* === Headers files inclusions ================================================================ */
+#include "leds.h"
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+
+//! Number of bit planes, one per bit of the brightness level
+#define LEDS_PWM_BITS 8
+
+//! Number of ticks of a full modulation frame
+#define LEDS_PWM_FRAME_TICKS ((1 << LEDS_PWM_BITS) - 1)
+
+/* === Public data type declarations =========================================================== */
+
+/**
+ * @brief State of a brightness engine for the LEDs of one word of a group.
+ *
+ * The storage is provided by the caller and must only be accessed through the LedsPwm_
+ * functions. Every bit plane holds the port mask of the LEDs whose (gamma corrected) level has
+ * that bit set, plane n is shown for 2^n ticks.
+ */
+typedef struct {
+    Leds_t * group;                     //!< Group of LEDs driven by the engine
+    uint8_t word;                       //!< Word of the group driven by the engine
+    LedsWord_t mask;                    //!< LEDs of the word under brightness control
+    LedsWord_t planes[LEDS_PWM_BITS];   //!< Precomputed port mask of every bit plane
+    uint8_t levels[LEDS_WORD_BITS];     //!< Level requested for every LED of the word
+    uint8_t plane;                      //!< Bit plane currently shown
+    uint8_t remaining;                  //!< Ticks left before showing the next bit plane
+} LedsPwm_t;
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+
+/**
+ * @brief Initializes a brightness engine.
+ *
+ * No LED is under brightness control until a level is set for it.
+ *
+ * @param pwm Storage of the engine, provided by the caller.
+ *
+ * @param group Group of LEDs driven by the engine, already initialized.
+ *
+ * @param word Index of the word of the group driven by the engine (word 0 holds LEDs 1 to
+ * LEDS_WORD_BITS).
+ *
+ * @return void
+ */
+void LedsPwm_init(LedsPwm_t * pwm, Leds_t * group, uint8_t word);
+
+/**
+ * @brief Sets the brightness of a LED and puts it under brightness control.
+ *
+ * The level is gamma corrected through a lookup table so that equal steps of level look like
+ * equal steps of brightness. Only the bit planes are updated, the port changes on the next
+ * ticks.
+ *
+ * @param pwm Brightness engine.
+ *
+ * @param led LED number inside the word (1 to LEDS_WORD_BITS).
+ *
+ * @param level Perceived brightness (0 is off, 255 is fully on).
+ *
+ * @return void
+ */
+void LedsPwm_setLevel(LedsPwm_t * pwm, uint8_t led, uint8_t level);
+
+/**
+ * @brief Returns the brightness requested for a LED.
+ *
+ * @param pwm Brightness engine.
+ *
+ * @param led LED number inside the word (1 to LEDS_WORD_BITS).
+ *
+ * @return uint8_t Level set with LedsPwm_setLevel(), 0 for LEDs out of range.
+ */
+uint8_t LedsPwm_getLevel(const LedsPwm_t * pwm, uint8_t led);
+
+/**
+ * @brief Takes a LED out of brightness control, leaving it off.
+ *
+ * @param pwm Brightness engine.
+ *
+ * @param led LED number inside the word (1 to LEDS_WORD_BITS).
+ *
+ * @return void
+ */
+void LedsPwm_release(LedsPwm_t * pwm, uint8_t led);
+
+/**
+ * @brief Advances the modulation by one tick.
+ *
+ * Must be called from a periodic timer, LEDS_PWM_FRAME_TICKS ticks make a full frame. The cost
+ * does not depend on the number of LEDs: when a bit plane ends, the next precomputed plane is
+ * written to the port with a single masked write, otherwise nothing is done. LEDs of the word
+ * that are not under brightness control are never touched.
+ *
+ * @param pwm Brightness engine.
+ *
+ * @return void
+ */
+void LedsPwm_tick(LedsPwm_t * pwm);
+
+/* === End of documentation ==================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LEDS_PWM_H */
@@ -0,0 +1,171 @@
+/************************************************************************************************
+Copyright (c) 2025, Juan Manuel Guariste <juanmaguariste@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef LEDS_SEQUENCER_H
+#define LEDS_SEQUENCER_H
+
+/** @file leds_sequencer.h
+ ** @brief Playback of precompiled LED animations driven by a timer tick
+ **/
+
+/* === Headers files inclusions ================================================================ */
+#include "leds.h"
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+
+#ifndef LEDS_SEQ_LAYERS
+//! Number of animations that can play at the same time on a sequencer
+#define LEDS_SEQ_LAYERS 4
+#endif
+
+/* === Public data type declarations =========================================================== */
+
+/**
+ * @brief Frame of an animation.
+ */
+typedef struct {
+    LedsWord_t leds;     //!< State of the LEDs of the animation, bit 0 is the first LED of the word
+    uint16_t durationMs; //!< Time the frame is shown, 0 holds the frame until the layer is stopped
+} LedsFrame_t;
+
+/**
+ * @brief Animation made of a constant table of frames, meant to be placed in flash.
+ */
+typedef struct {
+    const LedsFrame_t * frames; //!< Frames of the animation, in playback order
+    uint16_t count;             //!< Number of frames
+    LedsWord_t mask;            //!< LEDs owned by the animation, other frame bits are ignored
+    bool loop;                  //!< Starts again from the first frame after the last one
+} LedsAnimation_t;
+
+/**
+ * @brief Playback state of one layer of a sequencer.
+ */
+typedef struct {
+    const LedsAnimation_t * animation; //!< Animation being played, NULL if the layer is idle
+    uint16_t frame;                    //!< Frame being shown
+    uint32_t frameStart;               //!< Time at which the frame started, in milliseconds
+} LedsSeqLayer_t;
+
+/**
+ * @brief State of a sequencer playing animations on one word of a group of LEDs.
+ *
+ * The storage is provided by the caller and must only be accessed through the LedsSeq_
+ * functions. Layers are combined by priority: where the masks of several playing animations
+ * overlap, the layer with the highest index wins.
+ */
+typedef struct {
+    Leds_t * group;                          //!< Group of LEDs driven by the sequencer
+    uint8_t word;                            //!< Word of the group driven by the sequencer
+    LedsSeqLayer_t layers[LEDS_SEQ_LAYERS];  //!< Playback state of every layer
+    LedsWord_t owned;                        //!< LEDs owned by the layers at the last port write
+    uint32_t nextChange;                     //!< Time of the nearest frame change of any layer
+    bool pending;                            //!< At least one layer is waiting for a frame change
+} LedsSeq_t;
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+
+/**
+ * @brief Initializes a sequencer with all its layers idle.
+ *
+ * @param seq Storage of the sequencer, provided by the caller.
+ *
+ * @param group Group of LEDs driven by the sequencer, already initialized.
+ *
+ * @param word Index of the word of the group driven by the sequencer.
+ *
+ * @return void
+ */
+void LedsSeq_init(LedsSeq_t * seq, Leds_t * group, uint8_t word);
+
+/**
+ * @brief Starts playing an animation on a layer, from its first frame.
+ *
+ * The first frame is written to the port immediately. Any animation already playing on the
+ * layer is replaced.
+ *
+ * @param seq Sequencer.
+ *
+ * @param layer Layer to use (0 to LEDS_SEQ_LAYERS - 1), higher layers have priority.
+ *
+ * @param animation Animation to play, it must outlive the playback.
+ *
+ * @param now Current time in milliseconds.
+ *
+ * @return true if the animation started, false if the layer or the animation is not valid.
+ */
+bool LedsSeq_play(LedsSeq_t * seq, uint8_t layer, const LedsAnimation_t * animation, uint32_t now);
+
+/**
+ * @brief Stops the animation of a layer.
+ *
+ * LEDs owned by the animation go back to the lower layers that own them, or are turned off.
+ *
+ * @param seq Sequencer.
+ *
+ * @param layer Layer to stop (0 to LEDS_SEQ_LAYERS - 1).
+ *
+ * @return void
+ */
+void LedsSeq_stop(LedsSeq_t * seq, uint8_t layer);
+
+/**
+ * @brief Checks if a layer is playing an animation.
+ *
+ * @param seq Sequencer.
+ *
+ * @param layer Layer to check (0 to LEDS_SEQ_LAYERS - 1).
+ *
+ * @return true if the layer is playing, false if it is idle or out of range.
+ */
+bool LedsSeq_isPlaying(const LedsSeq_t * seq, uint8_t layer);
+
+/**
+ * @brief Advances the animations to the current time.
+ *
+ * Must be called periodically, typically from the millisecond tick. When no frame change is due
+ * it returns after a single comparison. When one or more layers change frame, the layers are
+ * combined and the port is written once. A late call catches up without drifting, and after a
+ * long stall a looping layer skips its whole loops at once instead of stepping every frame.
+ *
+ * @param seq Sequencer.
+ *
+ * @param now Current time in milliseconds.
+ *
+ * @return void
+ */
+void LedsSeq_tick(LedsSeq_t * seq, uint32_t now);
+
+/* === End of documentation ==================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LEDS_SEQUENCER_H */
@@ -0,0 +1,85 @@
+/************************************************************************************************
+Copyright (c) 2025, Juan Manuel Guariste <juanmaguariste@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef LEDS_SPI_H
+#define LEDS_SPI_H
+
+/** @file leds_spi.h
+ ** @brief Port interface of the SPI with DMA used by serial LED backends
+ **/
+
+/* === Headers files inclusions ================================================================ */
+#include <stdint.h>
+#include <stdbool.h>
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+
+/* === Public data type declarations =========================================================== */
+
+/**
+ * @brief Function called from the DMA complete interrupt when a transfer ends.
+ *
+ * @param context Pointer given when the transfer was started.
+ */
+typedef void (*LedsSpiDone_t)(void * context);
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+
+/**
+ * @brief Starts sending a buffer through the SPI with DMA, most significant bit first.
+ *
+ * @note Every board provides its own implementation, test/support/leds_spi_host.c is the host fake.
+ *
+ * @param data Buffer to send, it must not change until the transfer ends.
+ *
+ * @param length Number of bytes to send.
+ *
+ * @param done Function to call when the transfer ends.
+ *
+ * @param context Pointer passed to the done function.
+ *
+ * @return true if the transfer started, false if the SPI is busy.
+ */
+bool LedsSpi_startTransfer(const uint8_t * data, uint16_t length, LedsSpiDone_t done,
+                           void * context);
+
+/**
+ * @brief Pulses the latch line, copying the shift registers to their outputs.
+ *
+ * @return void
+ */
+void LedsSpi_latch(void);
+
+/* === End of documentation ==================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LEDS_SPI_H */
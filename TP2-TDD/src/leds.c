@@ -26,6 +26,9 @@ SPDX-License-Identifier: MIT
 /* === Headers files inclusions =============================================================== */
 
 #include "leds.h"
+#include "profile.h"
+#include "telemetry.h"
+#include <stddef.h>
 
 /* === Macros definitions ====================================================================== */
 
@@ -39,39 +42,245 @@ SPDX-License-Identifier: MIT
 #define FIRST_BIT 1
 //! brief Minimum LED number
 #define MIN_LED 1
-//! brief Maximum LED number
-#define MAX_LED 16
+//! brief Shift to obtain the port index of a LED (LEDS_PER_PORT is 1 << PORT_INDEX_SHIFT)
+#define PORT_INDEX_SHIFT 4
+//! brief Mask to obtain the bit of a LED inside its port
+#define PORT_BIT_MASK (LEDS_PER_PORT - 1)
+//! brief Number of ports covered by a word-wide operation
+#define PORTS_PER_WORD (LEDS_WORD_BITS / LEDS_PER_PORT)
+//! brief Shift of the reset half of a set/reset register
+#define RESET_BITS_SHIFT 16
+
+#ifndef LEDS_PORT_WRITE
+//! brief Writes a LED port, the benchmark replaces it to count the port accesses
+#define LEDS_PORT_WRITE(address, value) (*(address) = (value))
+#endif
+
+#ifndef LEDS_PORT_READ
+//! brief Reads a LED port, the benchmark replaces it to count the port accesses
+#define LEDS_PORT_READ(address) (*(address))
+#endif
+
+#if TELEMETRY_ENABLED
+//! brief Mirrors a port of the default group to the telemetry channel, frames when committed
+#define MIRROR_PORT_VALUE(self, port, value)                                                       \
+    ((self) == &defaultLeds && !(self)->buffered ? TELEMETRY_LED_PORT(port, value) : (void)0)
+//! brief Mirrors a port of the default group written by a frame commit
+#define MIRROR_COMMIT_VALUE(self, port, value)                                                     \
+    ((self) == &defaultLeds ? TELEMETRY_LED_PORT(port, value) : (void)0)
+#else
+//! brief Mirrors a port of the default group to the telemetry channel, frames when committed
+#define MIRROR_PORT_VALUE(self, port, value)
+//! brief Mirrors a port of the default group written by a frame commit
+#define MIRROR_COMMIT_VALUE(self, port, value)
+#endif
+
+_Static_assert(LEDS_WORD_BITS == 32 || LEDS_WORD_BITS == 64, "LEDS_WORD_BITS must be 32 or 64");
+_Static_assert(LEDS_MAX_PORTS > 0 && LEDS_MAX_PORTS <= UINT8_MAX, "LEDS_MAX_PORTS out of range");
 
 /* === Private data type declarations ========================================================== */
 
+
 /* === Private variable declarations =========================================================== */
 
-//! @brief Private variable to store the address of the LEDs output port
-static uint16_t * portAddress;
+//! @brief Private default group used by the Leds_ functions
+static Leds_t defaultLeds;
+
+//! @brief Groups buffering frames, published together by Leds_commitTick()
+static Leds_t * frameGroups[LEDS_MAX_FRAME_GROUPS];
+
+//! @brief Number of entries used in frameGroups
+static uint8_t frameGroupCount;
 
 /* === Private function declarations =========================================================== */
 /**
- * @brief Private function to convert an LED number into a bit mask.
+ * @brief Private function to convert an LED number into a bit mask inside its port.
  *
  * @param led LED number for which the bit mask is needed.
  *
  * @return Bit mask with a 1 in the position corresponding to the LED.
  */
-static uint16_t ledToMask(uint8_t led);
+static uint16_t ledToMask(uint16_t led);
+
+/**
+ * @brief Private function to convert an LED number into the index of its port.
+ *
+ * @param led LED number for which the port is needed.
+ *
+ * @return Index of the port in the bank.
+ */
+static uint8_t ledToPort(uint16_t led);
 
 /**
- * @brief Private function to update the value of the LED port.
- *  *
+ * @brief Private function to check that an LED number belongs to the bank.
+ *
+ * @param self Group of LEDs.
+ *
+ * @param led LED number to check.
+ *
+ * @return true if the LED is between 1 and the number of LEDs of the bank.
+ */
+static bool isValidLed(const Leds_t * self, uint16_t led);
+
+/**
+ * @brief Private function to update the value of a LED port.
+ *
+ * @param self Group of LEDs.
+ *
+ * @param port Index of the port in the bank.
+ *
  * @param value The value to be written to the port. Each bit corresponds to a specific LED's state.
  *
  * @return void
  */
-static void updatePortValue(uint16_t value);
+static void updatePortValue(Leds_t * self, uint8_t port, uint16_t value);
+
+/**
+ * @brief Private function to read the current value of a LED port.
+ *
+ * @param self Group of LEDs.
+ *
+ * @param port Index of the port in the bank.
+ *
+ * @return uint16_t The value of the port. Each bit corresponds to a specific LED's state.
+ */
+static uint16_t readPortValue(Leds_t * self, uint8_t port);
+
+/**
+ * @brief Private function to turn on the LEDs of a port selected by a mask.
+ *
+ * @param self Group of LEDs.
+ *
+ * @param port Index of the port in the bank.
+ *
+ * @param mask Bit mask of LEDs to turn on.
+ *
+ * @return void
+ */
+static void setPortBits(Leds_t * self, uint8_t port, uint16_t mask);
+
+/**
+ * @brief Private function to turn off the LEDs of a port selected by a mask.
+ *
+ * @param self Group of LEDs.
+ *
+ * @param port Index of the port in the bank.
+ *
+ * @param mask Bit mask of LEDs to turn off.
+ *
+ * @return void
+ */
+static void clearPortBits(Leds_t * self, uint8_t port, uint16_t mask);
+
+/**
+ * @brief Private function to invert the LEDs of a port selected by a mask.
+ *
+ * @param self Group of LEDs.
+ *
+ * @param port Index of the port in the bank.
+ *
+ * @param mask Bit mask of LEDs to toggle.
+ *
+ * @return void
+ */
+static void togglePortBits(Leds_t * self, uint8_t port, uint16_t mask);
+
+/**
+ * @brief Private function to write the LEDs of a port selected by a mask.
+ *
+ * @param self Group of LEDs.
+ *
+ * @param port Index of the port in the bank.
+ *
+ * @param mask Bit mask of LEDs to write.
+ *
+ * @param value New state of the selected LEDs.
+ *
+ * @return void
+ */
+static void writePortBits(Leds_t * self, uint8_t port, uint16_t mask, uint16_t value);
+
+/**
+ * @brief Private function to extract the part of a word-wide mask that belongs to one port.
+ *
+ * @param mask Word-wide mask.
+ *
+ * @param part Index of the port inside the word (0 to PORTS_PER_WORD - 1).
+ *
+ * @return uint16_t Mask of the port.
+ */
+static uint16_t wordToPortMask(LedsWord_t mask, uint8_t part);
+
+/**
+ * @brief Private function to obtain the bits of a port that are wired to LEDs of the bank.
+ *
+ * @param self Group of LEDs.
+ *
+ * @param port Index of the port in the bank.
+ *
+ * @return uint16_t Mask with a 1 for every bit of the port owned by the bank, only the last
+ * port of a partly wired bank has bits cleared.
+ */
+static uint16_t portValidMask(const Leds_t * self, uint8_t port);
+
+/**
+ * @brief Private function to write every bit of a port owned by the bank.
+ *
+ * A fully wired port is written at once, the last port of a partly wired bank with a
+ * read-modify-write that leaves the pins the bank does not own untouched.
+ *
+ * @param self Group of LEDs.
+ *
+ * @param port Index of the port in the bank.
+ *
+ * @param value New state of the LEDs of the port.
+ *
+ * @return void
+ */
+static void writeOwnedBits(Leds_t * self, uint8_t port, uint16_t value);
+
+#if LEDS_USE_SHADOW
+/**
+ * @brief Private function to bring the hardware in line with an update of the shadow.
+ *
+ * With a set/reset register only the bits changed by this update are written, which is atomic
+ * in hardware. Otherwise the whole shadow is written. In both cases the port is written again
+ * from the shadow if another context changed it in the meantime, so the last writer always
+ * leaves the port equal to the shadow.
+ *
+ * @param self Group of LEDs.
+ *
+ * @param port Index of the port in the bank.
+ *
+ * @param oldValue Shadow value before the update.
+ *
+ * @param newValue Shadow value after the update.
+ *
+ * @return void
+ */
+static void publishPortValue(Leds_t * self, uint8_t port, uint16_t oldValue,
+                             uint16_t newValue);
+
+/**
+ * @brief Private function to write the whole shadow of a port until no other context changed it.
+ *
+ * @param self Group of LEDs.
+ *
+ * @param port Index of the port in the bank.
+ *
+ * @param value Shadow value after the update.
+ *
+ * @return uint16_t Value left in the port.
+ */
+static uint16_t publishWholePort(Leds_t * self, uint8_t port, uint16_t value);
+#endif
 
 /**
  * @brief Private function to set the state of an individual LED. *
  *
- * @param led The LED number to set the state for (1 to 16).
+ * @param self Group of LEDs.
+ *
+ * @param led The LED number to set the state for (1 to the number of LEDs of the bank).
  *
  * @param state The desired state of the LED (ON or OFF).
  *
@@ -79,23 +288,66 @@ static void updatePortValue(uint16_t value);
  *
  * @return void
  */
-static void setLedState(uint8_t led, LedState_t state);
+static void setLedState(Leds_t * self, uint16_t led, LedState_t state);
+
+/**
+ * @brief Private function to set the addresses of the LED ports.
+ *
+ * @param self Group of LEDs.
+ *
+ * @param addresses Pointer to the address of every LED port.
+ *
+ * @param count Number of ports.
+ *
+ * @param ledCount Number of LEDs, 0 for LEDS_PER_PORT on every port.
+ *
+ * @return void
+ */
+static void setPortAddress(Leds_t * self, uint16_t * const * addresses, uint8_t count,
+                           uint16_t ledCount);
 
 /**
- * @brief Private function to set the address of the LED port.
+ * @brief Private function to write an output port of a buffered group.
+ *
+ * @param self Group of LEDs.
+ *
+ * @param port Index of the port in the bank.
  *
- * @param address Pointer to the address of the LED port.
+ * @param value The value to be shown by the port.
  *
  * @return void
  */
-static void setPortAddress(uint16_t * address);
+static void writeFrontPort(Leds_t * self, uint8_t port, uint16_t value);
 
 /**
- * @brief Private function to get the address of the LED port.
+ * @brief Private function to publish a frame, writing only the ports that changed.
  *
- * @return uint16_t* Pointer to the address of the LED port.
+ * @param self Group of LEDs.
+ *
+ * @param frame Value of every port of the bank.
+ *
+ * @return uint16_t Number of port writes made.
  */
-static uint16_t * getPortAddress(void);
+static uint16_t publishFrame(Leds_t * self, const uint16_t * frame);
+
+/**
+ * @brief Private function to add a group to the groups published by Leds_commitTick().
+ *
+ * @param self Group of LEDs.
+ *
+ * @return true if the group is in the list, false if the list is full.
+ */
+static bool addFrameGroup(Leds_t * self);
+
+/**
+ * @brief Private function to remove a group from the groups published by Leds_commitTick().
+ *
+ * @param self Group of LEDs.
+ *
+ * @return void
+ */
+static void removeFrameGroup(Leds_t * self);
+
 
 /* === Public variable definitions =============================================================
  */
@@ -105,70 +357,587 @@ static uint16_t * getPortAddress(void);
 
 /* === Private function implementation =========================================================
  */
-uint16_t ledToMask(uint8_t led) {
-    return (FIRST_BIT << (led - LEDS_TO_BIT_OFFSET));
+uint16_t ledToMask(uint16_t led) {
+    return (FIRST_BIT << ((led - LEDS_TO_BIT_OFFSET) & PORT_BIT_MASK));
 };
 
-void updatePortValue(uint16_t value) {
-    *portAddress = value;
+uint8_t ledToPort(uint16_t led) {
+    return (uint8_t)((led - LEDS_TO_BIT_OFFSET) >> PORT_INDEX_SHIFT);
+}
+
+bool isValidLed(const Leds_t * self, uint16_t led) {
+    return (uint16_t)(led - MIN_LED) < self->ledCount;
+}
+
+uint16_t wordToPortMask(LedsWord_t mask, uint8_t part) {
+    return (uint16_t)(mask >> (part * LEDS_PER_PORT));
+}
+
+uint16_t portValidMask(const Leds_t * self, uint8_t port) {
+    uint16_t ledsLeft = self->ledCount - (uint16_t)port * LEDS_PER_PORT;
+    if (ledsLeft >= LEDS_PER_PORT) {
+        return ALL_LEDS_ON;
+    }
+    return (uint16_t)((FIRST_BIT << ledsLeft) - 1);
+}
+
+void writeOwnedBits(Leds_t * self, uint8_t port, uint16_t value) {
+    uint16_t validMask = portValidMask(self, port);
+    if (validMask == ALL_LEDS_ON) {
+        updatePortValue(self, port, value);
+    } else {
+        writePortBits(self, port, validMask, value);
+    }
+}
+
+#if LEDS_USE_SHADOW
+
+void updatePortValue(Leds_t * self, uint8_t port, uint16_t value) {
+    publishPortValue(self, port, atomic_exchange(&self->portShadow[port], value), value);
+}
+
+uint16_t readPortValue(Leds_t * self, uint8_t port) {
+    return atomic_load(&self->portShadow[port]);
+}
+
+void setPortBits(Leds_t * self, uint8_t port, uint16_t mask) {
+    uint16_t oldValue = atomic_fetch_or(&self->portShadow[port], mask);
+    publishPortValue(self, port, oldValue, oldValue | mask);
+}
+
+void clearPortBits(Leds_t * self, uint8_t port, uint16_t mask) {
+    uint16_t oldValue = atomic_fetch_and(&self->portShadow[port], (uint16_t)~mask);
+    publishPortValue(self, port, oldValue, oldValue & ~mask);
+}
+
+void togglePortBits(Leds_t * self, uint8_t port, uint16_t mask) {
+    uint16_t oldValue = atomic_fetch_xor(&self->portShadow[port], mask);
+    publishPortValue(self, port, oldValue, oldValue ^ mask);
 }
 
-void setLedState(uint8_t led, LedState_t state) {
-    uint16_t currentValue = *portAddress;
+void writePortBits(Leds_t * self, uint8_t port, uint16_t mask, uint16_t value) {
+    uint16_t oldValue = atomic_load(&self->portShadow[port]);
+    uint16_t newValue;
+    do {
+        newValue = (oldValue & ~mask) | (value & mask);
+    } while (!atomic_compare_exchange_weak(&self->portShadow[port], &oldValue, newValue));
+    publishPortValue(self, port, oldValue, newValue);
+}
+
+void publishPortValue(Leds_t * self, uint8_t port, uint16_t oldValue, uint16_t newValue) {
+    uint16_t written;
+    if (self->buffered) {
+        /* The port is the RAM frame, the hardware is written and profiled by the commit */
+        publishWholePort(self, port, newValue);
+        return;
+    }
+    PROFILE_SCOPE("leds port write");
+    if (self->setResetAddress[port] != NULL) {
+        uint16_t changed = oldValue ^ newValue;
+        uint32_t setReset =
+            (uint32_t)(changed & newValue) | ((uint32_t)(changed & oldValue) << RESET_BITS_SHIFT);
+        do {
+            written = newValue;
+            LEDS_PORT_WRITE(self->setResetAddress[port], setReset);
+            newValue = atomic_load(&self->portShadow[port]);
+            setReset = (uint32_t)newValue | ((uint32_t)(uint16_t)~newValue << RESET_BITS_SHIFT);
+        } while (newValue != written);
+        MIRROR_PORT_VALUE(self, port, written);
+        return;
+    }
+    written = publishWholePort(self, port, newValue);
+    MIRROR_PORT_VALUE(self, port, written);
+}
+
+uint16_t publishWholePort(Leds_t * self, uint8_t port, uint16_t value) {
+    uint16_t written;
+    do {
+        written = value;
+        LEDS_PORT_WRITE((volatile uint16_t *)self->portAddress[port], written);
+        value = atomic_load(&self->portShadow[port]);
+    } while (value != written);
+    return written;
+}
+
+#else
+
+void updatePortValue(Leds_t * self, uint8_t port, uint16_t value) {
+    if (self->buffered) {
+        /* The port is the RAM frame, the hardware is written and profiled by the commit */
+        LEDS_PORT_WRITE(self->portAddress[port], value);
+        return;
+    }
+    PROFILE_SCOPE("leds port write");
+    LEDS_PORT_WRITE(self->portAddress[port], value);
+    MIRROR_PORT_VALUE(self, port, value);
+}
+
+uint16_t readPortValue(Leds_t * self, uint8_t port) {
+    return LEDS_PORT_READ(self->portAddress[port]);
+}
+
+void setPortBits(Leds_t * self, uint8_t port, uint16_t mask) {
+    updatePortValue(self, port, readPortValue(self, port) | mask);
+}
+
+void clearPortBits(Leds_t * self, uint8_t port, uint16_t mask) {
+    updatePortValue(self, port, readPortValue(self, port) & ~mask);
+}
+
+void togglePortBits(Leds_t * self, uint8_t port, uint16_t mask) {
+    updatePortValue(self, port, readPortValue(self, port) ^ mask);
+}
+
+void writePortBits(Leds_t * self, uint8_t port, uint16_t mask, uint16_t value) {
+    updatePortValue(self, port, (readPortValue(self, port) & ~mask) | (value & mask));
+}
+
+#endif
+
+void setLedState(Leds_t * self, uint16_t led, LedState_t state) {
+    if (!isValidLed(self, led)) {
+        return;
+    }
     if (state == LED_ON) {
-        currentValue |= ledToMask(led);
+        setPortBits(self, ledToPort(led), ledToMask(led));
     } else {
-        currentValue &= ~ledToMask(led);
+        clearPortBits(self, ledToPort(led), ledToMask(led));
+    }
+}
+
+void setPortAddress(Leds_t * self, uint16_t * const * addresses, uint8_t count,
+                    uint16_t ledCount) {
+    for (uint8_t port = 0; port < count; port++) {
+        self->portAddress[port] = addresses[port];
+#if LEDS_USE_SHADOW
+        self->setResetAddress[port] = NULL;
+        /* Start from the pins as found, so the bits the bank does not own are written back */
+        if (addresses[port] != NULL) {
+            atomic_store(&self->portShadow[port], LEDS_PORT_READ(addresses[port]));
+        }
+#endif
+    }
+    self->portCount = count;
+    self->ledCount = ledCount != 0 ? ledCount : (uint16_t)count * LEDS_PER_PORT;
+    removeFrameGroup(self);
+    self->buffered = false;
+    self->commitPending = false;
+    self->frameStats = (LedsFrameStats_t){0};
+}
+
+void writeFrontPort(Leds_t * self, uint8_t port, uint16_t value) {
+    PROFILE_SCOPE("leds frame commit write");
+#if LEDS_USE_SHADOW
+    if (self->frontSetReset[port] != NULL) {
+        uint16_t changed = self->front[port] ^ value;
+        uint32_t setReset = (uint32_t)(changed & value) |
+                            ((uint32_t)(changed & self->front[port]) << RESET_BITS_SHIFT);
+        LEDS_PORT_WRITE(self->frontSetReset[port], setReset);
+    } else {
+        LEDS_PORT_WRITE((volatile uint16_t *)self->frontAddress[port], value);
+    }
+#else
+    LEDS_PORT_WRITE((volatile uint16_t *)self->frontAddress[port], value);
+#endif
+    self->front[port] = value;
+    MIRROR_COMMIT_VALUE(self, port, value);
+}
+
+uint16_t publishFrame(Leds_t * self, const uint16_t * frame) {
+    uint16_t writes = 0;
+    for (uint8_t port = 0; port < self->portCount; port++) {
+        if (frame[port] != self->front[port]) {
+            writeFrontPort(self, port, frame[port]);
+            writes++;
+        }
     }
-    updatePortValue(currentValue);
+    self->frameStats.frames++;
+    self->frameStats.writes += writes;
+    self->frameStats.lastWrites = writes;
+    return writes;
 }
 
-void setPortAddress(uint16_t * address) {
-    portAddress = address;
+bool addFrameGroup(Leds_t * self) {
+    for (uint8_t index = 0; index < frameGroupCount; index++) {
+        if (frameGroups[index] == self) {
+            return true;
+        }
+    }
+    if (frameGroupCount == LEDS_MAX_FRAME_GROUPS) {
+        return false;
+    }
+    frameGroups[frameGroupCount++] = self;
+    return true;
 }
 
-uint16_t * getPortAddress(void) {
-    return portAddress;
+void removeFrameGroup(Leds_t * self) {
+    for (uint8_t index = 0; index < frameGroupCount; index++) {
+        if (frameGroups[index] == self) {
+            frameGroups[index] = frameGroups[--frameGroupCount];
+            return;
+        }
+    }
 }
 
 /* === Public function implementation ==========================================================
  */
 
+Leds_t * Leds_getDefault(void) {
+    PROFILE_FUNCTION();
+    return &defaultLeds;
+}
+
+void LedsGroup_init(Leds_t * group, uint16_t * address) {
+    PROFILE_FUNCTION();
+    setPortAddress(group, &address, 1, 0);
+    LedsGroup_turnOffAllLeds(group);
+}
+
+bool LedsGroup_initBank(Leds_t * group, const LedsBank_t * bank) {
+    PROFILE_FUNCTION();
+    if (bank == NULL || bank->ports == NULL || bank->count == 0 || bank->count > LEDS_MAX_PORTS ||
+        bank->ledCount > (uint16_t)bank->count * LEDS_PER_PORT) {
+        return false;
+    }
+    setPortAddress(group, bank->ports, bank->count, bank->ledCount);
+    LedsGroup_turnOffAllLeds(group);
+    return true;
+}
+
+#if LEDS_USE_SHADOW
+void LedsGroup_initSetReset(Leds_t * group, volatile uint32_t * address) {
+    PROFILE_FUNCTION();
+    uint16_t * noPort = NULL;
+
+    setPortAddress(group, &noPort, 1, 0);
+    group->setResetAddress[0] = address;
+    atomic_store(&group->portShadow[0], ALL_LEDS_OFF);
+    *group->setResetAddress[0] = (uint32_t)ALL_LEDS_ON << RESET_BITS_SHIFT;
+}
+#endif
+
+uint16_t LedsGroup_getCount(const Leds_t * group) {
+    PROFILE_FUNCTION();
+    return group->ledCount;
+}
+
+void LedsGroup_turnOnSingle(Leds_t * group, uint16_t led) {
+    PROFILE_FUNCTION();
+    setLedState(group, led, LED_ON);
+}
+
+void LedsGroup_turnOffSingle(Leds_t * group, uint16_t led) {
+    PROFILE_FUNCTION();
+    setLedState(group, led, LED_OFF);
+}
+
+void LedsGroup_turnOnAllLeds(Leds_t * group) {
+    PROFILE_FUNCTION();
+    for (uint8_t port = 0; port < group->portCount; port++) {
+        writeOwnedBits(group, port, ALL_LEDS_ON);
+    }
+}
+
+void LedsGroup_turnOffAllLeds(Leds_t * group) {
+    PROFILE_FUNCTION();
+    for (uint8_t port = 0; port < group->portCount; port++) {
+        writeOwnedBits(group, port, ALL_LEDS_OFF);
+    }
+}
+
+bool LedsGroup_isLedTurnedOn(Leds_t * group, uint16_t led) {
+    PROFILE_FUNCTION();
+    if (!isValidLed(group, led)) {
+        return false;
+    }
+    return (readPortValue(group, ledToPort(led)) & ledToMask(led));
+}
+
+bool LedsGroup_isLedTurnedOff(Leds_t * group, uint16_t led) {
+    PROFILE_FUNCTION();
+    if (!isValidLed(group, led)) {
+        return false;
+    }
+    return !(readPortValue(group, ledToPort(led)) & ledToMask(led));
+}
+
+void LedsGroup_setMask(Leds_t * group, uint16_t mask) {
+    PROFILE_FUNCTION();
+    setPortBits(group, 0, mask);
+}
+
+void LedsGroup_clearMask(Leds_t * group, uint16_t mask) {
+    PROFILE_FUNCTION();
+    clearPortBits(group, 0, mask);
+}
+
+void LedsGroup_toggleMask(Leds_t * group, uint16_t mask) {
+    PROFILE_FUNCTION();
+    togglePortBits(group, 0, mask);
+}
+
+void LedsGroup_writeMasked(Leds_t * group, uint16_t mask, uint16_t value) {
+    PROFILE_FUNCTION();
+    writePortBits(group, 0, mask, value);
+}
+
+uint16_t LedsGroup_getAll(Leds_t * group) {
+    PROFILE_FUNCTION();
+    return readPortValue(group, 0) & portValidMask(group, 0);
+}
+
+void LedsGroup_setWord(Leds_t * group, uint8_t word, LedsWord_t mask) {
+    PROFILE_FUNCTION();
+    uint16_t port = word * PORTS_PER_WORD;
+    for (uint8_t part = 0; part < PORTS_PER_WORD && port < group->portCount; part++, port++) {
+        uint16_t portMask = wordToPortMask(mask, part) & portValidMask(group, port);
+        if (portMask) {
+            setPortBits(group, port, portMask);
+        }
+    }
+}
+
+void LedsGroup_clearWord(Leds_t * group, uint8_t word, LedsWord_t mask) {
+    PROFILE_FUNCTION();
+    uint16_t port = word * PORTS_PER_WORD;
+    for (uint8_t part = 0; part < PORTS_PER_WORD && port < group->portCount; part++, port++) {
+        uint16_t portMask = wordToPortMask(mask, part) & portValidMask(group, port);
+        if (portMask) {
+            clearPortBits(group, port, portMask);
+        }
+    }
+}
+
+void LedsGroup_toggleWord(Leds_t * group, uint8_t word, LedsWord_t mask) {
+    PROFILE_FUNCTION();
+    uint16_t port = word * PORTS_PER_WORD;
+    for (uint8_t part = 0; part < PORTS_PER_WORD && port < group->portCount; part++, port++) {
+        uint16_t portMask = wordToPortMask(mask, part) & portValidMask(group, port);
+        if (portMask) {
+            togglePortBits(group, port, portMask);
+        }
+    }
+}
+
+void LedsGroup_writeWord(Leds_t * group, uint8_t word, LedsWord_t mask, LedsWord_t value) {
+    PROFILE_FUNCTION();
+    uint16_t port = word * PORTS_PER_WORD;
+    for (uint8_t part = 0; part < PORTS_PER_WORD && port < group->portCount; part++, port++) {
+        uint16_t portMask = wordToPortMask(mask, part) & portValidMask(group, port);
+        if (portMask) {
+            writePortBits(group, port, portMask, wordToPortMask(value, part));
+        }
+    }
+}
+
+LedsWord_t LedsGroup_getWord(Leds_t * group, uint8_t word) {
+    PROFILE_FUNCTION();
+    LedsWord_t value = 0;
+    uint16_t port = word * PORTS_PER_WORD;
+    for (uint8_t part = 0; part < PORTS_PER_WORD && port < group->portCount; part++, port++) {
+        uint16_t portValue = readPortValue(group, port) & portValidMask(group, port);
+        value |= (LedsWord_t)portValue << (part * LEDS_PER_PORT);
+    }
+    return value;
+}
+
+bool LedsGroup_setBuffered(Leds_t * group, bool enabled) {
+    PROFILE_FUNCTION();
+    if (enabled == group->buffered) {
+        return true;
+    }
+    if (enabled) {
+        if (!addFrameGroup(group)) {
+            return false;
+        }
+        /* The primitives keep working unchanged, they just write a port that lives in RAM */
+        for (uint8_t port = 0; port < group->portCount; port++) {
+            group->front[port] = readPortValue(group, port);
+            group->frame[port] = group->front[port];
+            group->frontAddress[port] = group->portAddress[port];
+            group->portAddress[port] = &group->frame[port];
+#if LEDS_USE_SHADOW
+            group->frontSetReset[port] = group->setResetAddress[port];
+            group->setResetAddress[port] = NULL;
+#endif
+        }
+        group->buffered = true;
+        return true;
+    }
+    group->commitPending = false;
+    LedsGroup_commit(group);
+    removeFrameGroup(group);
+    for (uint8_t port = 0; port < group->portCount; port++) {
+        group->portAddress[port] = group->frontAddress[port];
+#if LEDS_USE_SHADOW
+        group->setResetAddress[port] = group->frontSetReset[port];
+#endif
+    }
+    group->buffered = false;
+    return true;
+}
+
+uint16_t LedsGroup_commit(Leds_t * group) {
+    PROFILE_FUNCTION();
+    uint16_t frame[LEDS_MAX_PORTS];
+    if (!group->buffered) {
+        return 0;
+    }
+    for (uint8_t port = 0; port < group->portCount; port++) {
+        frame[port] = readPortValue(group, port);
+    }
+    return publishFrame(group, frame);
+}
+
+void LedsGroup_commitOnTick(Leds_t * group) {
+    PROFILE_FUNCTION();
+    if (!group->buffered) {
+        return;
+    }
+    /* A tick arriving while the frame is copied skips the group instead of publishing half of it */
+    group->commitPending = false;
+    for (uint8_t port = 0; port < group->portCount; port++) {
+        group->ready[port] = readPortValue(group, port);
+    }
+    group->commitPending = true;
+}
+
+LedsFrameStats_t LedsGroup_getFrameStats(const Leds_t * group) {
+    PROFILE_FUNCTION();
+    return group->frameStats;
+}
+
 void Leds_init(uint16_t * address) {
-    setPortAddress(address);
-    Leds_turnOffAllLeds();
+    PROFILE_FUNCTION();
+    LedsGroup_init(&defaultLeds, address);
 };
 
-void Leds_turnOnSingle(uint8_t led) {
-    setLedState(led, LED_ON);
+bool Leds_initBank(const LedsBank_t * bank) {
+    PROFILE_FUNCTION();
+    return LedsGroup_initBank(&defaultLeds, bank);
+}
+
+uint16_t Leds_getCount(void) {
+    PROFILE_FUNCTION();
+    return LedsGroup_getCount(&defaultLeds);
+}
+
+#if LEDS_USE_SHADOW
+void Leds_initSetReset(volatile uint32_t * address) {
+    PROFILE_FUNCTION();
+    LedsGroup_initSetReset(&defaultLeds, address);
+}
+#endif
+
+void Leds_turnOnSingle(uint16_t led) {
+    PROFILE_FUNCTION();
+    LedsGroup_turnOnSingle(&defaultLeds, led);
 };
 
-void Leds_turnOffSingle(uint8_t led) {
-    setLedState(led, LED_OFF);
+void Leds_turnOffSingle(uint16_t led) {
+    PROFILE_FUNCTION();
+    LedsGroup_turnOffSingle(&defaultLeds, led);
 };
 
 void Leds_turnOnAllLeds() {
-    updatePortValue(ALL_LEDS_ON);
+    PROFILE_FUNCTION();
+    LedsGroup_turnOnAllLeds(&defaultLeds);
 };
 
 void Leds_turnOffAllLeds(void) {
-    updatePortValue(ALL_LEDS_OFF);
+    PROFILE_FUNCTION();
+    LedsGroup_turnOffAllLeds(&defaultLeds);
 }
 
-bool Leds_isLedTurnedOn(uint8_t led) {
-    if (led < MIN_LED || led > MAX_LED) {
-        return false;
-    }
-    uint16_t * port = getPortAddress();
-    return (*port & ledToMask(led));
+bool Leds_isLedTurnedOn(uint16_t led) {
+    PROFILE_FUNCTION();
+    return LedsGroup_isLedTurnedOn(&defaultLeds, led);
 };
 
-bool Leds_isLedTurnedOff(uint8_t led) {
-    if (led < MIN_LED || led > MAX_LED) {
-        return false;
+bool Leds_isLedTurnedOff(uint16_t led) {
+    PROFILE_FUNCTION();
+    return LedsGroup_isLedTurnedOff(&defaultLeds, led);
+}
+
+void Leds_setMask(uint16_t mask) {
+    PROFILE_FUNCTION();
+    LedsGroup_setMask(&defaultLeds, mask);
+}
+
+void Leds_clearMask(uint16_t mask) {
+    PROFILE_FUNCTION();
+    LedsGroup_clearMask(&defaultLeds, mask);
+}
+
+void Leds_toggleMask(uint16_t mask) {
+    PROFILE_FUNCTION();
+    LedsGroup_toggleMask(&defaultLeds, mask);
+}
+
+void Leds_writeMasked(uint16_t mask, uint16_t value) {
+    PROFILE_FUNCTION();
+    LedsGroup_writeMasked(&defaultLeds, mask, value);
+}
+
+uint16_t Leds_getAll(void) {
+    PROFILE_FUNCTION();
+    return LedsGroup_getAll(&defaultLeds);
+}
+
+void Leds_setWord(uint8_t word, LedsWord_t mask) {
+    PROFILE_FUNCTION();
+    LedsGroup_setWord(&defaultLeds, word, mask);
+}
+
+void Leds_clearWord(uint8_t word, LedsWord_t mask) {
+    PROFILE_FUNCTION();
+    LedsGroup_clearWord(&defaultLeds, word, mask);
+}
+
+void Leds_toggleWord(uint8_t word, LedsWord_t mask) {
+    PROFILE_FUNCTION();
+    LedsGroup_toggleWord(&defaultLeds, word, mask);
+}
+
+void Leds_writeWord(uint8_t word, LedsWord_t mask, LedsWord_t value) {
+    PROFILE_FUNCTION();
+    LedsGroup_writeWord(&defaultLeds, word, mask, value);
+}
+
+LedsWord_t Leds_getWord(uint8_t word) {
+    PROFILE_FUNCTION();
+    return LedsGroup_getWord(&defaultLeds, word);
+}
+
+bool Leds_setBuffered(bool enabled) {
+    PROFILE_FUNCTION();
+    return LedsGroup_setBuffered(&defaultLeds, enabled);
+}
+
+uint16_t Leds_commit(void) {
+    PROFILE_FUNCTION();
+    return LedsGroup_commit(&defaultLeds);
+}
+
+void Leds_commitOnTick(void) {
+    PROFILE_FUNCTION();
+    LedsGroup_commitOnTick(&defaultLeds);
+}
+
+void Leds_commitTick(void) {
+    PROFILE_FUNCTION();
+    for (uint8_t index = 0; index < frameGroupCount; index++) {
+        Leds_t * group = frameGroups[index];
+        if (group->buffered && group->commitPending) {
+            group->commitPending = false;
+            publishFrame(group, group->ready);
+        }
     }
-    uint16_t * port = getPortAddress();
-    return !(*port & ledToMask(led));
+}
+
+LedsFrameStats_t Leds_getFrameStats(void) {
+    PROFILE_FUNCTION();
+    return LedsGroup_getFrameStats(&defaultLeds);
 }
 /* === End of documentation ====================================================================
- */
\ No newline at end of file
+ */
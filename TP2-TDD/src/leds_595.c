@@ -0,0 +1,144 @@
+/************************************************************************************************
+Copyright (c) 2025, Juan Manuel Guariste <juanmaguariste@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** @file leds_595.c
+ ** @brief Definition of the LED backend for a chain of 74HC595 shift registers
+ **/
+
+/* === Headers files inclusions =============================================================== */
+
+#include "leds_595.h"
+#include "leds_spi.h"
+#include <string.h>
+
+/* === Macros definitions ====================================================================== */
+
+//! brief Number of LEDs driven by a shift register
+#define LEDS_PER_REGISTER 8
+//! brief Number of shift registers held in a port word
+#define REGISTERS_PER_PORT (LEDS_PER_PORT / LEDS_PER_REGISTER)
+
+_Static_assert(LEDS_595_MAX_PORTS <= LEDS_MAX_PORTS,
+               "LEDS_595_MAX_REGISTERS exceeds LEDS_MAX_PORTS");
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/**
+ * @brief Private function to get the number of port words used by a chain.
+ *
+ * @param chain Chain of registers.
+ *
+ * @return uint8_t Number of port words.
+ */
+static uint8_t portCount(const Leds595_t * chain);
+
+/**
+ * @brief Private function to serialise the last frame into the DMA buffer.
+ *
+ * The byte of the last register goes first, so that it ends up at the far end of the chain.
+ *
+ * @param chain Chain of registers.
+ *
+ * @return void
+ */
+static void serialiseFrame(Leds595_t * chain);
+
+/**
+ * @brief Private function called from the DMA complete interrupt to latch the frame.
+ *
+ * @param context Chain of registers.
+ *
+ * @return void
+ */
+static void transferDone(void * context);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+uint8_t portCount(const Leds595_t * chain) {
+    return (chain->registers + REGISTERS_PER_PORT - 1) / REGISTERS_PER_PORT;
+}
+
+void serialiseFrame(Leds595_t * chain) {
+    for (uint8_t reg = 0; reg < chain->registers; reg++) {
+        uint16_t port = chain->sent[reg / REGISTERS_PER_PORT];
+        chain->buffer[chain->registers - 1 - reg] =
+            (uint8_t)(port >> ((reg % REGISTERS_PER_PORT) * LEDS_PER_REGISTER));
+    }
+}
+
+void transferDone(void * context) {
+    Leds595_t * chain = context;
+    LedsSpi_latch();
+    chain->busy = false;
+}
+
+/* === Public function implementation ========================================================== */
+
+bool Leds595_init(Leds595_t * chain, Leds_t * group, uint8_t registers) {
+    if (registers == 0 || registers > LEDS_595_MAX_REGISTERS) {
+        return false;
+    }
+    uint16_t * ports[LEDS_595_MAX_PORTS];
+    memset(chain, 0, sizeof(*chain));
+    chain->group = group;
+    chain->registers = registers;
+    chain->resend = true;
+    for (uint8_t port = 0; port < portCount(chain); port++) {
+        ports[port] = &chain->image[port];
+    }
+    /* With an odd number of registers the upper half of the last port word is not shown */
+    LedsBank_t bank = {.ports = ports,
+                       .count = portCount(chain),
+                       .ledCount = (uint16_t)registers * LEDS_PER_REGISTER};
+    return LedsGroup_initBank(group, &bank);
+}
+
+bool Leds595_update(Leds595_t * chain) {
+    size_t size = portCount(chain) * sizeof(chain->image[0]);
+    if (chain->busy || (!chain->resend && memcmp(chain->image, chain->sent, size) == 0)) {
+        return false;
+    }
+    memcpy(chain->sent, chain->image, size);
+    serialiseFrame(chain);
+    chain->busy = true;
+    if (!LedsSpi_startTransfer(chain->buffer, chain->registers, transferDone, chain)) {
+        chain->busy = false;
+        chain->resend = true;
+        return false;
+    }
+    chain->resend = false;
+    chain->frames++;
+    return true;
+}
+
+uint32_t Leds595_getFrames(const Leds595_t * chain) {
+    return chain->frames;
+}
+
+/* === End of documentation ==================================================================== */
@@ -0,0 +1,286 @@
+/************************************************************************************************
+Copyright (c) 2025, Juan Manuel Guariste <juanmaguariste@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** @file leds_blink.c
+ ** @brief Definition of the blink timers on a hashed timer wheel
+ **/
+
+/* === Headers files inclusions =============================================================== */
+
+#include "leds_blink.h"
+#include <string.h>
+
+/* === Macros definitions ====================================================================== */
+
+//! brief LED shift offset to obtain the mask
+#define LEDS_TO_BIT_OFFSET 1
+//! brief Constant with the first bit set to one for generating a mask
+#define FIRST_BIT 1
+//! brief Minimum LED number
+#define MIN_LED 1
+//! brief Mask to obtain the wheel slot of a tick
+#define SLOT_MASK (LEDS_BLINK_SLOTS - 1)
+//! brief Marks the end of the list of timers of a slot
+#define NO_TIMER 0xFF
+
+_Static_assert((LEDS_BLINK_SLOTS & SLOT_MASK) == 0, "LEDS_BLINK_SLOTS must be a power of two");
+_Static_assert(LEDS_WORD_BITS < NO_TIMER, "Timer indexes do not fit in a byte");
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/**
+ * @brief Private function to check that an LED number belongs to the word.
+ *
+ * @param led LED number to check.
+ *
+ * @return true if the LED is between 1 and LEDS_WORD_BITS.
+ */
+static bool isValidLed(uint8_t led);
+
+/**
+ * @brief Private function to link a timer in the slot of its expiry.
+ *
+ * @param blink Blink scheduler.
+ *
+ * @param index Index of the timer.
+ *
+ * @return void
+ */
+static void linkTimer(LedsBlink_t * blink, uint8_t index);
+
+/**
+ * @brief Private function to unlink a timer from the slot of its expiry.
+ *
+ * @param blink Blink scheduler.
+ *
+ * @param index Index of the timer.
+ *
+ * @return void
+ */
+static void unlinkTimer(LedsBlink_t * blink, uint8_t index);
+
+/**
+ * @brief Private function to process the timers of one tick.
+ *
+ * @param blink Blink scheduler.
+ *
+ * @param on Accumulates the LEDs to turn on.
+ *
+ * @param off Accumulates the LEDs to turn off.
+ *
+ * @return void
+ */
+static void processTick(LedsBlink_t * blink, LedsWord_t * on, LedsWord_t * off);
+
+/**
+ * @brief Private function to make the next transition of a timer, without linking it.
+ *
+ * @param blink Blink scheduler.
+ *
+ * @param index Index of the timer.
+ *
+ * @param on Accumulates the LEDs to turn on.
+ *
+ * @param off Accumulates the LEDs to turn off.
+ *
+ * @return true if the timer has more transitions, false if its blinks are over.
+ */
+static bool fireTimer(LedsBlink_t * blink, uint8_t index, LedsWord_t * on, LedsWord_t * off);
+
+/**
+ * @brief Private function to skip the ticks that do not fit in one revolution of the wheel.
+ *
+ * The last processed tick is moved to one revolution before the current time. The timers due
+ * before it jump over their whole periods and make the last transitions they missed, so they
+ * keep their phase without visiting every skipped tick.
+ *
+ * @param blink Blink scheduler.
+ *
+ * @param now Current time in milliseconds.
+ *
+ * @param on Accumulates the LEDs to turn on.
+ *
+ * @param off Accumulates the LEDs to turn off.
+ *
+ * @return void
+ */
+static void skipTicks(LedsBlink_t * blink, uint32_t now, LedsWord_t * on, LedsWord_t * off);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+bool isValidLed(uint8_t led) {
+    return (uint8_t)(led - MIN_LED) < LEDS_WORD_BITS;
+}
+
+void linkTimer(LedsBlink_t * blink, uint8_t index) {
+    uint8_t * head = &blink->slots[blink->timers[index].expiry & SLOT_MASK];
+    blink->timers[index].next = *head;
+    blink->timers[index].active = true;
+    *head = index;
+}
+
+void unlinkTimer(LedsBlink_t * blink, uint8_t index) {
+    uint8_t * link = &blink->slots[blink->timers[index].expiry & SLOT_MASK];
+    while (*link != NO_TIMER) {
+        if (*link == index) {
+            *link = blink->timers[index].next;
+            break;
+        }
+        link = &blink->timers[*link].next;
+    }
+    blink->timers[index].active = false;
+}
+
+void processTick(LedsBlink_t * blink, LedsWord_t * on, LedsWord_t * off) {
+    uint8_t * head = &blink->slots[blink->tick & SLOT_MASK];
+    uint8_t index = *head;
+    *head = NO_TIMER;
+    while (index != NO_TIMER) {
+        LedsBlinkTimer_t * timer = &blink->timers[index];
+        uint8_t next = timer->next;
+        if (timer->expiry != blink->tick) {
+            timer->next = *head;
+            *head = index;
+        } else if (fireTimer(blink, index, on, off)) {
+            linkTimer(blink, index);
+        } else {
+            timer->active = false;
+        }
+        index = next;
+    }
+}
+
+bool fireTimer(LedsBlink_t * blink, uint8_t index, LedsWord_t * on, LedsWord_t * off) {
+    LedsBlinkTimer_t * timer = &blink->timers[index];
+    if (!timer->on) {
+        *on |= (LedsWord_t)FIRST_BIT << index;
+        *off &= ~((LedsWord_t)FIRST_BIT << index);
+        timer->on = true;
+        timer->expiry += timer->onMs;
+        return true;
+    }
+    *off |= (LedsWord_t)FIRST_BIT << index;
+    *on &= ~((LedsWord_t)FIRST_BIT << index);
+    timer->on = false;
+    if (timer->remaining != LEDS_BLINK_FOREVER && --timer->remaining == 0) {
+        return false;
+    }
+    timer->expiry += timer->offMs ? timer->offMs : 1;
+    return true;
+}
+
+void skipTicks(LedsBlink_t * blink, uint32_t now, LedsWord_t * on, LedsWord_t * off) {
+    blink->tick = now - LEDS_BLINK_SLOTS;
+    for (uint8_t index = 0; index < LEDS_WORD_BITS; index++) {
+        LedsBlinkTimer_t * timer = &blink->timers[index];
+        if (!timer->active || (int32_t)(timer->expiry - blink->tick) > 0) {
+            continue;
+        }
+        unlinkTimer(blink, index);
+        /* Every whole period has one turn off, keep at least one for a counted blink to end */
+        uint32_t period = (uint32_t)timer->onMs + (timer->offMs ? timer->offMs : 1);
+        uint32_t periods = (blink->tick - timer->expiry) / period;
+        if (timer->remaining != LEDS_BLINK_FOREVER) {
+            if (periods >= timer->remaining) {
+                periods = timer->remaining - 1u;
+            }
+            timer->remaining -= (uint16_t)periods;
+        }
+        timer->expiry += periods * period;
+        bool running = true;
+        while (running && (int32_t)(timer->expiry - blink->tick) <= 0) {
+            running = fireTimer(blink, index, on, off);
+        }
+        if (running) {
+            linkTimer(blink, index);
+        }
+    }
+}
+
+/* === Public function implementation ========================================================== */
+
+void LedsBlink_init(LedsBlink_t * blink, Leds_t * group, uint8_t word, uint32_t now) {
+    memset(blink, 0, sizeof(*blink));
+    memset(blink->slots, NO_TIMER, sizeof(blink->slots));
+    blink->group = group;
+    blink->word = word;
+    blink->tick = now;
+}
+
+bool LedsBlink_start(LedsBlink_t * blink, uint8_t led, uint16_t onMs, uint16_t offMs,
+                     uint16_t count) {
+    if (!isValidLed(led) || onMs == 0) {
+        return false;
+    }
+    uint8_t index = led - LEDS_TO_BIT_OFFSET;
+    LedsBlinkTimer_t * timer = &blink->timers[index];
+    if (timer->active) {
+        unlinkTimer(blink, index);
+    }
+    timer->onMs = onMs;
+    timer->offMs = offMs;
+    timer->remaining = count;
+    timer->on = false;
+    timer->expiry = blink->tick + 1;
+    linkTimer(blink, index);
+    return true;
+}
+
+void LedsBlink_cancel(LedsBlink_t * blink, uint8_t led) {
+    if (!isValidLed(led)) {
+        return;
+    }
+    uint8_t index = led - LEDS_TO_BIT_OFFSET;
+    if (blink->timers[index].active) {
+        unlinkTimer(blink, index);
+    }
+    blink->timers[index].on = false;
+    LedsGroup_clearWord(blink->group, blink->word, (LedsWord_t)FIRST_BIT << index);
+}
+
+bool LedsBlink_isActive(const LedsBlink_t * blink, uint8_t led) {
+    return isValidLed(led) && blink->timers[led - LEDS_TO_BIT_OFFSET].active;
+}
+
+void LedsBlink_tick(LedsBlink_t * blink, uint32_t now) {
+    LedsWord_t on = 0;
+    LedsWord_t off = 0;
+    if (now - blink->tick > LEDS_BLINK_SLOTS) {
+        skipTicks(blink, now, &on, &off);
+    }
+    while (blink->tick != now) {
+        blink->tick++;
+        processTick(blink, &on, &off);
+    }
+    if (on | off) {
+        LedsGroup_writeWord(blink->group, blink->word, on | off, on);
+    }
+}
+
+/* === End of documentation ==================================================================== */
@@ -0,0 +1,147 @@
+/************************************************************************************************
+Copyright (c) 2025, Juan Manuel Guariste <juanmaguariste@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** @file leds_map.c
+ ** @brief Definition of the remapping of logical LEDs to the board wiring
+ **/
+
+/* === Headers files inclusions =============================================================== */
+
+#include "leds_map.h"
+
+/* === Macros definitions ====================================================================== */
+
+//! brief Port mask of logical LED n if bit b of a byte is set
+#define BIT_TO_PHYSICAL(byte, b, n) (((byte) & (1u << (b))) ? LEDS_MAP_MASK(n) : 0)
+
+//! brief Port mask of the logical LEDs 1 to 8 selected by a byte
+#define LOW_TO_PHYSICAL(byte)                                                                      \
+    (BIT_TO_PHYSICAL(byte, 0, 1) | BIT_TO_PHYSICAL(byte, 1, 2) | BIT_TO_PHYSICAL(byte, 2, 3) |     \
+     BIT_TO_PHYSICAL(byte, 3, 4) | BIT_TO_PHYSICAL(byte, 4, 5) | BIT_TO_PHYSICAL(byte, 5, 6) |     \
+     BIT_TO_PHYSICAL(byte, 6, 7) | BIT_TO_PHYSICAL(byte, 7, 8))
+
+//! brief Port mask of the logical LEDs 9 to 16 selected by a byte
+#define HIGH_TO_PHYSICAL(byte)                                                                     \
+    (BIT_TO_PHYSICAL(byte, 0, 9) | BIT_TO_PHYSICAL(byte, 1, 10) | BIT_TO_PHYSICAL(byte, 2, 11) |   \
+     BIT_TO_PHYSICAL(byte, 3, 12) | BIT_TO_PHYSICAL(byte, 4, 13) | BIT_TO_PHYSICAL(byte, 5, 14) |  \
+     BIT_TO_PHYSICAL(byte, 6, 15) | BIT_TO_PHYSICAL(byte, 7, 16))
+
+//! brief Logical mask of LED n if it is wired to port bit p
+#define LED_ON_BIT(p, n) ((LEDS_MAP_MASK(n) == (1u << (p))) ? (1u << ((n) - 1)) : 0)
+
+//! brief Logical mask of the LED wired to port bit p
+#define BIT_TO_LOGICAL(p)                                                                          \
+    (LED_ON_BIT(p, 1) | LED_ON_BIT(p, 2) | LED_ON_BIT(p, 3) | LED_ON_BIT(p, 4) |                   \
+     LED_ON_BIT(p, 5) | LED_ON_BIT(p, 6) | LED_ON_BIT(p, 7) | LED_ON_BIT(p, 8) |                   \
+     LED_ON_BIT(p, 9) | LED_ON_BIT(p, 10) | LED_ON_BIT(p, 11) | LED_ON_BIT(p, 12) |                \
+     LED_ON_BIT(p, 13) | LED_ON_BIT(p, 14) | LED_ON_BIT(p, 15) | LED_ON_BIT(p, 16))
+
+//! brief Logical mask of the LED wired to port bit p + b if bit b of a byte is set
+#define BIT_TO_LOGICAL_IF(byte, b, p) (((byte) & (1u << (b))) ? BIT_TO_LOGICAL((p) + (b)) : 0)
+
+//! brief Logical mask of the LEDs wired to the port bits of a byte starting at bit p
+#define BYTE_TO_LOGICAL(byte, p)                                                                   \
+    (BIT_TO_LOGICAL_IF(byte, 0, p) | BIT_TO_LOGICAL_IF(byte, 1, p) |                               \
+     BIT_TO_LOGICAL_IF(byte, 2, p) | BIT_TO_LOGICAL_IF(byte, 3, p) |                               \
+     BIT_TO_LOGICAL_IF(byte, 4, p) | BIT_TO_LOGICAL_IF(byte, 5, p) |                               \
+     BIT_TO_LOGICAL_IF(byte, 6, p) | BIT_TO_LOGICAL_IF(byte, 7, p))
+
+//! brief Logical mask of the LEDs wired to the low byte of the port
+#define LOW_TO_LOGICAL(byte) BYTE_TO_LOGICAL(byte, 0)
+//! brief Logical mask of the LEDs wired to the high byte of the port
+#define HIGH_TO_LOGICAL(byte) BYTE_TO_LOGICAL(byte, 8)
+
+//! brief Expands a macro for 4, 16, 64 and 256 consecutive byte values
+#define TABLE_4(F, n)   F(n), F(n + 1), F(n + 2), F(n + 3)
+#define TABLE_16(F, n)  TABLE_4(F, n), TABLE_4(F, n + 4), TABLE_4(F, n + 8), TABLE_4(F, n + 12)
+#define TABLE_64(F, n)                                                                             \
+    TABLE_16(F, n), TABLE_16(F, n + 16), TABLE_16(F, n + 32), TABLE_16(F, n + 48)
+#define TABLE_256(F)    TABLE_64(F, 0), TABLE_64(F, 64), TABLE_64(F, 128), TABLE_64(F, 192)
+
+//! brief Byte mask used to split a mask for the table lookups
+#define BYTE_MASK 0xFF
+//! brief Shift of the high byte of a mask
+#define HIGH_BYTE_SHIFT 8
+
+_Static_assert((LOW_TO_PHYSICAL(0xFF) | HIGH_TO_PHYSICAL(0xFF)) == 0xFFFF,
+               "Every port bit must be wired to exactly one logical LED in leds_board.h");
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+//! @brief Private permutation table from logical LEDs 1 to 8 to port bits
+static const uint16_t lowToPhysical[256] = {TABLE_256(LOW_TO_PHYSICAL)};
+
+//! @brief Private permutation table from logical LEDs 9 to 16 to port bits
+static const uint16_t highToPhysical[256] = {TABLE_256(HIGH_TO_PHYSICAL)};
+
+//! @brief Private permutation table from port bits 0 to 7 to logical LEDs
+static const uint16_t lowToLogical[256] = {TABLE_256(LOW_TO_LOGICAL)};
+
+//! @brief Private permutation table from port bits 8 to 15 to logical LEDs
+static const uint16_t highToLogical[256] = {TABLE_256(HIGH_TO_LOGICAL)};
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+/* === Public function implementation ========================================================== */
+
+uint16_t LedsMap_toPhysical(uint16_t logical) {
+    return lowToPhysical[logical & BYTE_MASK] | highToPhysical[logical >> HIGH_BYTE_SHIFT];
+}
+
+uint16_t LedsMap_toLogical(uint16_t physical) {
+    return lowToLogical[physical & BYTE_MASK] | highToLogical[physical >> HIGH_BYTE_SHIFT];
+}
+
+void LedsMap_init(Leds_t * group, uint16_t * address) {
+    LedsGroup_init(group, address);
+    LedsGroup_setMask(group, LEDS_MAP_ACTIVE_LOW);
+}
+
+void LedsMap_setMask(Leds_t * group, uint16_t mask) {
+    LedsGroup_writeMasked(group, LedsMap_toPhysical(mask), (uint16_t)~LEDS_MAP_ACTIVE_LOW);
+}
+
+void LedsMap_clearMask(Leds_t * group, uint16_t mask) {
+    LedsGroup_writeMasked(group, LedsMap_toPhysical(mask), LEDS_MAP_ACTIVE_LOW);
+}
+
+void LedsMap_toggleMask(Leds_t * group, uint16_t mask) {
+    LedsGroup_toggleMask(group, LedsMap_toPhysical(mask));
+}
+
+void LedsMap_writeMasked(Leds_t * group, uint16_t mask, uint16_t value) {
+    LedsGroup_writeMasked(group, LedsMap_toPhysical(mask),
+                          LedsMap_toPhysical(value) ^ LEDS_MAP_ACTIVE_LOW);
+}
+
+uint16_t LedsMap_getAll(Leds_t * group) {
+    return LedsMap_toLogical(LedsGroup_getAll(group) ^ LEDS_MAP_ACTIVE_LOW);
+}
+
+/* === End of documentation ==================================================================== */
@@ -0,0 +1,174 @@
+/************************************************************************************************
+Copyright (c) 2025, Juan Manuel Guariste <juanmaguariste@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** @file leds_pwm.c
+ ** @brief Definition of the brightness control of LEDs by bit-angle modulation (BAM)
+ **/
+
+/* === Headers files inclusions =============================================================== */
+
+#include "leds_pwm.h"
+#include <string.h>
+
+/* === Macros definitions ====================================================================== */
+
+//! brief LED shift offset to obtain the mask
+#define LEDS_TO_BIT_OFFSET 1
+//! brief Constant with the first bit set to one for generating a mask
+#define FIRST_BIT 1
+//! brief Minimum LED number
+#define MIN_LED 1
+//! brief Last bit plane, shown before wrapping around to plane 0
+#define LAST_PLANE (LEDS_PWM_BITS - 1)
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+/**
+ * @brief Gamma correction table (gamma 2.2), converts a perceived level into an on time.
+ *
+ * Generated with round(255 * (level / 255) ^ 2.2).
+ */
+// clang-format off
+static const uint8_t gammaTable[256] = {
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   //
+    1,   1,   1,   1,   1,   1,   1,   1,   1,   2,   2,   2,   2,   2,   2,   2,   //
+    3,   3,   3,   3,   3,   4,   4,   4,   4,   5,   5,   5,   5,   6,   6,   6,   //
+    6,   7,   7,   7,   8,   8,   8,   9,   9,   9,   10,  10,  11,  11,  11,  12,  //
+    12,  13,  13,  13,  14,  14,  15,  15,  16,  16,  17,  17,  18,  18,  19,  19,  //
+    20,  20,  21,  22,  22,  23,  23,  24,  25,  25,  26,  26,  27,  28,  28,  29,  //
+    30,  30,  31,  32,  33,  33,  34,  35,  35,  36,  37,  38,  39,  39,  40,  41,  //
+    42,  43,  43,  44,  45,  46,  47,  48,  49,  49,  50,  51,  52,  53,  54,  55,  //
+    56,  57,  58,  59,  60,  61,  62,  63,  64,  65,  66,  67,  68,  69,  70,  71,  //
+    73,  74,  75,  76,  77,  78,  79,  81,  82,  83,  84,  85,  87,  88,  89,  90,  //
+    91,  93,  94,  95,  97,  98,  99,  100, 102, 103, 105, 106, 107, 109, 110, 111,
+    113, 114, 116, 117, 119, 120, 121, 123, 124, 126, 127, 129, 130, 132, 133, 135,
+    137, 138, 140, 141, 143, 145, 146, 148, 149, 151, 153, 154, 156, 158, 159, 161,
+    163, 165, 166, 168, 170, 172, 173, 175, 177, 179, 181, 182, 184, 186, 188, 190,
+    192, 194, 196, 197, 199, 201, 203, 205, 207, 209, 211, 213, 215, 217, 219, 221,
+    223, 225, 227, 229, 231, 234, 236, 238, 240, 242, 244, 246, 248, 251, 253, 255,
+};
+// clang-format on
+
+/* === Private function declarations =========================================================== */
+
+/**
+ * @brief Private function to check that an LED number belongs to the word.
+ *
+ * @param led LED number to check.
+ *
+ * @return true if the LED is between 1 and LEDS_WORD_BITS.
+ */
+static bool isValidLed(uint8_t led);
+
+/**
+ * @brief Private function to convert an LED number into a bit mask inside the word.
+ *
+ * @param led LED number for which the bit mask is needed.
+ *
+ * @return Bit mask with a 1 in the position corresponding to the LED.
+ */
+static LedsWord_t ledToMask(uint8_t led);
+
+/**
+ * @brief Private function to store the on time of a LED in every bit plane.
+ *
+ * @param pwm Brightness engine.
+ *
+ * @param mask Bit mask of the LED.
+ *
+ * @param onTime On time of the LED, in ticks per frame.
+ *
+ * @return void
+ */
+static void updatePlanes(LedsPwm_t * pwm, LedsWord_t mask, uint8_t onTime);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+bool isValidLed(uint8_t led) {
+    return (uint8_t)(led - MIN_LED) < LEDS_WORD_BITS;
+}
+
+LedsWord_t ledToMask(uint8_t led) {
+    return ((LedsWord_t)FIRST_BIT << (led - LEDS_TO_BIT_OFFSET));
+}
+
+void updatePlanes(LedsPwm_t * pwm, LedsWord_t mask, uint8_t onTime) {
+    for (uint8_t plane = 0; plane < LEDS_PWM_BITS; plane++) {
+        if (onTime & (FIRST_BIT << plane)) {
+            pwm->planes[plane] |= mask;
+        } else {
+            pwm->planes[plane] &= ~mask;
+        }
+    }
+}
+
+/* === Public function implementation ========================================================== */
+
+void LedsPwm_init(LedsPwm_t * pwm, Leds_t * group, uint8_t word) {
+    memset(pwm, 0, sizeof(*pwm));
+    pwm->group = group;
+    pwm->word = word;
+    pwm->plane = LAST_PLANE;
+    pwm->remaining = 1;
+}
+
+void LedsPwm_setLevel(LedsPwm_t * pwm, uint8_t led, uint8_t level) {
+    if (!isValidLed(led)) {
+        return;
+    }
+    pwm->levels[led - LEDS_TO_BIT_OFFSET] = level;
+    updatePlanes(pwm, ledToMask(led), gammaTable[level]);
+    pwm->mask |= ledToMask(led);
+}
+
+uint8_t LedsPwm_getLevel(const LedsPwm_t * pwm, uint8_t led) {
+    if (!isValidLed(led)) {
+        return 0;
+    }
+    return pwm->levels[led - LEDS_TO_BIT_OFFSET];
+}
+
+void LedsPwm_release(LedsPwm_t * pwm, uint8_t led) {
+    if (!isValidLed(led)) {
+        return;
+    }
+    pwm->mask &= ~ledToMask(led);
+    pwm->levels[led - LEDS_TO_BIT_OFFSET] = 0;
+    updatePlanes(pwm, ledToMask(led), 0);
+    LedsGroup_clearWord(pwm->group, pwm->word, ledToMask(led));
+}
+
+void LedsPwm_tick(LedsPwm_t * pwm) {
+    if (--pwm->remaining) {
+        return;
+    }
+    pwm->plane = (pwm->plane == LAST_PLANE) ? 0 : pwm->plane + 1;
+    pwm->remaining = FIRST_BIT << pwm->plane;
+    LedsGroup_writeWord(pwm->group, pwm->word, pwm->mask, pwm->planes[pwm->plane]);
+}
+
+/* === End of documentation ==================================================================== */
@@ -0,0 +1,202 @@
+/************************************************************************************************
+Copyright (c) 2025, Juan Manuel Guariste <juanmaguariste@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** @file leds_sequencer.c
+ ** @brief Definition of the playback of precompiled LED animations
+ **/
+
+/* === Headers files inclusions =============================================================== */
+
+#include "leds_sequencer.h"
+#include <stddef.h>
+#include <string.h>
+
+/* === Macros definitions ====================================================================== */
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/**
+ * @brief Private function to check that a time has been reached, with wrap-around.
+ *
+ * @param now Current time in milliseconds.
+ *
+ * @param time Time to check.
+ *
+ * @return true if now is at or after time.
+ */
+static bool timeReached(uint32_t now, uint32_t time);
+
+/**
+ * @brief Private function to move a layer to the frame that must be shown at a given time.
+ *
+ * Once a looping layer has stepped a whole loop and is still late, the remaining whole loops are
+ * skipped at once, so a call after a long stall steps at most two loops.
+ *
+ * @param layer Layer to advance.
+ *
+ * @param now Current time in milliseconds.
+ *
+ * @return true if the layer changed frame or finished.
+ */
+static bool advanceLayer(LedsSeqLayer_t * layer, uint32_t now);
+
+/**
+ * @brief Private function to combine the layers and write the result with a single port write.
+ *
+ * @param seq Sequencer.
+ *
+ * @return void
+ */
+static void writeLayers(LedsSeq_t * seq);
+
+/**
+ * @brief Private function to find the nearest frame change of the playing layers.
+ *
+ * @param seq Sequencer.
+ *
+ * @param now Current time in milliseconds.
+ *
+ * @return void
+ */
+static void scheduleNextChange(LedsSeq_t * seq, uint32_t now);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+bool timeReached(uint32_t now, uint32_t time) {
+    return (int32_t)(now - time) >= 0;
+}
+
+bool advanceLayer(LedsSeqLayer_t * layer, uint32_t now) {
+    bool changed = false;
+    uint16_t steps = 0;
+    uint32_t loopMs = 0;
+    while (layer->animation != NULL) {
+        uint16_t duration = layer->animation->frames[layer->frame].durationMs;
+        if (duration == 0 || !timeReached(now, layer->frameStart + duration)) {
+            break;
+        }
+        changed = true;
+        layer->frameStart += duration;
+        loopMs += duration;
+        if (++steps == layer->animation->count) {
+            /* Every frame was stepped once, so loopMs is the length of the loop */
+            uint32_t late = now - layer->frameStart;
+            layer->frameStart += late - late % loopMs;
+        }
+        if (++layer->frame == layer->animation->count) {
+            if (layer->animation->loop) {
+                layer->frame = 0;
+            } else {
+                layer->animation = NULL;
+            }
+        }
+    }
+    return changed;
+}
+
+void writeLayers(LedsSeq_t * seq) {
+    LedsWord_t owned = 0;
+    LedsWord_t value = 0;
+    for (uint8_t index = 0; index < LEDS_SEQ_LAYERS; index++) {
+        const LedsSeqLayer_t * layer = &seq->layers[index];
+        if (layer->animation != NULL) {
+            LedsWord_t mask = layer->animation->mask;
+            value = (value & ~mask) | (layer->animation->frames[layer->frame].leds & mask);
+            owned |= mask;
+        }
+    }
+    LedsGroup_writeWord(seq->group, seq->word, owned | seq->owned, value);
+    seq->owned = owned;
+}
+
+void scheduleNextChange(LedsSeq_t * seq, uint32_t now) {
+    uint32_t nearest = UINT32_MAX;
+    seq->pending = false;
+    for (uint8_t index = 0; index < LEDS_SEQ_LAYERS; index++) {
+        const LedsSeqLayer_t * layer = &seq->layers[index];
+        if (layer->animation != NULL && layer->animation->frames[layer->frame].durationMs) {
+            uint32_t end = layer->frameStart + layer->animation->frames[layer->frame].durationMs;
+            uint32_t remaining = timeReached(now, end) ? 0 : end - now;
+            if (remaining < nearest) {
+                nearest = remaining;
+            }
+            seq->pending = true;
+        }
+    }
+    seq->nextChange = now + nearest;
+}
+
+/* === Public function implementation ========================================================== */
+
+void LedsSeq_init(LedsSeq_t * seq, Leds_t * group, uint8_t word) {
+    memset(seq, 0, sizeof(*seq));
+    seq->group = group;
+    seq->word = word;
+}
+
+bool LedsSeq_play(LedsSeq_t * seq, uint8_t layer, const LedsAnimation_t * animation, uint32_t now) {
+    if (layer >= LEDS_SEQ_LAYERS || animation == NULL || animation->frames == NULL ||
+        animation->count == 0) {
+        return false;
+    }
+    seq->layers[layer].animation = animation;
+    seq->layers[layer].frame = 0;
+    seq->layers[layer].frameStart = now;
+    writeLayers(seq);
+    scheduleNextChange(seq, now);
+    return true;
+}
+
+void LedsSeq_stop(LedsSeq_t * seq, uint8_t layer) {
+    if (layer >= LEDS_SEQ_LAYERS || seq->layers[layer].animation == NULL) {
+        return;
+    }
+    seq->layers[layer].animation = NULL;
+    writeLayers(seq);
+}
+
+bool LedsSeq_isPlaying(const LedsSeq_t * seq, uint8_t layer) {
+    return layer < LEDS_SEQ_LAYERS && seq->layers[layer].animation != NULL;
+}
+
+void LedsSeq_tick(LedsSeq_t * seq, uint32_t now) {
+    if (!seq->pending || !timeReached(now, seq->nextChange)) {
+        return;
+    }
+    bool changed = false;
+    for (uint8_t index = 0; index < LEDS_SEQ_LAYERS; index++) {
+        changed |= advanceLayer(&seq->layers[index], now);
+    }
+    if (changed) {
+        writeLayers(seq);
+    }
+    scheduleNextChange(seq, now);
+}
+
+/* === End of documentation ==================================================================== */
@@ -26,24 +26,155 @@ SPDX-License-Identifier: MIT
 /* === Headers files inclusions =============================================================== */
 
 #include "main.h"
+#include "leds.h"
+#include "leds_blink.h"
+#include "scheduler.h"
+#include "telemetry.h"
+#include <stdio.h>
+#include <time.h>
 
 /* === Macros definitions ====================================================================== */
 
+//! Period of the control loop, in milliseconds
+#define CONTROL_PERIOD_MS 10
+
+//! Time budget of the control loop, in microseconds
+#define CONTROL_BUDGET_US 2000
+
+//! Period of the LED blink timers, in milliseconds
+#define BLINK_PERIOD_MS 1
+
+//! Time budget of the LED blink timers, one port write per tick
+#define BLINK_BUDGET_US 100
+
+#if TELEMETRY_ENABLED
+//! Period of the telemetry drain, in milliseconds
+#define TELEMETRY_PERIOD_MS 20
+
+//! Frames read from the ring and written to the standard output at once
+#define TELEMETRY_CHUNK_FRAMES 4
+
+//! Time budget of the telemetry drain, in microseconds
+#define TELEMETRY_BUDGET_US 400
+
+//! Worst case of writing one chunk to the standard output, in microseconds
+#define TELEMETRY_CHUNK_COST_US 200
+#endif
+
 /* === Private data type declarations ========================================================== */
 
 /* === Private variable declarations =========================================================== */
 
 /* === Private function declarations =========================================================== */
 
+/**
+ * @brief Millisecond tick source of the host, from the monotonic clock.
+ *
+ * @return uint32_t Time in milliseconds.
+ */
+static uint32_t hostMillis(void);
+
+/**
+ * @brief Microsecond counter of the host, from the monotonic clock.
+ *
+ * @return uint32_t Time in microseconds.
+ */
+static uint32_t hostMicros(void);
+
+/**
+ * @brief Control loop of the application, it has the highest priority.
+ *
+ * @param context Not used.
+ */
+static void controlTask(void * context);
+
+/**
+ * @brief Advances the LED blink timers, it writes the port at most once.
+ *
+ * @param context Pointer to the blink timers.
+ */
+static void blinkTask(void * context);
+
+#if TELEMETRY_ENABLED
+/**
+ * @brief Writes the queued telemetry frames to the standard output while they fit in the budget.
+ *
+ * It is added before the blink timers: their 1 ms period would never leave it any budget, and
+ * a late blink tick only shifts the next toggle. Pipe the application to tools/telemetry_view.c
+ * to see the LEDs on the terminal.
+ *
+ * @param context Not used.
+ */
+static void telemetryTask(void * context);
+#endif
+
 /* === Public variable definitions ============================================================= */
 
 /* === Private variable definitions ============================================================ */
 
+//! Port where the LEDs are connected, a variable on the host
+static uint16_t ledsPort;
+
+//! Blink timers of the LEDs
+static LedsBlink_t blink;
+
 /* === Private function implementation ========================================================= */
 
+uint32_t hostMillis(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32_t)(now.tv_sec * 1000 + now.tv_nsec / 1000000);
+}
+
+uint32_t hostMicros(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32_t)(now.tv_sec * 1000000 + now.tv_nsec / 1000);
+}
+
+void controlTask(void * context) {
+    (void)context;
+}
+
+void blinkTask(void * context) {
+    LedsBlink_tick(context, hostMillis());
+}
+
+#if TELEMETRY_ENABLED
+void telemetryTask(void * context) {
+    uint8_t chunk[TELEMETRY_CHUNK_FRAMES * TELEMETRY_FRAME_SIZE];
+    uint16_t length;
+    (void)context;
+    while (Scheduler_hasBudget(TELEMETRY_CHUNK_COST_US) &&
+           (length = Telemetry_read(chunk, sizeof(chunk))) > 0) {
+        fwrite(chunk, 1, length, stdout);
+    }
+    fflush(stdout);
+}
+#endif
+
 /* === Public function implementation ========================================================== */
 
 int main(void) {
+#if TELEMETRY_ENABLED
+    /* The ring must be ready before the drivers report their first changes */
+    Telemetry_init();
+#endif
+    Leds_init(&ledsPort);
+    Scheduler_init(hostMillis, hostMicros);
+    LedsBlink_init(&blink, Leds_getDefault(), 0, hostMillis());
+    LedsBlink_start(&blink, 1, 500, 500, LEDS_BLINK_FOREVER);
+
+    Scheduler_addTask(controlTask, NULL, CONTROL_PERIOD_MS, 0, CONTROL_BUDGET_US);
+#if TELEMETRY_ENABLED
+    Scheduler_addTask(telemetryTask, NULL, TELEMETRY_PERIOD_MS, 0, TELEMETRY_BUDGET_US);
+#endif
+    Scheduler_addTask(blinkTask, &blink, BLINK_PERIOD_MS, 0, BLINK_BUDGET_US);
+
+    while (true) {
+        Scheduler_dispatch();
+    }
+    return 0;
 }
 
 /* === End of documentation ==================================================================== */
\ No newline at end of file
@@ -0,0 +1,146 @@
+/************************************************************************************************
+Copyright (c) 2025, Juan Manuel Guariste <juanmaguariste@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** @file leds_spi_host.c
+ ** @brief Definition of the host fake of the SPI with DMA
+ **/
+
+/* === Headers files inclusions =============================================================== */
+
+#include "leds_spi_host.h"
+#include <stddef.h>
+#include <string.h>
+
+/* === Macros definitions ====================================================================== */
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+//! @brief Private copy of the content of the simulated shift registers
+static uint8_t shiftRegisters[LEDS_SPI_HOST_MAX_REGISTERS];
+
+//! @brief Private copy of the latched outputs of the simulated shift registers
+static uint8_t outputs[LEDS_SPI_HOST_MAX_REGISTERS];
+
+//! @brief Private description of the transfer in progress, data is NULL if there is none
+static struct {
+    const uint8_t * data;
+    uint16_t length;
+    LedsSpiDone_t done;
+    void * context;
+} transfer;
+
+//! @brief Private counters of the activity on the simulated bus
+static uint32_t transfers, bytes, latches;
+
+/* === Private function declarations =========================================================== */
+
+/**
+ * @brief Private function to shift one byte into the simulated chain, most significant bit first.
+ *
+ * The byte enters the register connected to the microcontroller and the content of every
+ * register moves to the next one, the last register loses its content.
+ *
+ * @param value Byte to shift.
+ *
+ * @return void
+ */
+static void shiftByte(uint8_t value);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+void shiftByte(uint8_t value) {
+    memmove(&shiftRegisters[1], &shiftRegisters[0], sizeof(shiftRegisters) - 1);
+    shiftRegisters[0] = value;
+}
+
+/* === Public function implementation ========================================================== */
+
+bool LedsSpi_startTransfer(const uint8_t * data, uint16_t length, LedsSpiDone_t done,
+                           void * context) {
+    if (transfer.data != NULL) {
+        return false;
+    }
+    transfer.data = data;
+    transfer.length = length;
+    transfer.done = done;
+    transfer.context = context;
+    transfers++;
+    bytes += length;
+    return true;
+}
+
+void LedsSpi_latch(void) {
+    memcpy(outputs, shiftRegisters, sizeof(outputs));
+    latches++;
+}
+
+void LedsSpiHost_reset(void) {
+    memset(shiftRegisters, 0, sizeof(shiftRegisters));
+    memset(outputs, 0, sizeof(outputs));
+    memset(&transfer, 0, sizeof(transfer));
+    transfers = 0;
+    bytes = 0;
+    latches = 0;
+}
+
+bool LedsSpiHost_completeTransfer(void) {
+    if (transfer.data == NULL) {
+        return false;
+    }
+    for (uint16_t index = 0; index < transfer.length; index++) {
+        shiftByte(transfer.data[index]);
+    }
+    LedsSpiDone_t done = transfer.done;
+    void * context = transfer.context;
+    transfer.data = NULL;
+    if (done != NULL) {
+        done(context);
+    }
+    return true;
+}
+
+bool LedsSpiHost_isBusy(void) {
+    return transfer.data != NULL;
+}
+
+uint8_t LedsSpiHost_getOutputs(uint8_t reg) {
+    return (reg < LEDS_SPI_HOST_MAX_REGISTERS) ? outputs[reg] : 0;
+}
+
+uint32_t LedsSpiHost_getTransfers(void) {
+    return transfers;
+}
+
+uint32_t LedsSpiHost_getBytes(void) {
+    return bytes;
+}
+
+uint32_t LedsSpiHost_getLatches(void) {
+    return latches;
+}
+
+/* === End of documentation ==================================================================== */
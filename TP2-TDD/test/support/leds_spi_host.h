@@ -0,0 +1,109 @@
+/************************************************************************************************
+Copyright (c) 2025, Juan Manuel Guariste <juanmaguariste@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef LEDS_SPI_HOST_H
+#define LEDS_SPI_HOST_H
+
+/** @file leds_spi_host.h
+ ** @brief Host fake of the SPI with DMA, simulating a chain of 74HC595 shift registers
+ **/
+
+/* === Headers files inclusions ================================================================ */
+#include "leds_spi.h"
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+
+//! Maximum number of shift registers simulated in the chain
+#define LEDS_SPI_HOST_MAX_REGISTERS 64
+
+/* === Public data type declarations =========================================================== */
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+
+/**
+ * @brief Resets the fake: clears the simulated chain, its outputs and the counters.
+ *
+ * @return void
+ */
+void LedsSpiHost_reset(void);
+
+/**
+ * @brief Ends the transfer in progress, as the DMA complete interrupt would.
+ *
+ * The bytes of the transfer are shifted into the simulated chain and the done function of the
+ * transfer is called.
+ *
+ * @return true if a transfer was in progress, false otherwise.
+ */
+bool LedsSpiHost_completeTransfer(void);
+
+/**
+ * @brief Checks if a transfer is in progress.
+ *
+ * @return true if a transfer was started and not completed yet.
+ */
+bool LedsSpiHost_isBusy(void);
+
+/**
+ * @brief Reads the latched outputs of a register of the simulated chain.
+ *
+ * @param reg Register position, 0 is the one connected to the microcontroller.
+ *
+ * @return uint8_t Outputs of the register, bit 0 is QA.
+ */
+uint8_t LedsSpiHost_getOutputs(uint8_t reg);
+
+/**
+ * @brief Returns the number of transfers started since the last reset.
+ *
+ * @return uint32_t Number of transfers.
+ */
+uint32_t LedsSpiHost_getTransfers(void);
+
+/**
+ * @brief Returns the number of bytes sent since the last reset.
+ *
+ * @return uint32_t Number of bytes.
+ */
+uint32_t LedsSpiHost_getBytes(void);
+
+/**
+ * @brief Returns the number of latch pulses since the last reset.
+ *
+ * @return uint32_t Number of latch pulses.
+ */
+uint32_t LedsSpiHost_getLatches(void);
+
+/* === End of documentation ==================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LEDS_SPI_HOST_H */
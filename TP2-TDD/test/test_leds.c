@@ -159,4 +159,41 @@ void test_above_upper_limit_led_parameters(void) {
     TEST_ASSERT_EQUAL_HEX16(0x0000, virtualLeds);
 }
 
+//! @test Turn on several LEDs at once with a mask.
+void test_set_mask(void) {
+    Leds_turnOnSingle(1);
+    Leds_setMask(0x0300);
+    TEST_ASSERT_EQUAL_HEX16(0x0301, virtualLeds);
+}
+
+//! @test Turn off several LEDs at once with a mask.
+void test_clear_mask(void) {
+    Leds_turnOnAllLeds();
+    Leds_clearMask(0x00F0);
+    TEST_ASSERT_EQUAL_HEX16(0xFF0F, virtualLeds);
+}
+
+//! @test Toggle several LEDs at once with a mask.
+void test_toggle_mask(void) {
+    Leds_setMask(0x000F);
+    Leds_toggleMask(0x0033);
+    TEST_ASSERT_EQUAL_HEX16(0x003C, virtualLeds);
+}
+
+//! @test Write only the LEDs selected by a mask.
+void test_write_masked(void) {
+    Leds_setMask(0xF00F);
+    Leds_writeMasked(0x0FF0, 0xFA5F);
+    TEST_ASSERT_EQUAL_HEX16(0xFA5F, virtualLeds);
+    Leds_writeMasked(0x000F, 0x0000);
+    TEST_ASSERT_EQUAL_HEX16(0xFA50, virtualLeds);
+}
+
+//! @test Read the state of all LEDs at once.
+void test_get_all(void) {
+    Leds_turnOnSingle(3);
+    Leds_turnOnSingle(16);
+    TEST_ASSERT_EQUAL_HEX16(0x8004, Leds_getAll());
+}
+
 /* === End of documentation ==================================================================== */
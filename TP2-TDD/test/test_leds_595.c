@@ -0,0 +1,151 @@
+/************************************************************************************************
+Copyright (c) 2025, Juan Manuel Guariste <juanmaguariste@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** @file test_leds_595.c
+ ** @brief Unitary tests for the LED backend for chains of 74HC595 shift registers.
+ **/
+
+/* === Headers files inclusions ===============================================================
+ */
+#include "unity.h"
+#include "leds_595.h"
+#include "leds_spi_host.h"
+#include "leds.h"
+
+/* === Macros definitions ======================================================================
+ */
+
+//! Number of registers of the test chain, odd to use half of the last port word
+#define CHAIN_REGISTERS 5
+
+/* === Private data type declarations ==========================================================
+ */
+
+/* === Private variable declarations ===========================================================
+ */
+static Leds595_t chain;
+static Leds_t panel;
+
+/* === Private function declarations ===========================================================
+ */
+
+/* === Public variable definitions =============================================================
+ */
+
+/* === Private variable definitions ============================================================
+ */
+
+/* === Private function implementation =========================================================
+ */
+
+/**
+ * @brief Sends a frame if needed and completes its transfer, as the DMA would.
+ *
+ * @return true if a frame was sent.
+ */
+static bool updateAndComplete(void) {
+    bool started = Leds595_update(&chain);
+    if (started) {
+        LedsSpiHost_completeTransfer();
+    }
+    return started;
+}
+
+/* === Public function implementation ==========================================================
+ */
+
+void setUp(void) {
+    LedsSpiHost_reset();
+    TEST_ASSERT_TRUE(Leds595_init(&chain, &panel, CHAIN_REGISTERS));
+}
+
+//! @test The first update must send a frame with every LED off.
+void test_first_update_clears_the_chain(void) {
+    TEST_ASSERT_EQUAL(CHAIN_REGISTERS * 8, LedsGroup_getCount(&panel));
+    TEST_ASSERT_TRUE(updateAndComplete());
+    TEST_ASSERT_EQUAL(1, LedsSpiHost_getTransfers());
+    TEST_ASSERT_EQUAL(CHAIN_REGISTERS, LedsSpiHost_getBytes());
+    TEST_ASSERT_EQUAL(1, LedsSpiHost_getLatches());
+    for (uint8_t reg = 0; reg < CHAIN_REGISTERS; reg++) {
+        TEST_ASSERT_EQUAL_HEX8(0x00, LedsSpiHost_getOutputs(reg));
+    }
+}
+
+//! @test Every LED must end up on its output of its register.
+void test_leds_map_to_register_outputs(void) {
+    updateAndComplete();
+    LedsGroup_turnOnSingle(&panel, 1);
+    LedsGroup_turnOnSingle(&panel, 16);
+    LedsGroup_turnOnSingle(&panel, 19);
+    LedsGroup_turnOnSingle(&panel, 40);
+    TEST_ASSERT_TRUE(updateAndComplete());
+    TEST_ASSERT_EQUAL_HEX8(0x01, LedsSpiHost_getOutputs(0));
+    TEST_ASSERT_EQUAL_HEX8(0x80, LedsSpiHost_getOutputs(1));
+    TEST_ASSERT_EQUAL_HEX8(0x04, LedsSpiHost_getOutputs(2));
+    TEST_ASSERT_EQUAL_HEX8(0x00, LedsSpiHost_getOutputs(3));
+    TEST_ASSERT_EQUAL_HEX8(0x80, LedsSpiHost_getOutputs(4));
+}
+
+//! @test No frame must be sent when the LEDs did not change.
+void test_no_frame_without_changes(void) {
+    updateAndComplete();
+    TEST_ASSERT_FALSE(updateAndComplete());
+    LedsGroup_turnOnSingle(&panel, 3);
+    LedsGroup_turnOffSingle(&panel, 3);
+    TEST_ASSERT_FALSE(updateAndComplete());
+    TEST_ASSERT_EQUAL(1, Leds595_getFrames(&chain));
+    TEST_ASSERT_EQUAL(1, LedsSpiHost_getTransfers());
+}
+
+//! @test Changes made while a frame is in flight must go in the next frame.
+void test_changes_during_a_transfer(void) {
+    updateAndComplete();
+    LedsGroup_turnOnSingle(&panel, 2);
+    TEST_ASSERT_TRUE(Leds595_update(&chain));
+    LedsGroup_turnOnSingle(&panel, 9);
+    TEST_ASSERT_FALSE(Leds595_update(&chain));
+    LedsSpiHost_completeTransfer();
+    TEST_ASSERT_EQUAL_HEX8(0x02, LedsSpiHost_getOutputs(0));
+    TEST_ASSERT_EQUAL_HEX8(0x00, LedsSpiHost_getOutputs(1));
+    TEST_ASSERT_TRUE(updateAndComplete());
+    TEST_ASSERT_EQUAL_HEX8(0x01, LedsSpiHost_getOutputs(1));
+}
+
+//! @test The outputs must only change when the frame is latched.
+void test_outputs_change_on_latch(void) {
+    updateAndComplete();
+    LedsGroup_turnOnAllLeds(&panel);
+    Leds595_update(&chain);
+    TEST_ASSERT_EQUAL_HEX8(0x00, LedsSpiHost_getOutputs(0));
+    TEST_ASSERT_TRUE(LedsSpiHost_isBusy());
+    LedsSpiHost_completeTransfer();
+    TEST_ASSERT_EQUAL_HEX8(0xFF, LedsSpiHost_getOutputs(0));
+    TEST_ASSERT_EQUAL_HEX8(0xFF, LedsSpiHost_getOutputs(CHAIN_REGISTERS - 1));
+    TEST_ASSERT_EQUAL_HEX8(0x00, LedsSpiHost_getOutputs(CHAIN_REGISTERS));
+}
+
+//! @test Invalid chain lengths must be rejected.
+void test_invalid_chain_length(void) {
+    TEST_ASSERT_FALSE(Leds595_init(&chain, &panel, 0));
+    TEST_ASSERT_FALSE(Leds595_init(&chain, &panel, LEDS_595_MAX_REGISTERS + 1));
+}
+
+/* === End of documentation ==================================================================== */
@@ -0,0 +1,151 @@
+/************************************************************************************************
+Copyright (c) 2025, Juan Manuel Guariste <juanmaguariste@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** @file test_leds_atomic.c
+ ** @brief Unitary tests for the atomic (shadow mode) update path of the leds module.
+ **/
+
+/* === Headers files inclusions ===============================================================
+ */
+#include "unity.h"
+#include "leds.h"
+#include <pthread.h>
+#include <sched.h>
+
+/* === Macros definitions ======================================================================
+ */
+
+//! Number of threads updating the LEDs concurrently
+#define HAMMER_THREADS 8
+//! Number of updates done by each thread
+#define HAMMER_ITERATIONS 50000
+
+/* === Private data type declarations ==========================================================
+ */
+
+/* === Private variable declarations ===========================================================
+ */
+static uint16_t virtualLeds = 0xFFFF;
+static volatile uint32_t virtualSetReset;
+
+//! Number of times a thread saw its own LED in a state it did not write
+static volatile uint32_t lostUpdates;
+
+/* === Private function declarations ===========================================================
+ */
+
+/* === Public variable definitions =============================================================
+ */
+
+/* === Private variable definitions ============================================================
+ */
+
+/* === Private function implementation =========================================================
+ */
+
+/**
+ * @brief Thread that keeps switching its own LED and checks that no other thread undoes it.
+ *
+ * @param arg LED number owned by the thread.
+ */
+static void * hammerThread(void * arg) {
+    uint8_t led = (uint8_t)(uintptr_t)arg;
+    for (uint32_t iteration = 0; iteration < HAMMER_ITERATIONS; iteration++) {
+        Leds_turnOnSingle(led);
+        if (!Leds_isLedTurnedOn(led)) {
+            lostUpdates++;
+        }
+        Leds_toggleMask(1 << (led - 1));
+        if (!Leds_isLedTurnedOff(led)) {
+            lostUpdates++;
+        }
+        if ((iteration & 0xFF) == 0) {
+            sched_yield();
+        }
+    }
+    if (led % 2) {
+        Leds_setMask(1 << (led - 1));
+    }
+    return NULL;
+}
+
+/* === Public function implementation ==========================================================
+ */
+
+void setUp(void) {
+    Leds_init(&virtualLeds);
+}
+
+//! @test Concurrent updates from several threads must not lose any change.
+void test_concurrent_updates_are_not_lost(void) {
+    pthread_t threads[HAMMER_THREADS];
+    lostUpdates = 0;
+    for (uintptr_t led = 1; led <= HAMMER_THREADS; led++) {
+        TEST_ASSERT_EQUAL(0, pthread_create(&threads[led - 1], NULL, hammerThread, (void *)led));
+    }
+    for (uint8_t index = 0; index < HAMMER_THREADS; index++) {
+        pthread_join(threads[index], NULL);
+    }
+    TEST_ASSERT_EQUAL(0, lostUpdates);
+    TEST_ASSERT_EQUAL_HEX16(0x0055, Leds_getAll());
+    TEST_ASSERT_EQUAL_HEX16(0x0055, virtualLeds);
+}
+
+//! @test Initializing on a set/reset register must turn all LEDs off through the reset bits.
+void test_set_reset_register_init(void) {
+    Leds_initSetReset(&virtualSetReset);
+    TEST_ASSERT_EQUAL_HEX32(0xFFFF0000, virtualSetReset);
+    TEST_ASSERT_EQUAL_HEX16(0x0000, Leds_getAll());
+}
+
+//! @test Updates on a set/reset register must write only the bits they change.
+void test_set_reset_register_writes_changed_bits_only(void) {
+    Leds_initSetReset(&virtualSetReset);
+    Leds_turnOnSingle(3);
+    TEST_ASSERT_EQUAL_HEX32(0x00000004, virtualSetReset);
+    Leds_setMask(0x0006);
+    TEST_ASSERT_EQUAL_HEX32(0x00000002, virtualSetReset);
+    Leds_writeMasked(0x00FF, 0x00F0);
+    TEST_ASSERT_EQUAL_HEX32(0x000600F0, virtualSetReset);
+    Leds_toggleMask(0x0011);
+    TEST_ASSERT_EQUAL_HEX32(0x00100001, virtualSetReset);
+    TEST_ASSERT_EQUAL_HEX16(0x00E1, Leds_getAll());
+    TEST_ASSERT_EQUAL(true, Leds_isLedTurnedOn(1));
+    TEST_ASSERT_EQUAL(true, Leds_isLedTurnedOff(5));
+}
+
+//! @test A frame committed on a set/reset register must write the whole frame in one access.
+void test_set_reset_register_frame_commit(void) {
+    Leds_initSetReset(&virtualSetReset);
+    Leds_turnOnSingle(1);
+    Leds_setBuffered(true);
+    Leds_turnOffSingle(1);
+    Leds_turnOnSingle(2);
+    Leds_turnOnSingle(3);
+    TEST_ASSERT_EQUAL_HEX32(0x00000001, virtualSetReset);
+    TEST_ASSERT_EQUAL(1, Leds_commit());
+    TEST_ASSERT_EQUAL_HEX32(0x00010006, virtualSetReset);
+    Leds_setBuffered(false);
+    Leds_turnOnSingle(4);
+    TEST_ASSERT_EQUAL_HEX32(0x00000008, virtualSetReset);
+}
+
+/* === End of documentation ==================================================================== */
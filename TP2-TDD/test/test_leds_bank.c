@@ -0,0 +1,194 @@
+/************************************************************************************************
+Copyright (c) 2025, Juan Manuel Guariste <juanmaguariste@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** @file test_leds_bank.c
+ ** @brief Unitary tests for LED banks spread over several ports.
+ **/
+
+/* === Headers files inclusions ===============================================================
+ */
+#include "unity.h"
+#include "leds.h"
+
+/* === Macros definitions ======================================================================
+ */
+
+//! Number of ports in the test bank
+#define BANK_PORTS 5
+
+/* === Private data type declarations ==========================================================
+ */
+
+/* === Private variable declarations ===========================================================
+ */
+static uint16_t virtualPorts[BANK_PORTS] = {0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF};
+
+//! Ports listed out of memory order, as they would be when they belong to different GPIOs
+static uint16_t * const bankPorts[BANK_PORTS] = {
+    &virtualPorts[0], &virtualPorts[2], &virtualPorts[1], &virtualPorts[4], &virtualPorts[3],
+};
+
+static const LedsBank_t bank = {.ports = bankPorts, .count = BANK_PORTS};
+
+/* === Private function declarations ===========================================================
+ */
+
+/* === Public variable definitions =============================================================
+ */
+
+/* === Private variable definitions ============================================================
+ */
+
+/* === Private function implementation =========================================================
+ */
+
+/* === Public function implementation ==========================================================
+ */
+
+void setUp(void) {
+    TEST_ASSERT_TRUE(Leds_initBank(&bank));
+}
+
+//! @test After initialization, all LEDs of every port should be off.
+void test_all_bank_leds_initially_off(void) {
+    for (int port = 0; port < BANK_PORTS; port++) {
+        TEST_ASSERT_EQUAL_HEX16(0x0000, virtualPorts[port]);
+    }
+    TEST_ASSERT_EQUAL(BANK_PORTS * LEDS_PER_PORT, Leds_getCount());
+}
+
+//! @test Invalid bank descriptions must be rejected.
+void test_invalid_banks_are_rejected(void) {
+    LedsBank_t empty = {.ports = bankPorts, .count = 0};
+    LedsBank_t tooLarge = {.ports = bankPorts, .count = LEDS_MAX_PORTS + 1};
+    LedsBank_t tooManyLeds = {.ports = bankPorts, .count = 1, .ledCount = LEDS_PER_PORT + 1};
+    TEST_ASSERT_FALSE(Leds_initBank(NULL));
+    TEST_ASSERT_FALSE(Leds_initBank(&empty));
+    TEST_ASSERT_FALSE(Leds_initBank(&tooLarge));
+    TEST_ASSERT_FALSE(Leds_initBank(&tooManyLeds));
+}
+
+//! @test A bank with its last port partly wired must only drive the LEDs it declares.
+void test_partly_wired_bank_limits_the_leds(void) {
+    LedsBank_t partial = {.ports = bankPorts, .count = BANK_PORTS, .ledCount = 70};
+    TEST_ASSERT_TRUE(Leds_initBank(&partial));
+    TEST_ASSERT_EQUAL(70, Leds_getCount());
+    Leds_turnOnSingle(70);
+    Leds_turnOnSingle(71);
+    TEST_ASSERT_EQUAL_HEX16(0x0020, virtualPorts[3]);
+    TEST_ASSERT_EQUAL(false, Leds_isLedTurnedOn(71));
+}
+
+//! @test Bulk and word operations must leave alone the pins of the last port the bank does not own.
+void test_partly_wired_port_keeps_foreign_pins(void) {
+    LedsBank_t partial = {.ports = bankPorts, .count = BANK_PORTS, .ledCount = 70};
+    uint8_t word = (uint8_t)((BANK_PORTS - 1) * LEDS_PER_PORT / LEDS_WORD_BITS);
+    virtualPorts[3] = 0xA500;
+    TEST_ASSERT_TRUE(Leds_initBank(&partial));
+    TEST_ASSERT_EQUAL_HEX16(0xA500, virtualPorts[3]);
+    Leds_turnOnAllLeds();
+    TEST_ASSERT_EQUAL_HEX16(0xA53F, virtualPorts[3]);
+    TEST_ASSERT_EQUAL_HEX32(0x3F, (uint32_t)Leds_getWord(word));
+    Leds_turnOffAllLeds();
+    TEST_ASSERT_EQUAL_HEX16(0xA500, virtualPorts[3]);
+    TEST_ASSERT_EQUAL_HEX32(0x00, (uint32_t)Leds_getWord(word));
+    Leds_setWord(word, (LedsWord_t)~0);
+    TEST_ASSERT_EQUAL_HEX16(0xA53F, virtualPorts[3]);
+    Leds_toggleWord(word, (LedsWord_t)~0);
+    TEST_ASSERT_EQUAL_HEX16(0xA500, virtualPorts[3]);
+    Leds_writeWord(word, (LedsWord_t)~0, 0xFFFF);
+    TEST_ASSERT_EQUAL_HEX16(0xA53F, virtualPorts[3]);
+    TEST_ASSERT_EQUAL_HEX32(0x3F, (uint32_t)Leds_getWord(word));
+}
+
+//! @test Each LED must be mapped to its bit of its port.
+void test_single_leds_map_to_their_port(void) {
+    Leds_turnOnSingle(1);
+    Leds_turnOnSingle(17);
+    Leds_turnOnSingle(34);
+    Leds_turnOnSingle(80);
+    TEST_ASSERT_EQUAL_HEX16(0x0001, virtualPorts[0]);
+    TEST_ASSERT_EQUAL_HEX16(0x0001, virtualPorts[2]);
+    TEST_ASSERT_EQUAL_HEX16(0x0002, virtualPorts[1]);
+    TEST_ASSERT_EQUAL_HEX16(0x0000, virtualPorts[4]);
+    TEST_ASSERT_EQUAL_HEX16(0x8000, virtualPorts[3]);
+    TEST_ASSERT_EQUAL(true, Leds_isLedTurnedOn(80));
+    Leds_turnOffSingle(17);
+    TEST_ASSERT_EQUAL(true, Leds_isLedTurnedOff(17));
+    TEST_ASSERT_EQUAL_HEX16(0x0000, virtualPorts[2]);
+}
+
+//! @test LEDs beyond the end of the bank must be ignored.
+void test_leds_beyond_the_bank_are_ignored(void) {
+    Leds_turnOnSingle(81);
+    TEST_ASSERT_EQUAL(false, Leds_isLedTurnedOn(81));
+    TEST_ASSERT_EQUAL(false, Leds_isLedTurnedOff(81));
+    for (int port = 0; port < BANK_PORTS; port++) {
+        TEST_ASSERT_EQUAL_HEX16(0x0000, virtualPorts[port]);
+    }
+}
+
+//! @test Turn on and off all LEDs of the bank at once.
+void test_turn_on_and_off_all_bank_leds(void) {
+    Leds_turnOnAllLeds();
+    for (int port = 0; port < BANK_PORTS; port++) {
+        TEST_ASSERT_EQUAL_HEX16(0xFFFF, virtualPorts[port]);
+    }
+    Leds_turnOffAllLeds();
+    for (int port = 0; port < BANK_PORTS; port++) {
+        TEST_ASSERT_EQUAL_HEX16(0x0000, virtualPorts[port]);
+    }
+}
+
+//! @test Word-wide operations must update every port covered by the word.
+void test_word_operations(void) {
+    Leds_setWord(0, (LedsWord_t)0x00018001);
+    TEST_ASSERT_EQUAL_HEX16(0x8001, virtualPorts[0]);
+    TEST_ASSERT_EQUAL_HEX16(0x0001, virtualPorts[2]);
+    Leds_toggleWord(0, (LedsWord_t)0x00030000);
+    TEST_ASSERT_EQUAL_HEX16(0x0002, virtualPorts[2]);
+    Leds_clearWord(0, (LedsWord_t)0x00000001);
+    TEST_ASSERT_EQUAL_HEX16(0x8000, virtualPorts[0]);
+    Leds_writeWord(0, (LedsWord_t)0xFF0000FF, (LedsWord_t)0x5A5A5A5A);
+    TEST_ASSERT_EQUAL_HEX16(0x805A, virtualPorts[0]);
+    TEST_ASSERT_EQUAL_HEX16(0x5A02, virtualPorts[2]);
+    TEST_ASSERT_EQUAL_HEX32(0x5A02805A, (uint32_t)Leds_getWord(0));
+}
+
+//! @test A word operation must not touch ports without any bit set in the mask.
+void test_word_operations_skip_untouched_ports(void) {
+    virtualPorts[0] = 0x1234;
+    Leds_setWord(0, (LedsWord_t)0x00010000);
+    TEST_ASSERT_EQUAL_HEX16(0x1234, virtualPorts[0]);
+    TEST_ASSERT_EQUAL_HEX16(0x0001, virtualPorts[2]);
+}
+
+//! @test A word that runs past the end of the bank must only use the ports that exist.
+void test_last_word_is_truncated_to_the_bank(void) {
+    uint8_t lastWord = (BANK_PORTS - 1) * LEDS_PER_PORT / LEDS_WORD_BITS;
+    Leds_setWord(lastWord, ~(LedsWord_t)0);
+    TEST_ASSERT_EQUAL_HEX16(0xFFFF, virtualPorts[3]);
+    TEST_ASSERT_EQUAL(true, Leds_isLedTurnedOn(80));
+    TEST_ASSERT_EQUAL(false, Leds_isLedTurnedOn(81));
+    TEST_ASSERT_EQUAL_HEX16(0x0000, (uint16_t)(Leds_getWord(lastWord + 1)));
+}
+
+/* === End of documentation ==================================================================== */
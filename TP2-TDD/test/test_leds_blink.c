@@ -0,0 +1,198 @@
+/************************************************************************************************
+Copyright (c) 2025, Juan Manuel Guariste <juanmaguariste@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** @file test_leds_blink.c
+ ** @brief Unitary tests for the blink timers of LEDs.
+ **/
+
+/* === Headers files inclusions ===============================================================
+ */
+#include "unity.h"
+#include "leds_blink.h"
+#include "leds.h"
+
+/* === Macros definitions ======================================================================
+ */
+
+/* === Private data type declarations ==========================================================
+ */
+
+/* === Private variable declarations ===========================================================
+ */
+static uint16_t virtualLeds = 0xFFFF;
+
+static LedsBlink_t blink;
+
+/* === Private function declarations ===========================================================
+ */
+
+/* === Public variable definitions =============================================================
+ */
+
+/* === Private variable definitions ============================================================
+ */
+
+/* === Private function implementation =========================================================
+ */
+
+/**
+ * @brief Runs the scheduler one millisecond at a time and counts the rising edges of a LED.
+ *
+ * @param from First millisecond to run.
+ *
+ * @param to Last millisecond to run.
+ *
+ * @param led LED number to watch.
+ *
+ * @return uint32_t Number of times the LED turned on.
+ */
+static uint32_t countBlinks(uint32_t from, uint32_t to, uint8_t led) {
+    uint32_t blinks = 0;
+    for (uint32_t now = from; now <= to; now++) {
+        bool wasOn = Leds_isLedTurnedOn(led);
+        LedsBlink_tick(&blink, now);
+        blinks += (!wasOn && Leds_isLedTurnedOn(led));
+    }
+    return blinks;
+}
+
+/* === Public function implementation ==========================================================
+ */
+
+void setUp(void) {
+    Leds_init(&virtualLeds);
+    LedsBlink_init(&blink, Leds_getDefault(), 0, 1000);
+}
+
+//! @test A blink must turn the LED on at the next tick and follow its on and off times.
+void test_blink_on_and_off_times(void) {
+    TEST_ASSERT_TRUE(LedsBlink_start(&blink, 3, 100, 200, LEDS_BLINK_FOREVER));
+    TEST_ASSERT_EQUAL_HEX16(0x0000, virtualLeds);
+    LedsBlink_tick(&blink, 1001);
+    TEST_ASSERT_EQUAL_HEX16(0x0004, virtualLeds);
+    LedsBlink_tick(&blink, 1100);
+    TEST_ASSERT_EQUAL_HEX16(0x0004, virtualLeds);
+    LedsBlink_tick(&blink, 1101);
+    TEST_ASSERT_EQUAL_HEX16(0x0000, virtualLeds);
+    LedsBlink_tick(&blink, 1301);
+    TEST_ASSERT_EQUAL_HEX16(0x0004, virtualLeds);
+    TEST_ASSERT_TRUE(LedsBlink_isActive(&blink, 3));
+}
+
+//! @test LEDs with different periods must blink independently.
+void test_independent_periods(void) {
+    LedsBlink_start(&blink, 1, 250, 250, LEDS_BLINK_FOREVER);
+    LedsBlink_start(&blink, 2, 500, 500, LEDS_BLINK_FOREVER);
+    TEST_ASSERT_EQUAL(4, countBlinks(1001, 3000, 1));
+    TEST_ASSERT_EQUAL(2, countBlinks(3001, 5000, 2));
+}
+
+//! @test A limited blink must stop after the requested number of blinks, leaving the LED off.
+void test_blink_count(void) {
+    LedsBlink_start(&blink, 5, 10, 10, 3);
+    TEST_ASSERT_EQUAL(3, countBlinks(1001, 2000, 5));
+    TEST_ASSERT_FALSE(LedsBlink_isActive(&blink, 5));
+    TEST_ASSERT_EQUAL(true, Leds_isLedTurnedOff(5));
+}
+
+//! @test A single blink with no off time must work as a time out.
+void test_time_out(void) {
+    LedsBlink_start(&blink, 7, 500, 0, 1);
+    LedsBlink_tick(&blink, 1001);
+    TEST_ASSERT_EQUAL(true, Leds_isLedTurnedOn(7));
+    LedsBlink_tick(&blink, 1500);
+    TEST_ASSERT_EQUAL(true, Leds_isLedTurnedOn(7));
+    LedsBlink_tick(&blink, 1501);
+    TEST_ASSERT_EQUAL(true, Leds_isLedTurnedOff(7));
+    TEST_ASSERT_FALSE(LedsBlink_isActive(&blink, 7));
+}
+
+//! @test Periods longer than the wheel and equal to it must be handled.
+void test_periods_beyond_the_wheel(void) {
+    LedsBlink_start(&blink, 1, LEDS_BLINK_SLOTS, LEDS_BLINK_SLOTS * 3 + 5, LEDS_BLINK_FOREVER);
+    LedsBlink_tick(&blink, 1001);
+    LedsBlink_tick(&blink, 1000 + LEDS_BLINK_SLOTS);
+    TEST_ASSERT_EQUAL(true, Leds_isLedTurnedOn(1));
+    LedsBlink_tick(&blink, 1001 + LEDS_BLINK_SLOTS);
+    TEST_ASSERT_EQUAL(true, Leds_isLedTurnedOff(1));
+    LedsBlink_tick(&blink, 1005 + LEDS_BLINK_SLOTS * 4);
+    TEST_ASSERT_EQUAL(true, Leds_isLedTurnedOff(1));
+    LedsBlink_tick(&blink, 1006 + LEDS_BLINK_SLOTS * 4);
+    TEST_ASSERT_EQUAL(true, Leds_isLedTurnedOn(1));
+}
+
+//! @test Cancelling a blink must turn the LED off and leave the other blinks running.
+void test_cancel(void) {
+    LedsBlink_start(&blink, 1, 100, 100, LEDS_BLINK_FOREVER);
+    LedsBlink_start(&blink, 2, 100, 100, LEDS_BLINK_FOREVER);
+    LedsBlink_tick(&blink, 1001);
+    LedsBlink_cancel(&blink, 1);
+    TEST_ASSERT_EQUAL_HEX16(0x0002, virtualLeds);
+    TEST_ASSERT_FALSE(LedsBlink_isActive(&blink, 1));
+    LedsBlink_tick(&blink, 1201);
+    TEST_ASSERT_EQUAL_HEX16(0x0002, virtualLeds);
+}
+
+//! @test Restarting a blink must replace the running one.
+void test_restart(void) {
+    LedsBlink_start(&blink, 4, 100, 100, LEDS_BLINK_FOREVER);
+    LedsBlink_tick(&blink, 1050);
+    LedsBlink_start(&blink, 4, 10, 10, 1);
+    LedsBlink_tick(&blink, 1051);
+    LedsBlink_tick(&blink, 1061);
+    TEST_ASSERT_EQUAL(true, Leds_isLedTurnedOff(4));
+    TEST_ASSERT_EQUAL(0, countBlinks(1062, 1300, 4));
+}
+
+//! @test Transitions must leave the LEDs not handled by the scheduler untouched.
+void test_other_leds_are_not_touched(void) {
+    Leds_turnOnSingle(16);
+    LedsBlink_start(&blink, 1, 10, 10, LEDS_BLINK_FOREVER);
+    countBlinks(1001, 1100, 1);
+    TEST_ASSERT_EQUAL(true, Leds_isLedTurnedOn(16));
+}
+
+//! @test A call after a long stall must only catch up one revolution of the wheel and keep the
+//! blinks in phase.
+void test_long_stall_is_bounded(void) {
+    uint32_t now = 1001 + 100 * LEDS_BLINK_SLOTS;
+    LedsBlink_start(&blink, 1, 10, 10, LEDS_BLINK_FOREVER);
+    LedsBlink_start(&blink, 2, 100, 0, 1);
+    LedsBlink_tick(&blink, 1001);
+    TEST_ASSERT_EQUAL_HEX16(0x0003, virtualLeds);
+
+    LedsBlink_tick(&blink, now);
+    TEST_ASSERT_EQUAL(true, Leds_isLedTurnedOn(1));
+    TEST_ASSERT_EQUAL(true, Leds_isLedTurnedOff(2));
+    TEST_ASSERT_FALSE(LedsBlink_isActive(&blink, 2));
+    TEST_ASSERT_TRUE(LedsBlink_isActive(&blink, 1));
+    TEST_ASSERT_EQUAL(10, countBlinks(now + 1, now + 200, 1));
+}
+
+//! @test Invalid arguments must be rejected.
+void test_invalid_arguments(void) {
+    TEST_ASSERT_FALSE(LedsBlink_start(&blink, 0, 10, 10, 1));
+    TEST_ASSERT_FALSE(LedsBlink_start(&blink, LEDS_WORD_BITS + 1, 10, 10, 1));
+    TEST_ASSERT_FALSE(LedsBlink_start(&blink, 1, 0, 10, 1));
+    TEST_ASSERT_FALSE(LedsBlink_isActive(&blink, 0));
+}
+
+/* === End of documentation ==================================================================== */
@@ -0,0 +1,190 @@
+/************************************************************************************************
+Copyright (c) 2025, Juan Manuel Guariste <juanmaguariste@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** @file test_leds_frame.c
+ ** @brief Unitary tests for the double-buffered LED frames.
+ **/
+
+/* === Headers files inclusions ===============================================================
+ */
+#include "unity.h"
+#include "leds.h"
+
+/* === Macros definitions ======================================================================
+ */
+
+/* === Private data type declarations ==========================================================
+ */
+
+/* === Private variable declarations ===========================================================
+ */
+static uint16_t virtualLeds = 0xFFFF;
+static uint16_t panelPorts[2] = {0xFFFF, 0xFFFF};
+static uint16_t * const panelPortList[2] = {&panelPorts[0], &panelPorts[1]};
+
+static Leds_t panel;
+static Leds_t extraGroups[LEDS_MAX_FRAME_GROUPS];
+static uint16_t extraPorts[LEDS_MAX_FRAME_GROUPS];
+
+/* === Private function declarations ===========================================================
+ */
+
+/* === Public variable definitions =============================================================
+ */
+
+/* === Private variable definitions ============================================================
+ */
+
+/* === Private function implementation =========================================================
+ */
+
+/* === Public function implementation ==========================================================
+ */
+
+void setUp(void) {
+    LedsBank_t panelBank = {.ports = panelPortList, .count = 2};
+    Leds_init(&virtualLeds);
+    TEST_ASSERT_TRUE(LedsGroup_initBank(&panel, &panelBank));
+}
+
+void tearDown(void) {
+    Leds_setBuffered(false);
+    LedsGroup_setBuffered(&panel, false);
+    for (uint8_t index = 0; index < LEDS_MAX_FRAME_GROUPS; index++) {
+        LedsGroup_setBuffered(&extraGroups[index], false);
+    }
+}
+
+//! @test Initializing a buffered group again must give back its place in the commit list.
+void test_reinit_releases_the_frame_group(void) {
+    LedsBank_t panelBank = {.ports = panelPortList, .count = 2};
+    for (uint8_t round = 0; round <= LEDS_MAX_FRAME_GROUPS; round++) {
+        TEST_ASSERT_TRUE(LedsGroup_initBank(&panel, &panelBank));
+        TEST_ASSERT_TRUE(LedsGroup_setBuffered(&panel, true));
+    }
+    TEST_ASSERT_TRUE(LedsGroup_initBank(&panel, &panelBank));
+    for (uint8_t index = 0; index < LEDS_MAX_FRAME_GROUPS; index++) {
+        LedsGroup_init(&extraGroups[index], &extraPorts[index]);
+        TEST_ASSERT_TRUE(LedsGroup_setBuffered(&extraGroups[index], true));
+    }
+}
+
+//! @test While buffered, the writes must not reach the port until the frame is committed.
+void test_writes_are_hidden_until_commit(void) {
+    Leds_turnOnSingle(1);
+    TEST_ASSERT_TRUE(Leds_setBuffered(true));
+    Leds_turnOnSingle(3);
+    Leds_turnOnSingle(5);
+    Leds_turnOffSingle(1);
+    TEST_ASSERT_EQUAL_HEX16(0x0001, virtualLeds);
+    TEST_ASSERT_EQUAL(1, Leds_commit());
+    TEST_ASSERT_EQUAL_HEX16(0x0014, virtualLeds);
+}
+
+//! @test The queries of a buffered group must return the working frame.
+void test_queries_read_the_working_frame(void) {
+    Leds_setBuffered(true);
+    Leds_turnOnSingle(7);
+    TEST_ASSERT_TRUE(Leds_isLedTurnedOn(7));
+    TEST_ASSERT_EQUAL_HEX16(0x0040, Leds_getAll());
+    TEST_ASSERT_EQUAL_HEX16(0x0000, virtualLeds);
+}
+
+//! @test A commit must only write the ports that changed since the last commit.
+void test_commit_writes_only_changed_ports(void) {
+    LedsGroup_setBuffered(&panel, true);
+    LedsGroup_turnOnSingle(&panel, 20);
+    LedsGroup_turnOnSingle(&panel, 21);
+    TEST_ASSERT_EQUAL(1, LedsGroup_commit(&panel));
+    TEST_ASSERT_EQUAL_HEX16(0x0000, panelPorts[0]);
+    TEST_ASSERT_EQUAL_HEX16(0x0018, panelPorts[1]);
+    TEST_ASSERT_EQUAL(0, LedsGroup_commit(&panel));
+    LedsGroup_turnOnAllLeds(&panel);
+    TEST_ASSERT_EQUAL(2, LedsGroup_commit(&panel));
+    TEST_ASSERT_EQUAL_HEX16(0xFFFF, panelPorts[0]);
+    TEST_ASSERT_EQUAL_HEX16(0xFFFF, panelPorts[1]);
+}
+
+//! @test The statistics must count the frames and the port writes of the commits.
+void test_frame_statistics(void) {
+    LedsGroup_setBuffered(&panel, true);
+    LedsGroup_turnOnSingle(&panel, 1);
+    LedsGroup_turnOnSingle(&panel, 17);
+    LedsGroup_commit(&panel);
+    LedsGroup_turnOffSingle(&panel, 1);
+    LedsGroup_commit(&panel);
+    LedsFrameStats_t stats = LedsGroup_getFrameStats(&panel);
+    TEST_ASSERT_EQUAL(2, stats.frames);
+    TEST_ASSERT_EQUAL(3, stats.writes);
+    TEST_ASSERT_EQUAL(1, stats.lastWrites);
+}
+
+//! @test Frames committed on the tick must change together, and only on the tick.
+void test_groups_change_on_the_same_tick(void) {
+    Leds_setBuffered(true);
+    LedsGroup_setBuffered(&panel, true);
+    Leds_turnOnSingle(2);
+    Leds_commitOnTick();
+    LedsGroup_turnOnSingle(&panel, 32);
+    LedsGroup_commitOnTick(&panel);
+    TEST_ASSERT_EQUAL_HEX16(0x0000, virtualLeds);
+    TEST_ASSERT_EQUAL_HEX16(0x0000, panelPorts[1]);
+    Leds_commitTick();
+    TEST_ASSERT_EQUAL_HEX16(0x0002, virtualLeds);
+    TEST_ASSERT_EQUAL_HEX16(0x8000, panelPorts[1]);
+}
+
+//! @test Writes made after latching a frame must wait for the next latched frame.
+void test_latched_frame_is_not_changed_by_later_writes(void) {
+    Leds_setBuffered(true);
+    Leds_turnOnSingle(4);
+    Leds_commitOnTick();
+    Leds_turnOnSingle(6);
+    Leds_commitTick();
+    TEST_ASSERT_EQUAL_HEX16(0x0008, virtualLeds);
+    Leds_commitTick();
+    TEST_ASSERT_EQUAL_HEX16(0x0008, virtualLeds);
+    Leds_commitOnTick();
+    Leds_commitTick();
+    TEST_ASSERT_EQUAL_HEX16(0x0028, virtualLeds);
+}
+
+//! @test Leaving the buffered mode must commit the frame and write the port directly again.
+void test_leaving_buffered_mode_commits(void) {
+    Leds_setBuffered(true);
+    Leds_turnOnSingle(9);
+    TEST_ASSERT_TRUE(Leds_setBuffered(false));
+    TEST_ASSERT_EQUAL_HEX16(0x0100, virtualLeds);
+    Leds_turnOnSingle(10);
+    TEST_ASSERT_EQUAL_HEX16(0x0300, virtualLeds);
+    TEST_ASSERT_EQUAL(0, Leds_commit());
+}
+
+//! @test Only LEDS_MAX_FRAME_GROUPS groups can be buffered at the same time.
+void test_buffered_groups_are_limited(void) {
+    for (uint8_t index = 0; index < LEDS_MAX_FRAME_GROUPS; index++) {
+        LedsGroup_init(&extraGroups[index], &extraPorts[index]);
+        TEST_ASSERT_TRUE(LedsGroup_setBuffered(&extraGroups[index], true));
+    }
+    TEST_ASSERT_FALSE(LedsGroup_setBuffered(&panel, true));
+    LedsGroup_setBuffered(&extraGroups[0], false);
+    TEST_ASSERT_TRUE(LedsGroup_setBuffered(&panel, true));
+}
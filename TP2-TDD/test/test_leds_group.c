@@ -0,0 +1,127 @@
+/************************************************************************************************
+Copyright (c) 2025, Juan Manuel Guariste <juanmaguariste@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** @file test_leds_group.c
+ ** @brief Unitary tests for independent groups of LEDs.
+ **/
+
+/* === Headers files inclusions ===============================================================
+ */
+#include "unity.h"
+#include "leds.h"
+
+/* === Macros definitions ======================================================================
+ */
+
+/* === Private data type declarations ==========================================================
+ */
+
+/* === Private variable declarations ===========================================================
+ */
+static uint16_t frontPanelPort = 0xFFFF;
+static uint16_t servicePorts[2] = {0xFFFF, 0xFFFF};
+static uint16_t * const servicePortList[2] = {&servicePorts[0], &servicePorts[1]};
+
+static Leds_t frontPanel;
+static Leds_t serviceBoard;
+
+/* === Private function declarations ===========================================================
+ */
+
+/* === Public variable definitions =============================================================
+ */
+
+/* === Private variable definitions ============================================================
+ */
+
+/* === Private function implementation =========================================================
+ */
+
+/* === Public function implementation ==========================================================
+ */
+
+void setUp(void) {
+    LedsBank_t serviceBank = {.ports = servicePortList, .count = 2};
+    LedsGroup_init(&frontPanel, &frontPanelPort);
+    TEST_ASSERT_TRUE(LedsGroup_initBank(&serviceBoard, &serviceBank));
+}
+
+//! @test After initialization, the LEDs of every group should be off.
+void test_all_group_leds_initially_off(void) {
+    TEST_ASSERT_EQUAL_HEX16(0x0000, frontPanelPort);
+    TEST_ASSERT_EQUAL_HEX16(0x0000, servicePorts[0]);
+    TEST_ASSERT_EQUAL_HEX16(0x0000, servicePorts[1]);
+    TEST_ASSERT_EQUAL(16, LedsGroup_getCount(&frontPanel));
+    TEST_ASSERT_EQUAL(32, LedsGroup_getCount(&serviceBoard));
+}
+
+//! @test Changing the LEDs of a group must not affect the other group.
+void test_groups_are_independent(void) {
+    LedsGroup_turnOnSingle(&frontPanel, 3);
+    LedsGroup_turnOnSingle(&serviceBoard, 20);
+    LedsGroup_turnOnAllLeds(&frontPanel);
+    LedsGroup_turnOffSingle(&frontPanel, 1);
+    TEST_ASSERT_EQUAL_HEX16(0xFFFE, frontPanelPort);
+    TEST_ASSERT_EQUAL_HEX16(0x0000, servicePorts[0]);
+    TEST_ASSERT_EQUAL_HEX16(0x0008, servicePorts[1]);
+    TEST_ASSERT_EQUAL(true, LedsGroup_isLedTurnedOn(&serviceBoard, 20));
+    TEST_ASSERT_EQUAL(true, LedsGroup_isLedTurnedOff(&frontPanel, 1));
+    LedsGroup_turnOffAllLeds(&serviceBoard);
+    TEST_ASSERT_EQUAL_HEX16(0xFFFE, frontPanelPort);
+}
+
+//! @test LEDs beyond the end of a group must be ignored, even if another group has them.
+void test_group_limits(void) {
+    LedsGroup_turnOnSingle(&frontPanel, 17);
+    TEST_ASSERT_EQUAL(false, LedsGroup_isLedTurnedOn(&frontPanel, 17));
+    TEST_ASSERT_EQUAL_HEX16(0x0000, frontPanelPort);
+    LedsGroup_turnOnSingle(&serviceBoard, 17);
+    TEST_ASSERT_EQUAL(true, LedsGroup_isLedTurnedOn(&serviceBoard, 17));
+}
+
+//! @test Mask and word operations must work on the selected group only.
+void test_group_bulk_operations(void) {
+    LedsGroup_setMask(&frontPanel, 0x00F0);
+    LedsGroup_toggleMask(&frontPanel, 0x0030);
+    LedsGroup_writeMasked(&frontPanel, 0x000F, 0x0005);
+    TEST_ASSERT_EQUAL_HEX16(0x00C5, LedsGroup_getAll(&frontPanel));
+    LedsGroup_clearMask(&frontPanel, 0x0004);
+    TEST_ASSERT_EQUAL_HEX16(0x00C1, frontPanelPort);
+    LedsGroup_setWord(&serviceBoard, 0, (LedsWord_t)0x80000001);
+    LedsGroup_toggleWord(&serviceBoard, 0, (LedsWord_t)0x00000003);
+    LedsGroup_writeWord(&serviceBoard, 0, (LedsWord_t)0x00FF0000, (LedsWord_t)0x00120000);
+    LedsGroup_clearWord(&serviceBoard, 0, (LedsWord_t)0x80000000);
+    TEST_ASSERT_EQUAL_HEX32(0x00120002, (uint32_t)LedsGroup_getWord(&serviceBoard, 0));
+    TEST_ASSERT_EQUAL_HEX16(0x00C1, frontPanelPort);
+}
+
+//! @test The default group used by the Leds_ functions is independent of the other groups.
+void test_default_group(void) {
+    uint16_t defaultPort = 0xFFFF;
+    Leds_init(&defaultPort);
+    Leds_turnOnSingle(2);
+    TEST_ASSERT_EQUAL(true, LedsGroup_isLedTurnedOn(Leds_getDefault(), 2));
+    TEST_ASSERT_EQUAL(false, LedsGroup_isLedTurnedOn(&frontPanel, 2));
+    TEST_ASSERT_EQUAL_HEX16(0x0002, defaultPort);
+    TEST_ASSERT_EQUAL_HEX16(0x0000, frontPanelPort);
+}
+
+/* === End of documentation ==================================================================== */
@@ -0,0 +1,117 @@
+/************************************************************************************************
+Copyright (c) 2025, Juan Manuel Guariste <juanmaguariste@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** @file test_leds_map.c
+ ** @brief Unitary tests for the remapping of logical LEDs, built with the test board wiring.
+ **/
+
+/* === Headers files inclusions ===============================================================
+ */
+#include "unity.h"
+#include "leds_map.h"
+#include "leds.h"
+
+/* === Macros definitions ======================================================================
+ */
+
+/* === Private data type declarations ==========================================================
+ */
+
+/* === Private variable declarations ===========================================================
+ */
+static uint16_t virtualLeds = 0x0000;
+
+static Leds_t board;
+
+/* === Private function declarations ===========================================================
+ */
+
+/* === Public variable definitions =============================================================
+ */
+
+/* === Private variable definitions ============================================================
+ */
+
+/* === Private function implementation =========================================================
+ */
+
+/* === Public function implementation ==========================================================
+ */
+
+void setUp(void) {
+    LedsMap_init(&board, &virtualLeds);
+}
+
+//! @test After initialization, every logical LED must be off, active-low outputs included.
+void test_all_leds_initially_off(void) {
+    TEST_ASSERT_EQUAL_HEX16(0x0584, virtualLeds);
+    TEST_ASSERT_EQUAL_HEX16(0x0000, LedsMap_getAll(&board));
+}
+
+//! @test Single LEDs must drive their own port bit with their own polarity.
+void test_single_leds_follow_the_wiring(void) {
+    LedsMap_turnOnSingle(&board, 1);
+    TEST_ASSERT_EQUAL_HEX16(0x05A4, virtualLeds);
+    LedsMap_turnOnSingle(&board, 3);
+    TEST_ASSERT_EQUAL_HEX16(0x0524, virtualLeds);
+    TEST_ASSERT_TRUE(LedsMap_isLedTurnedOn(&board, 3));
+    TEST_ASSERT_FALSE(LedsMap_isLedTurnedOn(&board, 4));
+    LedsMap_turnOffSingle(&board, 3);
+    LedsMap_turnOffSingle(&board, 1);
+    TEST_ASSERT_EQUAL_HEX16(0x0584, virtualLeds);
+}
+
+//! @test LED numbers out of range must not change the port.
+void test_out_of_range_leds(void) {
+    LedsMap_turnOnSingle(&board, 0);
+    LedsMap_turnOnSingle(&board, 17);
+    TEST_ASSERT_EQUAL_HEX16(0x0584, virtualLeds);
+    TEST_ASSERT_FALSE(LedsMap_isLedTurnedOn(&board, 17));
+}
+
+//! @test Mask translation must be a permutation that round-trips.
+void test_mask_translation(void) {
+    TEST_ASSERT_EQUAL_HEX16(0x0000, LedsMap_toPhysical(0x0000));
+    TEST_ASSERT_EQUAL_HEX16(0xFFFF, LedsMap_toPhysical(0xFFFF));
+    TEST_ASSERT_EQUAL_HEX16(0x8021, LedsMap_toPhysical(0x0013));
+    for (uint32_t logical = 0; logical <= 0xFFFF; logical += 0x0101) {
+        TEST_ASSERT_EQUAL_HEX16(logical, LedsMap_toLogical(LedsMap_toPhysical(logical)));
+    }
+    for (uint8_t led = 1; led <= 16; led++) {
+        TEST_ASSERT_EQUAL_HEX16(LedsMap_ledToMask(led), LedsMap_toPhysical(1 << (led - 1)));
+    }
+}
+
+//! @test Bulk operations must work on logical LEDs whatever their wiring and polarity.
+void test_bulk_operations(void) {
+    LedsMap_setMask(&board, 0x800C);
+    TEST_ASSERT_EQUAL_HEX16(0x800C, LedsMap_getAll(&board));
+    TEST_ASSERT_EQUAL_HEX16(0x0100, virtualLeds);
+    LedsMap_toggleMask(&board, 0x0014);
+    TEST_ASSERT_EQUAL_HEX16(0x8018, LedsMap_getAll(&board));
+    LedsMap_clearMask(&board, 0x8000);
+    TEST_ASSERT_EQUAL_HEX16(0x0018, LedsMap_getAll(&board));
+    LedsMap_writeMasked(&board, 0x00FF, 0x0102);
+    TEST_ASSERT_EQUAL_HEX16(0x0002, LedsMap_getAll(&board));
+    TEST_ASSERT_EQUAL_HEX16(0x0585, virtualLeds);
+}
+
+/* === End of documentation ==================================================================== */
@@ -0,0 +1,92 @@
+/************************************************************************************************
+Copyright (c) 2025, Juan Manuel Guariste <juanmaguariste@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** @file test_leds_profile.c
+ ** @brief Unitary tests for the profiling probes of the LEDs driver.
+ **/
+
+/* === Headers files inclusions ===============================================================
+ */
+#include "unity.h"
+#include "profile.h"
+#include "leds.h"
+
+/* === Macros definitions ======================================================================
+ */
+
+/* === Private data type declarations ==========================================================
+ */
+
+/* === Private variable declarations ===========================================================
+ */
+static uint16_t virtualLeds = 0xFFFF;
+
+/* === Private function declarations ===========================================================
+ */
+
+/* === Public variable definitions =============================================================
+ */
+
+/* === Private variable definitions ============================================================
+ */
+
+/* === Private function implementation =========================================================
+ */
+
+/**
+ * @brief Number of measurements of a probe.
+ *
+ * @param label Label of the probe.
+ *
+ * @return uint32_t Measurements, 0 if the probe never measured.
+ */
+static uint32_t probeCount(const char * label) {
+    const ProfileProbe_t * probe = Profile_find(label);
+    return (probe != NULL) ? probe->count : 0;
+}
+
+/* === Public function implementation ==========================================================
+ */
+
+void setUp(void) {
+    Leds_init(&virtualLeds);
+    Profile_reset();
+}
+
+//! @test Writes to the working frame of a buffered group must not be counted as port writes,
+//! the port is written and counted once by the commit.
+void test_frame_writes_are_not_port_writes(void) {
+    Leds_turnOnSingle(1);
+    TEST_ASSERT_EQUAL(1, probeCount("leds port write"));
+    TEST_ASSERT_TRUE(Leds_setBuffered(true));
+    Leds_turnOnSingle(2);
+    Leds_turnOnSingle(3);
+    TEST_ASSERT_EQUAL(1, probeCount("leds port write"));
+    TEST_ASSERT_EQUAL(0, probeCount("leds frame commit write"));
+    Leds_commitOnTick();
+    Leds_commitTick();
+    TEST_ASSERT_EQUAL(1, probeCount("leds port write"));
+    TEST_ASSERT_EQUAL(1, probeCount("leds frame commit write"));
+    TEST_ASSERT_EQUAL_HEX16(0x0007, virtualLeds);
+    TEST_ASSERT_TRUE(Leds_setBuffered(false));
+}
+
+/* === End of documentation ==================================================================== */
@@ -0,0 +1,153 @@
+/************************************************************************************************
+Copyright (c) 2025, Juan Manuel Guariste <juanmaguariste@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** @file test_leds_pwm.c
+ ** @brief Unitary tests for the brightness control of LEDs.
+ **/
+
+/* === Headers files inclusions ===============================================================
+ */
+#include "unity.h"
+#include "leds_pwm.h"
+#include "leds.h"
+
+/* === Macros definitions ======================================================================
+ */
+
+/* === Private data type declarations ==========================================================
+ */
+
+/* === Private variable declarations ===========================================================
+ */
+static uint16_t virtualLeds = 0xFFFF;
+
+static LedsPwm_t pwm;
+
+/* === Private function declarations ===========================================================
+ */
+
+/* === Public variable definitions =============================================================
+ */
+
+/* === Private variable definitions ============================================================
+ */
+
+/* === Private function implementation =========================================================
+ */
+
+/**
+ * @brief Runs a full modulation frame and counts the ticks every LED of the port was on.
+ *
+ * @param onTicks Where to store the count of every LED (16 entries).
+ *
+ * @return uint32_t Number of times the port value changed during the frame.
+ */
+static uint32_t runFrame(uint16_t onTicks[16]) {
+    uint32_t changes = 0;
+    for (int led = 0; led < 16; led++) {
+        onTicks[led] = 0;
+    }
+    for (int tick = 0; tick < LEDS_PWM_FRAME_TICKS; tick++) {
+        uint16_t previous = virtualLeds;
+        LedsPwm_tick(&pwm);
+        changes += (virtualLeds != previous);
+        for (int led = 0; led < 16; led++) {
+            onTicks[led] += (virtualLeds >> led) & 1;
+        }
+    }
+    return changes;
+}
+
+/* === Public function implementation ==========================================================
+ */
+
+void setUp(void) {
+    Leds_init(&virtualLeds);
+    LedsPwm_init(&pwm, Leds_getDefault(), 0);
+}
+
+//! @test Full and zero levels must keep the LED steadily on and off.
+void test_full_and_zero_levels(void) {
+    uint16_t onTicks[16];
+    LedsPwm_setLevel(&pwm, 1, 255);
+    LedsPwm_setLevel(&pwm, 2, 0);
+    runFrame(onTicks);
+    TEST_ASSERT_EQUAL(LEDS_PWM_FRAME_TICKS, onTicks[0]);
+    TEST_ASSERT_EQUAL(0, onTicks[1]);
+    TEST_ASSERT_EQUAL(0, runFrame(onTicks));
+}
+
+//! @test The on time of every LED must follow its gamma corrected level.
+void test_on_time_follows_gamma_corrected_level(void) {
+    uint16_t onTicks[16];
+    LedsPwm_setLevel(&pwm, 3, 128);
+    LedsPwm_setLevel(&pwm, 4, 64);
+    LedsPwm_setLevel(&pwm, 16, 15);
+    runFrame(onTicks);
+    TEST_ASSERT_EQUAL(56, onTicks[2]);
+    TEST_ASSERT_EQUAL(12, onTicks[3]);
+    TEST_ASSERT_EQUAL(1, onTicks[15]);
+    TEST_ASSERT_EQUAL(128, LedsPwm_getLevel(&pwm, 3));
+}
+
+//! @test The port must be written at most once per bit plane.
+void test_port_changes_at_most_once_per_plane(void) {
+    uint16_t onTicks[16];
+    LedsPwm_setLevel(&pwm, 1, 0xAA);
+    LedsPwm_setLevel(&pwm, 2, 0x55);
+    runFrame(onTicks);
+    TEST_ASSERT_LESS_OR_EQUAL(LEDS_PWM_BITS, runFrame(onTicks));
+}
+
+//! @test LEDs not under brightness control must not be touched.
+void test_other_leds_are_not_touched(void) {
+    uint16_t onTicks[16];
+    Leds_turnOnSingle(8);
+    LedsPwm_setLevel(&pwm, 1, 100);
+    runFrame(onTicks);
+    TEST_ASSERT_EQUAL(LEDS_PWM_FRAME_TICKS, onTicks[7]);
+    TEST_ASSERT_EQUAL(0, onTicks[8]);
+}
+
+//! @test A released LED must be turned off and left alone by the engine.
+void test_release_led(void) {
+    uint16_t onTicks[16];
+    LedsPwm_setLevel(&pwm, 5, 255);
+    runFrame(onTicks);
+    LedsPwm_release(&pwm, 5);
+    TEST_ASSERT_EQUAL(true, Leds_isLedTurnedOff(5));
+    Leds_turnOnSingle(5);
+    runFrame(onTicks);
+    TEST_ASSERT_EQUAL(LEDS_PWM_FRAME_TICKS, onTicks[4]);
+    TEST_ASSERT_EQUAL(0, LedsPwm_getLevel(&pwm, 5));
+}
+
+//! @test LED numbers out of range must be ignored.
+void test_out_of_range_leds(void) {
+    uint16_t onTicks[16];
+    LedsPwm_setLevel(&pwm, 0, 255);
+    LedsPwm_setLevel(&pwm, LEDS_WORD_BITS + 1, 255);
+    runFrame(onTicks);
+    TEST_ASSERT_EQUAL_HEX16(0x0000, virtualLeds);
+    TEST_ASSERT_EQUAL(0, LedsPwm_getLevel(&pwm, 0));
+}
+
+/* === End of documentation ==================================================================== */
@@ -0,0 +1,171 @@
+/************************************************************************************************
+Copyright (c) 2025, Juan Manuel Guariste <juanmaguariste@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** @file test_leds_sequencer.c
+ ** @brief Unitary tests for the playback of LED animations.
+ **/
+
+/* === Headers files inclusions ===============================================================
+ */
+#include "unity.h"
+#include "leds_sequencer.h"
+#include "leds.h"
+
+/* === Macros definitions ======================================================================
+ */
+
+/* === Private data type declarations ==========================================================
+ */
+
+/* === Private variable declarations ===========================================================
+ */
+static uint16_t virtualLeds = 0xFFFF;
+
+static LedsSeq_t seq;
+
+//! Chase over LEDs 1 to 3, 100 ms per step
+static const LedsFrame_t chaseFrames[] = {{0x1, 100}, {0x2, 100}, {0x4, 100}};
+static const LedsAnimation_t chase = {chaseFrames, 3, 0x7, true};
+
+//! Single flash of LEDs 2 and 4, 50 ms
+static const LedsFrame_t flashFrames[] = {{0xA, 50}};
+static const LedsAnimation_t flash = {flashFrames, 1, 0xA, false};
+
+//! Blink of LED 8 that ends with the LED on
+static const LedsFrame_t blinkOnceFrames[] = {{0x80, 10}, {0x00, 10}, {0x80, 0}};
+static const LedsAnimation_t blinkOnce = {blinkOnceFrames, 3, 0x80, false};
+
+/* === Private function declarations ===========================================================
+ */
+
+/* === Public variable definitions =============================================================
+ */
+
+/* === Private variable definitions ============================================================
+ */
+
+/* === Private function implementation =========================================================
+ */
+
+/* === Public function implementation ==========================================================
+ */
+
+void setUp(void) {
+    Leds_init(&virtualLeds);
+    LedsSeq_init(&seq, Leds_getDefault(), 0);
+}
+
+//! @test The first frame must be shown as soon as the animation starts.
+void test_play_shows_first_frame(void) {
+    TEST_ASSERT_TRUE(LedsSeq_play(&seq, 0, &chase, 1000));
+    TEST_ASSERT_EQUAL_HEX16(0x0001, virtualLeds);
+    TEST_ASSERT_TRUE(LedsSeq_isPlaying(&seq, 0));
+    TEST_ASSERT_FALSE(LedsSeq_isPlaying(&seq, 1));
+}
+
+//! @test Invalid layers and animations must be rejected.
+void test_play_invalid_arguments(void) {
+    static const LedsAnimation_t empty = {chaseFrames, 0, 0x7, true};
+    TEST_ASSERT_FALSE(LedsSeq_play(&seq, LEDS_SEQ_LAYERS, &chase, 0));
+    TEST_ASSERT_FALSE(LedsSeq_play(&seq, 0, NULL, 0));
+    TEST_ASSERT_FALSE(LedsSeq_play(&seq, 0, &empty, 0));
+}
+
+//! @test Frames must change when their duration elapses and the animation must loop.
+void test_frames_advance_and_loop(void) {
+    LedsSeq_play(&seq, 0, &chase, 1000);
+    LedsSeq_tick(&seq, 1099);
+    TEST_ASSERT_EQUAL_HEX16(0x0001, virtualLeds);
+    LedsSeq_tick(&seq, 1100);
+    TEST_ASSERT_EQUAL_HEX16(0x0002, virtualLeds);
+    LedsSeq_tick(&seq, 1200);
+    TEST_ASSERT_EQUAL_HEX16(0x0004, virtualLeds);
+    LedsSeq_tick(&seq, 1300);
+    TEST_ASSERT_EQUAL_HEX16(0x0001, virtualLeds);
+}
+
+//! @test A late tick must catch up with the right frame without drifting.
+void test_late_tick_catches_up(void) {
+    LedsSeq_play(&seq, 0, &chase, 1000);
+    LedsSeq_tick(&seq, 1250);
+    TEST_ASSERT_EQUAL_HEX16(0x0004, virtualLeds);
+    LedsSeq_tick(&seq, 1299);
+    TEST_ASSERT_EQUAL_HEX16(0x0004, virtualLeds);
+    LedsSeq_tick(&seq, 1300);
+    TEST_ASSERT_EQUAL_HEX16(0x0001, virtualLeds);
+}
+
+//! @test A tick after a long stall must skip the whole loops and keep the animation in phase.
+void test_long_stall_is_bounded(void) {
+    uint32_t stall = 7000000 * 300;
+    LedsSeq_play(&seq, 0, &chase, 1000);
+    LedsSeq_tick(&seq, 1000 + stall + 150);
+    TEST_ASSERT_EQUAL_HEX16(0x0002, virtualLeds);
+    LedsSeq_tick(&seq, 1000 + stall + 199);
+    TEST_ASSERT_EQUAL_HEX16(0x0002, virtualLeds);
+    LedsSeq_tick(&seq, 1000 + stall + 200);
+    TEST_ASSERT_EQUAL_HEX16(0x0004, virtualLeds);
+}
+
+//! @test Higher layers must win where masks overlap, and give the LEDs back when they end.
+void test_layers_combine_by_priority(void) {
+    LedsSeq_play(&seq, 0, &chase, 0);
+    LedsSeq_play(&seq, 1, &flash, 0);
+    TEST_ASSERT_EQUAL_HEX16(0x000B, virtualLeds);
+    LedsSeq_tick(&seq, 50);
+    TEST_ASSERT_FALSE(LedsSeq_isPlaying(&seq, 1));
+    TEST_ASSERT_EQUAL_HEX16(0x0001, virtualLeds);
+    LedsSeq_tick(&seq, 100);
+    TEST_ASSERT_EQUAL_HEX16(0x0002, virtualLeds);
+}
+
+//! @test LEDs not owned by any animation must not be touched.
+void test_other_leds_are_not_touched(void) {
+    Leds_turnOnSingle(16);
+    LedsSeq_play(&seq, 0, &chase, 0);
+    LedsSeq_tick(&seq, 100);
+    TEST_ASSERT_EQUAL_HEX16(0x8002, virtualLeds);
+    LedsSeq_stop(&seq, 0);
+    TEST_ASSERT_EQUAL_HEX16(0x8000, virtualLeds);
+    TEST_ASSERT_FALSE(LedsSeq_isPlaying(&seq, 0));
+}
+
+//! @test A frame with no duration must be held until the layer is stopped.
+void test_zero_duration_holds_frame(void) {
+    LedsSeq_play(&seq, 2, &blinkOnce, 0);
+    LedsSeq_tick(&seq, 10);
+    TEST_ASSERT_EQUAL_HEX16(0x0000, virtualLeds);
+    LedsSeq_tick(&seq, 20);
+    LedsSeq_tick(&seq, 60000);
+    TEST_ASSERT_EQUAL_HEX16(0x0080, virtualLeds);
+    TEST_ASSERT_TRUE(LedsSeq_isPlaying(&seq, 2));
+}
+
+//! @test Time must be handled across the wrap-around of the millisecond counter.
+void test_time_wrap_around(void) {
+    LedsSeq_play(&seq, 0, &chase, UINT32_MAX - 49);
+    LedsSeq_tick(&seq, 49);
+    TEST_ASSERT_EQUAL_HEX16(0x0001, virtualLeds);
+    LedsSeq_tick(&seq, 50);
+    TEST_ASSERT_EQUAL_HEX16(0x0002, virtualLeds);
+}
+
+/* === End of documentation ==================================================================== */
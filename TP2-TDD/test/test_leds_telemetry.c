@@ -0,0 +1,111 @@
+/************************************************************************************************
+Copyright (c) 2025, Juan Manuel Guariste <juanmaguariste@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** @file test_leds_telemetry.c
+ ** @brief Unitary tests for the telemetry hooks of the LEDs driver.
+ **/
+
+/* === Headers files inclusions ===============================================================
+ */
+#include "unity.h"
+#include "telemetry.h"
+#include "leds.h"
+
+/* === Macros definitions ======================================================================
+ */
+
+//! Size of the buffer used to read the frames
+#define READ_SIZE (TELEMETRY_SLOTS * TELEMETRY_FRAME_SIZE)
+
+/* === Private data type declarations ==========================================================
+ */
+
+/* === Private variable declarations ===========================================================
+ */
+static uint16_t virtualLeds = 0xFFFF;
+
+static TelemetryPanel_t panel;
+
+static uint8_t buffer[READ_SIZE];
+
+/* === Private function declarations ===========================================================
+ */
+
+/* === Public variable definitions =============================================================
+ */
+
+/* === Private variable definitions ============================================================
+ */
+
+/* === Private function implementation =========================================================
+ */
+
+/**
+ * @brief Reads every pending frame and feeds it to the decoder.
+ *
+ * @return uint16_t Number of bytes read.
+ */
+static uint16_t drain(void) {
+    uint16_t total = 0;
+    uint16_t length;
+    while ((length = Telemetry_read(buffer, sizeof(buffer))) > 0) {
+        for (uint16_t index = 0; index < length; index++) {
+            TelemetryPanel_decode(&panel, buffer[index]);
+        }
+        total += length;
+    }
+    return total;
+}
+
+/* === Public function implementation ==========================================================
+ */
+
+void setUp(void) {
+    Telemetry_init();
+    TelemetryPanel_init(&panel);
+    Leds_init(&virtualLeds);
+    drain();
+}
+
+//! @test Only the writes that change a LED port must produce a frame.
+void test_frames_only_on_change(void) {
+    Leds_turnOnSingle(3);
+    TEST_ASSERT_EQUAL(TELEMETRY_FRAME_SIZE, Telemetry_read(buffer, sizeof(buffer)));
+    TEST_ASSERT_EQUAL_HEX8(TELEMETRY_SYNC, buffer[0]);
+    TEST_ASSERT_EQUAL_HEX8(TELEMETRY_LEDS, buffer[1]);
+    TEST_ASSERT_EQUAL_HEX8(0x04, buffer[3]);
+    Leds_turnOnSingle(3);
+    Leds_setMask(0x0004);
+    TEST_ASSERT_EQUAL(0, Telemetry_read(buffer, sizeof(buffer)));
+}
+
+//! @test The decoder must rebuild the LEDs written through the driver.
+void test_panel_shows_the_driver_port(void) {
+    Leds_writeMasked(0xFFFF, 0x8421);
+    drain();
+    TEST_ASSERT_EQUAL_HEX16(0x8421, panel.leds[0]);
+    Leds_turnOffAllLeds();
+    drain();
+    TEST_ASSERT_EQUAL_HEX16(0x0000, panel.leds[0]);
+    TEST_ASSERT_EQUAL(0, panel.errors);
+}
+
+/* === End of documentation ==================================================================== */
@@ -0,0 +1,125 @@
+/************************************************************************************************
+Copyright (c) 2025, Juan Manuel Guariste <juanmaguariste@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** @file telemetry_view.c
+ ** @brief Host viewer of the front panel telemetry
+ **
+ ** Usage: telemetry_view.elf < /dev/ttyUSB0
+ **
+ ** Reads the frames produced by Telemetry_read() from the standard input, which can be a serial
+ ** port, a semihosting log or a pipe, and redraws the LED ports and the LCD after every block of
+ ** bytes. The terminal must understand ANSI escape sequences.
+ **/
+
+/* === Headers files inclusions =============================================================== */
+
+#include "telemetry.h"
+#include <stdio.h>
+#include <unistd.h>
+
+/* === Macros definitions ====================================================================== */
+
+//! Bytes read from the input at once
+#define READ_SIZE 256
+
+//! LEDs in every port
+#define LEDS_PER_PORT 16
+
+//! Moves the cursor home and clears the terminal
+#define ANSI_HOME "\033[H\033[2J"
+
+//! Draws the following text in bold yellow
+#define ANSI_LIT "\033[1;33m"
+
+//! Restores the default attributes
+#define ANSI_RESET "\033[0m"
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/**
+ * @brief Draws the decoded panel.
+ *
+ * @param panel Panel rebuilt from the frames.
+ *
+ * @return void
+ */
+static void drawPanel(const TelemetryPanel_t * panel);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+void drawPanel(const TelemetryPanel_t * panel) {
+    printf(ANSI_HOME);
+    for (uint8_t port = 0; port < TELEMETRY_LED_PORTS; port++) {
+        printf("port %u  ", port);
+        for (uint8_t led = LEDS_PER_PORT; led > 0; led--) {
+            bool lit = panel->leds[port] & (1U << (led - 1));
+            printf(lit ? ANSI_LIT "o" ANSI_RESET : ".");
+        }
+        printf("  0x%04X\n", panel->leds[port]);
+    }
+    printf("\n+");
+    for (uint8_t column = 0; column < TELEMETRY_LCD_COLUMNS; column++) {
+        putchar('-');
+    }
+    printf("+\n");
+    for (uint8_t row = 0; row < TELEMETRY_LCD_ROWS; row++) {
+        putchar('|');
+        for (uint8_t column = 0; column < TELEMETRY_LCD_COLUMNS; column++) {
+            char character = panel->cells[row][column];
+            putchar((character >= ' ' && character <= '~') ? character : '?');
+        }
+        printf("|\n");
+    }
+    putchar('+');
+    for (uint8_t column = 0; column < TELEMETRY_LCD_COLUMNS; column++) {
+        putchar('-');
+    }
+    printf("+\n\nframes %u  errors %u\n", panel->frames, panel->errors);
+    fflush(stdout);
+}
+
+/* === Public function implementation ========================================================== */
+
+int main(void) {
+    TelemetryPanel_t panel;
+    uint8_t buffer[READ_SIZE];
+    ssize_t length;
+
+    TelemetryPanel_init(&panel);
+    drawPanel(&panel);
+    while ((length = read(STDIN_FILENO, buffer, sizeof(buffer))) > 0) {
+        for (ssize_t index = 0; index < length; index++) {
+            TelemetryPanel_decode(&panel, buffer[index]);
+        }
+        drawPanel(&panel);
+    }
+    return 0;
+}
+
+/* === End of documentation ==================================================================== */
@@ -0,0 +1,78 @@
+/*
+ * API_i2c_bus.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: juanma
+ */
+
+#ifndef API_INC_API_I2C_BUS_H_
+#define API_INC_API_I2C_BUS_H_
+
+#include "stdint.h"
+#include "stdbool.h"
+#include "API_i2c_speed.h"
+
+/* Table sizes */
+#define I2C_BUS_MAX_CLIENTS		4
+#define I2C_BUS_MAX_PENDING		8
+#define I2C_BUS_NO_CLIENT		(-1)
+
+/* Deadline value of a transaction that may wait forever */
+#define I2C_BUS_NO_DEADLINE		0
+
+/* Priorities, lower is more urgent */
+#define I2C_BUS_PRIORITY_URGENT		0
+#define I2C_BUS_PRIORITY_NORMAL		4
+#define I2C_BUS_PRIORITY_BACKGROUND	8
+
+typedef enum
+{
+	I2C_BUS_WRITE,
+	I2C_BUS_READ
+} I2C_BusDirectionTypedef;
+
+/* Performs one bus frame (START, address, data, STOP) with a 7-bit address */
+typedef I2C_ResultTypedef (*I2C_BusTransferTypedef)(uint8_t address,
+                                                    I2C_BusDirectionTypedef direction,
+                                                    uint8_t *data, uint16_t length);
+typedef uint32_t (*I2C_BusClockTypedef)(void);
+typedef void (*I2C_BusDoneTypedef)(I2C_ResultTypedef result, void *context);
+
+typedef struct
+{
+	uint8_t client;
+	uint8_t address;
+	I2C_BusDirectionTypedef direction;
+	uint8_t *data;
+	uint16_t length;
+	uint16_t chunk;			/* Bytes per frame, 0 sends the whole transaction in one frame */
+	uint8_t priority;
+	uint32_t releaseMs;		/* Not started before this time */
+	uint32_t deadlineMs;	/* Failed if not finished by this time, or I2C_BUS_NO_DEADLINE */
+	I2C_BusDoneTypedef done;
+	void *context;
+} I2C_TransactionTypedef;
+
+typedef struct
+{
+	uint32_t transactions;
+	uint32_t bytes;
+	uint32_t busyUs;
+	uint32_t failures;
+	uint32_t deadlineMisses;
+	uint32_t preemptions;
+} I2C_BusClientStatsTypedef;
+
+void I2C_busInit(I2C_BusTransferTypedef transfer, I2C_BusClockTypedef millis,
+                 I2C_BusClockTypedef micros);
+int8_t I2C_busRegisterClient(void);
+bool I2C_busSubmit(const I2C_TransactionTypedef *transaction);
+bool I2C_busService(void);
+I2C_ResultTypedef I2C_busTransfer(uint8_t client, uint8_t priority, uint8_t address,
+                                  I2C_BusDirectionTypedef direction, uint8_t *data,
+                                  uint16_t length);
+bool I2C_busGetClientStats(uint8_t client, I2C_BusClientStatsTypedef *copy);
+uint16_t I2C_busGetOccupancy(uint8_t client);
+void I2C_busResetStats(void);
+
+#endif /* API_INC_API_I2C_BUS_H_ */
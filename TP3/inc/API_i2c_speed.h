@@ -0,0 +1,47 @@
+/*
+ * API_i2c_speed.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: juanma
+ */
+
+#ifndef API_INC_API_I2C_SPEED_H_
+#define API_INC_API_I2C_SPEED_H_
+
+#include "stdint.h"
+#include "stdbool.h"
+
+/* Sliding window (one bit per transfer, so at most 32 transfers) */
+#define I2C_SPEED_WINDOW			32
+#define I2C_SPEED_STEP_DOWN_ERRORS	4
+/* Clean transfers required before probing the next higher speed */
+#define I2C_SPEED_STEP_UP_TRANSFERS	256
+#define I2C_SPEED_STEP_UP_MAX		4096
+#define I2C_SPEED_MAX_LEVELS		4
+
+typedef enum
+{
+	I2C_RESULT_OK,
+	I2C_RESULT_NACK,
+	I2C_RESULT_TIMEOUT,
+	I2C_RESULT_ERROR
+} I2C_ResultTypedef;
+
+typedef struct
+{
+	uint32_t clockSpeed;
+	uint32_t transfers;
+	uint32_t nacks;
+	uint32_t timeouts;
+	uint32_t errors;
+	uint8_t windowErrors;
+	uint32_t stepDowns;
+	uint32_t stepUps;
+} I2C_SpeedStatsTypedef;
+
+void I2C_speedInit(const uint32_t *speeds, uint8_t count);
+uint32_t I2C_speedGetClock(void);
+bool I2C_speedRecord(I2C_ResultTypedef result);
+void I2C_speedGetStats(I2C_SpeedStatsTypedef *copy);
+
+#endif /* API_INC_API_I2C_SPEED_H_ */
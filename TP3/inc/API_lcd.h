@@ -9,6 +9,7 @@
 #define API_INC_API_LCD_H_
 
 #include "API_lcd_port.h"
+#include "API_lcd_charset.h"
 #include "stdio.h"
 /* Control commands*/
 #define CLEAR_DISPLAY 			1
@@ -43,6 +44,8 @@
 #define TO_HIGH_NIBBLE_SHIFT	4
 
 #define ENABLE 					(1<<2)
+#define READ_WRITE				(1<<1)
+#define BUSY_FLAG				(1<<7)
 
 #define LCD_ROW_1_ADDRESS		0x00
 #define LCD_ROW_2_ADDRESS		0x40
@@ -51,6 +54,7 @@
 
 #define LCD_MAX_COLUMNS			16
 #define LCD_CANTIDAD_FILAS		2
+#define LCD_FRAME_SIZE			(LCD_MAX_COLUMNS * LCD_CANTIDAD_FILAS)
 #define NULL_CHAR				'\0'
 
 #define SET_CURSOR				(1<<7)
@@ -61,16 +65,89 @@
 #define INT_TO_ASCII			48
 #define TWO_DECIMALS			100
 
+/* Timing calibration */
+#define LCD_CALIBRATE_TIMING		0
+#define LCD_TIMING_MARGIN_PERCENT	50
+#define LCD_BUSY_TIMEOUT_US			5000
+#define US_PER_MS					1000
+
+/* Fault recovery */
+#define LCD_WRITE_RETRIES			3
+#define LCD_RESYNC_NIBBLES			3
+#define LCD_RECOVERY_DATA_WRITE_US	80		/* 37 us at 270 kHz, slowest oscillator plus margin */
+#define LCD_RECOVERY_CLEAR_HOME_US	3300	/* 1.52 ms at 270 kHz, same scaling */
+#define DDRAM_ADDRESS_MASK			0x7f
+#define BLANK_CHAR					' '
+
+/* Power control */
+#define BACKLIGHT_ON				1
+#define BACKLIGHT_OFF				0
+#define LCD_IDLE_DISABLED			0
+
+/* Custom glyphs (5x8 dots) */
+#define LCD_GLYPH_ROWS				8
+#define LCD_GLYPH_ROW_MASK			0x1f
+
+/* Precompiled assets: every message is 4 expander bytes and a spacer, streamed in bursts of
+ * LCD_BLIT_CHUNK */
+#define LCD_ASSET_BYTES_PER_MSG		5
+#define LCD_BLIT_CHUNK				20
+#define LCD_ASSET_EXECUTION_US		53		/* Data or address command, slowest oscillator */
+#define LCD_I2C_BITS_PER_BYTE		9
+
 typedef enum
 {
 	LCD_OK,
 	LCD_FAIL
 } LCD_StatusTypedef;
 
+typedef struct
+{
+	bool_t calibrated;
+	uint32_t dataWriteMeasuredUs;
+	uint32_t clearHomeMeasuredUs;
+	uint32_t dataWriteUs;
+	uint32_t clearHomeUs;
+} LCD_TimingTypedef;
+
+typedef enum
+{
+	LCD_IDLE_ACTIVE,
+	LCD_IDLE_DIMMED,
+	LCD_IDLE_OFF
+} LCD_IdleStateTypedef;
+
+typedef struct
+{
+	uint32_t retries;
+	uint32_t recoveries;
+	uint32_t failures;
+} LCD_RecoveryStatsTypedef;
+
+/* Screen or glyph set compiled by tools/lcd_assets.c, kept in flash */
+typedef struct
+{
+	const uint8_t *stream;		/* Expander bytes with the backlight bit clear */
+	uint16_t length;
+	const uint8_t *frame;		/* LCD_FRAME_SIZE codes left on screen, NULL if not a screen */
+	const uint32_t *glyphs;		/* Code point of every CGRAM slot, NULL if not a glyph set */
+} LCD_AssetTypedef;
+
 LCD_StatusTypedef LCD_init();
 LCD_StatusTypedef LCD_clear();
 LCD_StatusTypedef LCD_setCursor(uint8_t row, uint8_t col);
 LCD_StatusTypedef LCD_printText(char *ptrText);
 LCD_StatusTypedef LCD_printFormattedText(const char *format, float number);
+LCD_StatusTypedef LCD_drawFrame(const uint8_t *frame);
+LCD_StatusTypedef LCD_defineGlyph(uint8_t slot, const uint8_t *rows, uint32_t codePoint);
+LCD_StatusTypedef LCD_blit(const LCD_AssetTypedef *asset);
+LCD_StatusTypedef LCD_calibrateTiming(void);
+void LCD_getTiming(LCD_TimingTypedef *copy);
+void LCD_getRecoveryStats(LCD_RecoveryStatsTypedef *copy);
+LCD_StatusTypedef LCD_setBacklight(bool_t on, bool_t immediate);
+LCD_StatusTypedef LCD_setDisplay(bool_t on);
+void LCD_setIdleTimeouts(uint32_t backlightMs, uint32_t displayMs);
+LCD_StatusTypedef LCD_idleTask(uint32_t nowMs);
+LCD_IdleStateTypedef LCD_getIdleState(void);
 
 #endif /* API_INC_API_LCD_H_ */
@@ -0,0 +1,40 @@
+/*
+ * API_lcd_charset.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: juanma
+ */
+
+#ifndef API_INC_API_LCD_CHARSET_H_
+#define API_INC_API_LCD_CHARSET_H_
+
+#include "stdint.h"
+#include "stdbool.h"
+
+/* Character ROM fitted to the controller (HD44780UA00 Japanese, HD44780UA02 European) */
+#define LCD_CHARSET_ROM_A00			0
+#define LCD_CHARSET_ROM_A02			1
+#ifndef LCD_CHARSET_ROM
+#define LCD_CHARSET_ROM				LCD_CHARSET_ROM_A00
+#endif
+
+/* Code sent for characters that are neither in the ROM nor bound to a CGRAM glyph */
+#define LCD_CHARSET_REPLACEMENT		'?'
+#define LCD_CHARSET_CGRAM_SLOTS		8
+#define LCD_CHARSET_ASCII_LIMIT		0x80
+#define LCD_CHARSET_NO_GLYPH		0
+
+typedef struct
+{
+	uint32_t codePoint;
+	uint8_t pending;
+	uint8_t length;
+} LCD_Utf8DecoderTypedef;
+
+void LCD_charsetInit(uint8_t rom);
+void LCD_charsetDecoderInit(LCD_Utf8DecoderTypedef *decoder);
+bool LCD_charsetDecode(LCD_Utf8DecoderTypedef *decoder, uint8_t byte, uint8_t *code);
+uint8_t LCD_charsetMap(uint32_t codePoint);
+bool LCD_charsetBindGlyph(uint8_t slot, uint32_t codePoint);
+
+#endif /* API_INC_API_LCD_CHARSET_H_ */
@@ -0,0 +1,30 @@
+/*
+ * API_lcd_layers.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: juanma
+ */
+
+#ifndef API_INC_API_LCD_LAYERS_H_
+#define API_INC_API_LCD_LAYERS_H_
+
+#include "API_lcd.h"
+
+#define LCD_LAYERS_MAX_OVERLAYS		4
+#define LCD_LAYER_NONE				-1
+#define LCD_LAYER_BASE				0
+#define LCD_LAYER_NO_TIMEOUT		0
+
+/* Overlay priorities: the lowest value is drawn on top */
+#define LCD_LAYER_PRIORITY_ALARM	0
+#define LCD_LAYER_PRIORITY_NOTICE	4
+
+void LCD_layersInit(void);
+int8_t LCD_layerOpen(uint8_t priority, uint32_t timeoutMs, bool_t opaque);
+LCD_StatusTypedef LCD_layerWrite(int8_t layer, uint8_t row, uint8_t col, const char *text);
+LCD_StatusTypedef LCD_layerClear(int8_t layer);
+void LCD_layerClose(int8_t layer);
+bool_t LCD_layerIsOpen(int8_t layer);
+LCD_StatusTypedef LCD_layersRender(uint32_t nowMs);
+
+#endif /* API_INC_API_LCD_LAYERS_H_ */
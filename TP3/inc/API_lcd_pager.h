@@ -0,0 +1,39 @@
+/*
+ * API_lcd_pager.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: juanma
+ */
+
+#ifndef API_INC_API_LCD_PAGER_H_
+#define API_INC_API_LCD_PAGER_H_
+
+#include "API_lcd.h"
+
+/* Lines of a message kept in the index, the text beyond them is not shown */
+#define LCD_PAGER_MAX_LINES			32
+#define LCD_PAGER_NO_DWELL			0
+
+typedef struct
+{
+	const char *text;
+	uint16_t lineStart[LCD_PAGER_MAX_LINES];
+	uint16_t lineEnd[LCD_PAGER_MAX_LINES];
+	uint8_t lineCount;
+	uint8_t pageCount;
+	uint8_t page;
+	bool_t truncated;
+	bool_t started;
+	uint32_t dwellMs;
+	uint32_t shownMs;
+} LCD_PagerTypedef;
+
+LCD_StatusTypedef LCD_pagerInit(LCD_PagerTypedef *pager, const char *text, uint32_t dwellMs);
+uint8_t LCD_pagerPageCount(const LCD_PagerTypedef *pager);
+uint8_t LCD_pagerPage(const LCD_PagerTypedef *pager);
+LCD_StatusTypedef LCD_pagerShow(LCD_PagerTypedef *pager, uint8_t page);
+LCD_StatusTypedef LCD_pagerNext(LCD_PagerTypedef *pager);
+LCD_StatusTypedef LCD_pagerPrevious(LCD_PagerTypedef *pager);
+LCD_StatusTypedef LCD_pagerTick(LCD_PagerTypedef *pager, uint32_t nowMs);
+
+#endif /* API_INC_API_LCD_PAGER_H_ */
@@ -11,17 +11,41 @@
 #include "stdint.h"
 #include "stdbool.h"
 #include "stm32f4xx_hal.h"
+#include "API_i2c_speed.h"
+#include "API_i2c_bus.h"
 
 #define LCD_ADDRESS     0x27
 #define I2C_TIMEOUT     10
 #define I2C_INSTANCE    I2C1
-#define I2C_CLOCK_SPEED 100000
+#define I2C_CLOCK_SPEED_FAST     400000
+#define I2C_CLOCK_SPEED_MEDIUM   200000
+#define I2C_CLOCK_SPEED          100000
 #define I2C_TIMEOUT     10
 
+/* I2C1 pins, driven as GPIO during bus recovery */
+#define I2C_GPIO_PORT              GPIOB
+#define I2C_SCL_PIN                GPIO_PIN_8
+#define I2C_SDA_PIN                GPIO_PIN_9
+#define I2C_RECOVERY_CLOCKS        9
+#define I2C_RECOVERY_HALF_PERIOD   5
+
+/* LCD frames yield to any more urgent transaction on the shared bus */
+#define LCD_BUS_PRIORITY           I2C_BUS_PRIORITY_BACKGROUND
+
 typedef bool bool_t;
 
 void LCD_portDelay(uint32_t delay);
+void LCD_portDelayUs(uint32_t delay);
+uint32_t LCD_portGetMicros(void);
 bool_t port_init(void);
 bool_t LCD_portWriteByte(uint8_t byte);
+bool_t LCD_portWriteBurst(uint8_t *bytes, uint16_t length);
+bool_t LCD_portReadByte(uint8_t *byte);
+bool_t LCD_portBusRecovery(void);
+uint32_t port_getClockSpeed(void);
+int8_t port_getLcdClient(void);
+I2C_ResultTypedef port_i2cTransfer(uint8_t address, I2C_BusDirectionTypedef direction,
+                                   uint8_t *data, uint16_t length);
+void port_getStats(I2C_SpeedStatsTypedef *stats);
 
 #endif /* API_INC_API_LCD_PORT_H_ */
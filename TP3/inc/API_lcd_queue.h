@@ -0,0 +1,40 @@
+/*
+ * API_lcd_queue.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: juanma
+ */
+
+#ifndef API_INC_API_LCD_QUEUE_H_
+#define API_INC_API_LCD_QUEUE_H_
+
+#include "API_lcd.h"
+
+/* Queue dimensions (LCD_QUEUE_SLOTS must be a power of two) */
+#define LCD_QUEUE_SLOTS			16
+#define LCD_QUEUE_TEXT_SIZE		(LCD_MAX_COLUMNS * LCD_CANTIDAD_FILAS + 1)
+
+typedef enum
+{
+	LCD_UPDATE_CLEAR,
+	LCD_UPDATE_CURSOR,
+	LCD_UPDATE_TEXT
+} LCD_UpdateTypeTypedef;
+
+typedef struct
+{
+	LCD_UpdateTypeTypedef type;
+	uint8_t row;
+	uint8_t col;
+	char text[LCD_QUEUE_TEXT_SIZE];
+} LCD_UpdateTypedef;
+
+void LCD_queueInit(void);
+LCD_StatusTypedef LCD_queuePost(const LCD_UpdateTypedef *update);
+LCD_StatusTypedef LCD_queuePostText(const char *ptrText);
+LCD_StatusTypedef LCD_queuePop(LCD_UpdateTypedef *update);
+uint32_t LCD_queueDrain(uint32_t maxUpdates);
+uint32_t LCD_queueGetDropped(void);
+uint32_t LCD_queueGetFailed(void);
+
+#endif /* API_INC_API_LCD_QUEUE_H_ */
@@ -0,0 +1,148 @@
+/************************************************************************************************
+Copyright (c) 2025, Juan Manuel Guariste <juanmaguariste@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef APP_TASKS_H
+#define APP_TASKS_H
+
+/** @file app_tasks.h
+ ** @brief Task table of the application: periods, offsets and time budgets
+ **/
+
+/* === Headers files inclusions ================================================================ */
+
+#include "telemetry.h"
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+
+/*
+ * The tasks are added to the scheduler in this order, which is their priority: control, display,
+ * idle, telemetry and bus. The bus service has a 1 ms period, so any task below it would always
+ * find a release less than a display update away and Scheduler_hasBudget() would never let it
+ * work. It goes last: the LCD frames are blocking and already send the more urgent queued
+ * transactions before each frame. The telemetry drain only exists with TELEMETRY_ENABLED.
+ */
+
+//! Period of the control loop, in milliseconds
+#define CONTROL_PERIOD_MS 50
+
+//! First release of the control loop, in milliseconds
+#define CONTROL_OFFSET_MS 0
+
+//! Time budget of the control loop, in microseconds
+#define CONTROL_BUDGET_US 5000
+
+//! Period of the display refresh, in milliseconds
+#define DISPLAY_PERIOD_MS 10
+
+//! First release of the display refresh, in milliseconds
+#define DISPLAY_OFFSET_MS 1
+
+/*
+ * The cost of an update is computed from the bus time, with the timing calibrated by
+ * LCD_calibrateTiming() so the strobes need no delays. A message is four expander frames of
+ * two bytes (address and data) of 9 bits, 720 us at 100 kHz. The worst update is a clear, two
+ * cursor commands and 32 characters, plus the execution of the clear (1.52 ms, 2.3 ms with the
+ * calibration margin). On the target the figure is checked with the maxUs reported by
+ * Scheduler_getStats() for the display task, divided by the updates of the run.
+ */
+
+//! Bus time of one LCD message at 100 kHz, in microseconds
+#define DISPLAY_MESSAGE_US 720
+
+//! Messages of the worst queued update: clear, two cursor commands and a full screen
+#define DISPLAY_UPDATE_MESSAGES 35
+
+//! Execution time of the clear command with the calibration margin, in microseconds
+#define DISPLAY_CLEAR_US 2300
+
+//! Worst case of one queued update, in microseconds
+#define DISPLAY_UPDATE_COST_US (DISPLAY_UPDATE_MESSAGES * DISPLAY_MESSAGE_US + DISPLAY_CLEAR_US)
+
+//! Queued updates that fit in one run of the display refresh
+#define DISPLAY_UPDATES_PER_RUN 2
+
+//! Time of a display run besides the updates: budget checks, dequeue and copy of the updates
+#define DISPLAY_RUN_OVERHEAD_US 500
+
+//! Time budget of the display refresh
+#define DISPLAY_BUDGET_US                                                                          \
+    (DISPLAY_UPDATES_PER_RUN * DISPLAY_UPDATE_COST_US + DISPLAY_RUN_OVERHEAD_US)
+
+//! Period of the display idle timeouts, in milliseconds
+#define IDLE_PERIOD_MS 100
+
+//! First release of the display idle timeouts, in milliseconds
+#define IDLE_OFFSET_MS 5
+
+//! Time budget of the display idle timeouts, one backlight or display command
+#define IDLE_BUDGET_US 2000
+
+//! Period of the telemetry drain, in milliseconds
+#define TELEMETRY_PERIOD_MS 20
+
+//! First release of the telemetry drain, in milliseconds
+#define TELEMETRY_OFFSET_MS 3
+
+//! Baud rate of the UART that carries the telemetry frames
+#define TELEMETRY_BAUD_RATE 115200
+
+//! Frames read from the ring and sent to the UART at once
+#define TELEMETRY_CHUNK_FRAMES 4
+
+//! Worst case of sending one chunk: 10 bit times per byte, rounded up
+#define TELEMETRY_CHUNK_COST_US                                                                    \
+    ((TELEMETRY_CHUNK_FRAMES * TELEMETRY_FRAME_SIZE * 10 * 1000000 + TELEMETRY_BAUD_RATE - 1) /    \
+     TELEMETRY_BAUD_RATE)
+
+//! Time budget of the telemetry drain
+#define TELEMETRY_BUDGET_US (2 * TELEMETRY_CHUNK_COST_US)
+
+//! Period of the shared I2C bus service, in milliseconds
+#define BUS_PERIOD_MS 1
+
+//! First release of the shared I2C bus service, in milliseconds
+#define BUS_OFFSET_MS 0
+
+//! Worst case of one queued bus frame: 16 bytes on a 100 kHz bus
+#define BUS_FRAME_COST_US 1600
+
+//! Time budget of the shared I2C bus service
+#define BUS_BUDGET_US (4 * BUS_FRAME_COST_US)
+
+/* === Public data type declarations =========================================================== */
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+
+/* === End of documentation ==================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* APP_TASKS_H */
@@ -0,0 +1,309 @@
+/*
+ * API_i2c_bus.c
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: juanma
+ */
+#include "API_i2c_bus.h"
+#include "string.h"
+
+/*
+ * The bus manager is the only caller of the transfer routine of the peripheral. Clients either
+ * submit transactions, which wait in a small table and are sent by I2C_busService(), or call
+ * I2C_busTransfer() for a blocking frame. Before every blocking frame the manager first sends
+ * the due transactions that are more urgent, so a long burst of single-byte frames (the LCD)
+ * is split at frame boundaries. A frame boundary is always safe for the LCD: the expander
+ * keeps its outputs between frames and the HD44780 timings are only minimums.
+ */
+
+#define OCCUPANCY_SCALE			1000
+
+typedef struct
+{
+	bool used;
+	uint16_t sent;
+	I2C_TransactionTypedef transaction;
+} I2C_BusSlotTypedef;
+
+static bool I2C_busTimeReached(uint32_t now, uint32_t time);
+static bool I2C_busMoreUrgent(const I2C_BusSlotTypedef *slot, const I2C_BusSlotTypedef *other);
+static I2C_BusSlotTypedef *I2C_busSelect(uint32_t now);
+static I2C_ResultTypedef I2C_busFrame(uint8_t client, uint8_t address,
+                                      I2C_BusDirectionTypedef direction, uint8_t *data,
+                                      uint16_t length);
+static void I2C_busFinish(I2C_BusSlotTypedef *slot, I2C_ResultTypedef result);
+static bool I2C_busServiceAbove(uint8_t priority);
+
+static I2C_BusTransferTypedef transferFrame;
+static I2C_BusClockTypedef millisClock;
+static I2C_BusClockTypedef microsClock;
+static I2C_BusSlotTypedef slots[I2C_BUS_MAX_PENDING];
+static I2C_BusClientStatsTypedef clients[I2C_BUS_MAX_CLIENTS];
+static uint8_t clientCount;
+static I2C_BusSlotTypedef *current;
+static uint32_t windowStartUs;
+
+/**
+ * @brief Initializes the bus manager with an empty transaction table and no clients.
+ *
+ * @param transfer Routine that performs one frame on the peripheral.
+ * @param millis Millisecond tick used for releases and deadlines.
+ * @param micros Microsecond counter used to measure the bus occupancy.
+ * @return void
+ */
+void I2C_busInit(I2C_BusTransferTypedef transfer, I2C_BusClockTypedef millis,
+                 I2C_BusClockTypedef micros) {
+    transferFrame = transfer;
+    millisClock = millis;
+    microsClock = micros;
+    memset(slots, 0, sizeof(slots));
+    memset(clients, 0, sizeof(clients));
+    clientCount = 0;
+    current = NULL;
+    windowStartUs = microsClock();
+}
+
+/**
+ * @brief Registers a client of the bus, the number is used to account its bus time.
+ *
+ * @param void
+ * @return int8_t Client number, I2C_BUS_NO_CLIENT if I2C_BUS_MAX_CLIENTS are registered.
+ */
+int8_t I2C_busRegisterClient(void) {
+    if (clientCount >= I2C_BUS_MAX_CLIENTS)
+        return (I2C_BUS_NO_CLIENT);
+    return ((int8_t)clientCount++);
+}
+
+/**
+ * @brief Queues a transaction to be sent by I2C_busService().
+ *
+ * The data must stay valid until the done callback is called. A chunked transaction is sent in
+ * frames of chunk bytes and a more urgent transaction may go between two of them, so chunk must
+ * only be used with devices that accept the data split in frames (an I/O expander, not an
+ * EEPROM page). Must not be called from interrupt handlers.
+ *
+ * @param transaction Transaction to copy into the table.
+ * @return bool Returns true if the transaction was queued, false if it is invalid or the table
+ * is full.
+ */
+bool I2C_busSubmit(const I2C_TransactionTypedef *transaction) {
+    if (transaction == NULL || transaction->client >= clientCount || transaction->data == NULL ||
+        transaction->length == 0)
+        return (false);
+    for (uint8_t index = 0; index < I2C_BUS_MAX_PENDING; index++) {
+        if (!slots[index].used) {
+            slots[index].transaction = *transaction;
+            slots[index].sent = 0;
+            slots[index].used = true;
+            return (true);
+        }
+    }
+    return (false);
+}
+
+/**
+ * @brief Sends one frame of the most urgent due transaction.
+ *
+ * Transactions are ordered by priority and then by deadline. A transaction whose deadline has
+ * passed is finished with I2C_RESULT_TIMEOUT without using the bus.
+ *
+ * @param void
+ * @return bool Returns true if a transaction was sent or finished, false if none was due.
+ */
+bool I2C_busService(void) {
+    I2C_BusSlotTypedef *slot = I2C_busSelect(millisClock());
+    if (slot == NULL)
+        return (false);
+
+    I2C_TransactionTypedef *transaction = &slot->transaction;
+    if (transaction->deadlineMs != I2C_BUS_NO_DEADLINE &&
+        !I2C_busTimeReached(transaction->deadlineMs, millisClock())) {
+        clients[transaction->client].deadlineMisses++;
+        I2C_busFinish(slot, I2C_RESULT_TIMEOUT);
+        return (true);
+    }
+
+    if (current != NULL && current != slot && current->used)
+        clients[current->transaction.client].preemptions++;
+    current = slot;
+
+    uint16_t length = transaction->length - slot->sent;
+    if (transaction->chunk != 0 && length > transaction->chunk)
+        length = transaction->chunk;
+    I2C_ResultTypedef result = I2C_busFrame(transaction->client, transaction->address,
+                                            transaction->direction,
+                                            transaction->data + slot->sent, length);
+    slot->sent += length;
+    if (result != I2C_RESULT_OK || slot->sent == transaction->length)
+        I2C_busFinish(slot, result);
+    return (true);
+}
+
+/**
+ * @brief Performs a blocking frame for a client.
+ *
+ * Due transactions with a priority more urgent than the given one are sent first.
+ *
+ * @param client Client number returned by I2C_busRegisterClient().
+ * @param priority Priority of the frame.
+ * @param address 7-bit address of the device.
+ * @param direction Write or read.
+ * @param data Data to write or where to store the data read.
+ * @param length Number of bytes.
+ * @return I2C_ResultTypedef Outcome of the frame.
+ */
+I2C_ResultTypedef I2C_busTransfer(uint8_t client, uint8_t priority, uint8_t address,
+                                  I2C_BusDirectionTypedef direction, uint8_t *data,
+                                  uint16_t length) {
+    if (client >= clientCount || data == NULL)
+        return (I2C_RESULT_ERROR);
+    while (I2C_busServiceAbove(priority)) {
+    }
+    I2C_ResultTypedef result = I2C_busFrame(client, address, direction, data, length);
+    clients[client].transactions++;
+    if (result != I2C_RESULT_OK)
+        clients[client].failures++;
+    return (result);
+}
+
+/**
+ * @brief Copies the bus usage counters of a client.
+ *
+ * @param client Client number returned by I2C_busRegisterClient().
+ * @param copy Where to copy the counters.
+ * @return bool Returns true if the client exists.
+ */
+bool I2C_busGetClientStats(uint8_t client, I2C_BusClientStatsTypedef *copy) {
+    if (client >= clientCount || copy == NULL)
+        return (false);
+    *copy = clients[client];
+    return (true);
+}
+
+/**
+ * @brief Returns the share of time a client kept the bus busy since the last reset.
+ *
+ * @param client Client number returned by I2C_busRegisterClient().
+ * @return uint16_t Bus occupancy in parts per thousand.
+ */
+uint16_t I2C_busGetOccupancy(uint8_t client) {
+    uint32_t elapsed = microsClock() - windowStartUs;
+    if (client >= clientCount || elapsed == 0)
+        return (0);
+    return ((uint16_t)(((uint64_t)clients[client].busyUs * OCCUPANCY_SCALE) / elapsed));
+}
+
+/**
+ * @brief Clears the counters of every client and starts a new occupancy window.
+ *
+ * The counters are 32 bits wide, so the window must be restarted at least every 71 minutes.
+ *
+ * @param void
+ * @return void
+ */
+void I2C_busResetStats(void) {
+    memset(clients, 0, sizeof(clients));
+    windowStartUs = microsClock();
+}
+
+/**
+ * @brief Checks that a time has been reached, with wrap-around.
+ *
+ * @param now Current time.
+ * @param time Time to check.
+ * @return bool Returns true if now is at or after time.
+ */
+static bool I2C_busTimeReached(uint32_t now, uint32_t time) {
+    return ((int32_t)(now - time) >= 0);
+}
+
+/**
+ * @brief Orders two transactions by priority and then by deadline.
+ *
+ * @param slot Transaction to compare.
+ * @param other Transaction to compare with.
+ * @return bool Returns true if slot must be sent before other.
+ */
+static bool I2C_busMoreUrgent(const I2C_BusSlotTypedef *slot, const I2C_BusSlotTypedef *other) {
+    const I2C_TransactionTypedef *first = &slot->transaction;
+    const I2C_TransactionTypedef *second = &other->transaction;
+    if (first->priority != second->priority)
+        return (first->priority < second->priority);
+    if (first->deadlineMs == I2C_BUS_NO_DEADLINE)
+        return (false);
+    if (second->deadlineMs == I2C_BUS_NO_DEADLINE)
+        return (true);
+    return ((int32_t)(first->deadlineMs - second->deadlineMs) < 0);
+}
+
+/**
+ * @brief Finds the most urgent transaction that has been released.
+ *
+ * @param now Current time in milliseconds.
+ * @return I2C_BusSlotTypedef* Slot of the transaction, NULL if none is due.
+ */
+static I2C_BusSlotTypedef *I2C_busSelect(uint32_t now) {
+    I2C_BusSlotTypedef *selected = NULL;
+    for (uint8_t index = 0; index < I2C_BUS_MAX_PENDING; index++) {
+        I2C_BusSlotTypedef *slot = &slots[index];
+        if (slot->used && I2C_busTimeReached(now, slot->transaction.releaseMs) &&
+            (selected == NULL || I2C_busMoreUrgent(slot, selected)))
+            selected = slot;
+    }
+    return (selected);
+}
+
+/**
+ * @brief Performs one frame and charges its bus time to a client.
+ *
+ * @param client Client that owns the frame.
+ * @param address 7-bit address of the device.
+ * @param direction Write or read.
+ * @param data Data to write or where to store the data read.
+ * @param length Number of bytes.
+ * @return I2C_ResultTypedef Outcome of the frame.
+ */
+static I2C_ResultTypedef I2C_busFrame(uint8_t client, uint8_t address,
+                                      I2C_BusDirectionTypedef direction, uint8_t *data,
+                                      uint16_t length) {
+    uint32_t start = microsClock();
+    I2C_ResultTypedef result = transferFrame(address, direction, data, length);
+    clients[client].busyUs += microsClock() - start;
+    clients[client].bytes += length;
+    return (result);
+}
+
+/**
+ * @brief Frees the slot of a transaction and reports its outcome.
+ *
+ * The slot is freed before the callback, so the callback may submit the next transaction.
+ *
+ * @param slot Slot of the transaction.
+ * @param result Outcome reported to the client.
+ * @return void
+ */
+static void I2C_busFinish(I2C_BusSlotTypedef *slot, I2C_ResultTypedef result) {
+    I2C_TransactionTypedef transaction = slot->transaction;
+    slot->used = false;
+    if (current == slot)
+        current = NULL;
+    clients[transaction.client].transactions++;
+    if (result != I2C_RESULT_OK)
+        clients[transaction.client].failures++;
+    if (transaction.done != NULL)
+        transaction.done(result, transaction.context);
+}
+
+/**
+ * @brief Sends one frame of a due transaction only if it is more urgent than a priority.
+ *
+ * @param priority Priority to compare with.
+ * @return bool Returns true if a frame was sent or a transaction finished.
+ */
+static bool I2C_busServiceAbove(uint8_t priority) {
+    I2C_BusSlotTypedef *slot = I2C_busSelect(millisClock());
+    if (slot == NULL || slot->transaction.priority >= priority)
+        return (false);
+    return (I2C_busService());
+}
@@ -0,0 +1,121 @@
+/*
+ * API_i2c_speed.c
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: juanma
+ */
+#include "API_i2c_speed.h"
+#include "string.h"
+
+#define WINDOW_OLDEST_BIT		(1UL << (I2C_SPEED_WINDOW - 1))
+
+static void I2C_speedChangeLevel(uint8_t level);
+
+static uint32_t speedTable[I2C_SPEED_MAX_LEVELS];
+static uint8_t speedCount;
+static uint8_t speedLevel;
+static uint32_t errorHistory;
+static uint32_t cleanTransfers;
+static uint32_t stepUpThreshold;
+static I2C_SpeedStatsTypedef stats;
+
+/**
+ * @brief Initializes the clock negotiation and selects the highest speed.
+ *
+ * @param speeds Allowed clock speeds in Hz, sorted from the highest to the lowest.
+ * @param count Number of entries in speeds (at most I2C_SPEED_MAX_LEVELS).
+ * @return void
+ */
+void I2C_speedInit(const uint32_t *speeds, uint8_t count) {
+    if (count > I2C_SPEED_MAX_LEVELS)
+        count = I2C_SPEED_MAX_LEVELS;
+    memcpy(speedTable, speeds, count * sizeof(speedTable[0]));
+    speedCount = count;
+    memset(&stats, 0, sizeof(stats));
+    stepUpThreshold = I2C_SPEED_STEP_UP_TRANSFERS;
+    I2C_speedChangeLevel(0);
+}
+
+/**
+ * @brief Returns the clock speed the bus should be running at.
+ *
+ * @param void
+ * @return uint32_t Clock speed in Hz.
+ */
+uint32_t I2C_speedGetClock(void) {
+    return (stats.clockSpeed);
+}
+
+/**
+ * @brief Records the outcome of a transfer and decides whether the clock must change.
+ *
+ * Steps one level down when I2C_SPEED_STEP_DOWN_ERRORS of the last I2C_SPEED_WINDOW transfers
+ * failed, and one level up after a run of clean transfers. Each step down doubles the clean run
+ * required to probe upwards again, so a marginal bus does not keep bouncing between speeds.
+ *
+ * @param result Outcome of the transfer.
+ * @return bool Returns true if the caller must re-initialize the bus at I2C_speedGetClock().
+ */
+bool I2C_speedRecord(I2C_ResultTypedef result) {
+    uint32_t failed = (result != I2C_RESULT_OK);
+
+    stats.transfers++;
+    switch (result) {
+    case I2C_RESULT_NACK:
+        stats.nacks++;
+        break;
+    case I2C_RESULT_TIMEOUT:
+        stats.timeouts++;
+        break;
+    case I2C_RESULT_ERROR:
+        stats.errors++;
+        break;
+    default:
+        break;
+    }
+
+    if (errorHistory & WINDOW_OLDEST_BIT)
+        stats.windowErrors--;
+    errorHistory = (errorHistory << 1) | failed;
+    stats.windowErrors += failed;
+    cleanTransfers = failed ? 0 : cleanTransfers + 1;
+
+    if (stats.windowErrors >= I2C_SPEED_STEP_DOWN_ERRORS && speedLevel + 1 < speedCount) {
+        stats.stepDowns++;
+        if (stepUpThreshold < I2C_SPEED_STEP_UP_MAX)
+            stepUpThreshold <<= 1;
+        I2C_speedChangeLevel(speedLevel + 1);
+        return (true);
+    }
+    if (cleanTransfers >= stepUpThreshold && speedLevel > 0) {
+        stats.stepUps++;
+        I2C_speedChangeLevel(speedLevel - 1);
+        return (true);
+    }
+    return (false);
+}
+
+/**
+ * @brief Copies the current speed and error counters.
+ *
+ * @param copy Where to copy the counters.
+ * @return void
+ */
+void I2C_speedGetStats(I2C_SpeedStatsTypedef *copy) {
+    if (copy != NULL)
+        *copy = stats;
+}
+
+/**
+ * @brief Moves to another speed level and starts a fresh error window.
+ *
+ * @param level Index in the speed table.
+ * @return void
+ */
+static void I2C_speedChangeLevel(uint8_t level) {
+    speedLevel = level;
+    stats.clockSpeed = (speedCount > 0) ? speedTable[level] : 0;
+    stats.windowErrors = 0;
+    errorHistory = 0;
+    cleanTransfers = 0;
+}
@@ -5,12 +5,27 @@
  *      Author: juanma
  */
 #include "API_lcd.h"
+#include "profile.h"
+#include "telemetry.h"
+#include "string.h"
 
 static void LCD_delay(uint8_t delay);
 static LCD_StatusTypedef LCD_sendNibble(uint8_t data, uint8_t rs);
 static LCD_StatusTypedef LCD_sendMsg(uint8_t data, uint8_t rs);
+static LCD_StatusTypedef LCD_transferMsg(uint8_t data, uint8_t rs);
 static LCD_StatusTypedef LCD_sendByte(uint8_t byte);
+static bool_t LCD_writeExpander(uint8_t byte);
 static LCD_StatusTypedef LCD_printChar(char dato);
+static void LCD_waitExecution(uint8_t data, uint8_t rs);
+static LCD_StatusTypedef LCD_readBusyFlag(bool_t *busy);
+static LCD_StatusTypedef LCD_measureExecution(uint8_t data, uint8_t rs, uint32_t *elapsed);
+static uint32_t LCD_addMargin(uint32_t measured);
+static void LCD_trackMsg(uint8_t data, uint8_t rs);
+static LCD_StatusTypedef LCD_recover(void);
+static LCD_StatusTypedef LCD_resync(void);
+static LCD_StatusTypedef LCD_repaint(void);
+static LCD_StatusTypedef LCD_wake(void);
+static LCD_StatusTypedef LCD_applyBacklight(void);
 
 static const uint8_t LCD_INIT_CMD[] = {_4BIT_MODE,
                                        DISPLAY_CONTROL,
@@ -19,7 +34,45 @@ static const uint8_t LCD_INIT_CMD[] = {_4BIT_MODE,
                                        DISPLAY_CONTROL | DISPLAY_ON,
                                        CLEAR_DISPLAY};
 
-static uint8_t backLight = 1;
+static uint8_t backLight = BACKLIGHT_ON;
+static uint8_t backLightRequested = BACKLIGHT_ON;
+static uint8_t displayControl = DISPLAY_CONTROL | DISPLAY_ON;
+static bool_t displayRequested = true;
+
+/* Inactivity timer: public calls only raise a flag, LCD_idleTask() turns it into a time stamp */
+static uint32_t idleBacklightMs = LCD_IDLE_DISABLED;
+static uint32_t idleDisplayMs = LCD_IDLE_DISABLED;
+static uint32_t lastActivityMs;
+static bool_t activity = true;
+static LCD_IdleStateTypedef idleState = LCD_IDLE_ACTIVE;
+
+/* Until the timing is calibrated every strobe is followed by the worst-case DELAY1ms */
+static const LCD_TimingTypedef LCD_DEFAULT_TIMING = {.calibrated = false,
+                                                     .dataWriteUs = DELAY1ms * US_PER_MS,
+                                                     .clearHomeUs = DELAY1ms * US_PER_MS};
+static LCD_TimingTypedef timing = LCD_DEFAULT_TIMING;
+static bool_t strobeDelays = true;
+
+/* Worst-case execution times waited in microseconds while recovering with uncalibrated timing */
+static const LCD_TimingTypedef LCD_RECOVERY_TIMING = {.calibrated = true,
+                                                      .dataWriteUs = LCD_RECOVERY_DATA_WRITE_US,
+                                                      .clearHomeUs = LCD_RECOVERY_CLEAR_HOME_US};
+
+_Static_assert(LCD_BLIT_CHUNK % LCD_ASSET_BYTES_PER_MSG == 0,
+               "A burst must end between two messages, with E low");
+_Static_assert((LCD_ASSET_BYTES_PER_MSG - 2) * LCD_I2C_BITS_PER_BYTE * 1000000UL /
+                       I2C_CLOCK_SPEED_FAST >=
+                   LCD_ASSET_EXECUTION_US,
+               "A message must execute before the next high nibble is latched");
+
+static const uint8_t LCD_ROW_ADDRESS[LCD_CANTIDAD_FILAS] = {LCD_ROW_1_ADDRESS, LCD_ROW_2_ADDRESS};
+
+/* RAM copy of the visible DDRAM, used to repaint the display after a resync */
+static char screen[LCD_CANTIDAD_FILAS][LCD_MAX_COLUMNS];
+static uint8_t cursorAddress;
+static bool_t cgramSelected;
+static bool_t initialized = false;
+static LCD_RecoveryStatsTypedef recovery;
 
 /**
  * @brief Initializes the LCD.
@@ -33,6 +86,15 @@ static uint8_t backLight = 1;
  * LCD_FAIL.
  */
 LCD_StatusTypedef LCD_init(void) {
+    PROFILE_FUNCTION();
+    timing = LCD_DEFAULT_TIMING;
+    strobeDelays = true;
+    initialized = false;
+    displayControl = DISPLAY_CONTROL | DISPLAY_ON;
+    displayRequested = true;
+    backLight = backLightRequested;
+    idleState = LCD_IDLE_ACTIVE;
+    activity = true;
     bool_t estadoI2C = port_init();
     if (estadoI2C == false)
         return (LCD_FAIL);
@@ -52,6 +114,10 @@ LCD_StatusTypedef LCD_init(void) {
         if (LCD_sendMsg(LCD_INIT_CMD[index], COMMAND) == LCD_FAIL)
             return (LCD_FAIL);
     }
+    initialized = true;
+#if LCD_CALIBRATE_TIMING
+    LCD_calibrateTiming();
+#endif
     return (LCD_OK);
 }
 
@@ -65,6 +131,9 @@ LCD_StatusTypedef LCD_init(void) {
  * @return LCD_StatusTypedef Returns LCD_OK if the LCD was cleared correctly, otherwise LCD_FAIL.
  */
 LCD_StatusTypedef LCD_clear(void) {
+    PROFILE_FUNCTION();
+    if (LCD_wake() == LCD_FAIL)
+        return (LCD_FAIL);
     return (LCD_sendMsg(CLEAR_DISPLAY, COMMAND));
 }
 
@@ -77,6 +146,9 @@ LCD_StatusTypedef LCD_clear(void) {
  * LCD_FAIL.
  */
 LCD_StatusTypedef LCD_setCursor(uint8_t row, uint8_t col) {
+    PROFILE_FUNCTION();
+    if (LCD_wake() == LCD_FAIL)
+        return (LCD_FAIL);
     switch (row) {
     case LCD_ROW_1:
         LCD_sendMsg((LCD_ROW_1_ADDRESS + col) | SET_DDRAM_ADDRESS, COMMAND);
@@ -94,16 +166,23 @@ LCD_StatusTypedef LCD_setCursor(uint8_t row, uint8_t col) {
 /**
  * @brief Prints text on the LCD.
  *
+ * The text is UTF-8: every character is translated to the character ROM of the controller, or to
+ * a CGRAM glyph defined with LCD_defineGlyph(), while it is sent.
+ *
  * @param ptrText Pointer to the text to print.
  * @return LCD_StatusTypedef Returns LCD_OK if the text was printed correctly, otherwise LCD_FAIL.
  */
 LCD_StatusTypedef LCD_printText(char * ptrText) {
+    PROFILE_FUNCTION();
     if (ptrText == NULL)
         return (LCD_FAIL);
     LCD_clear();
     LCD_setCursor(LCD_ROW_1, LCD_COL_0);
     uint8_t row = LCD_ROW_1;
     uint8_t columnPosition = 0;
+    uint8_t code;
+    LCD_Utf8DecoderTypedef decoder;
+    LCD_charsetDecoderInit(&decoder);
     while (*ptrText != NULL_CHAR) {
         if (*ptrText == '\n') {
             row = (row == LCD_ROW_1) ? LCD_ROW_2 : LCD_ROW_1;
@@ -112,7 +191,9 @@ LCD_StatusTypedef LCD_printText(char * ptrText) {
             ptrText++;
             continue;
         }
-        if (LCD_printChar(*ptrText++) == LCD_FAIL)
+        if (!LCD_charsetDecode(&decoder, (uint8_t)*ptrText++, &code))
+            continue;
+        if (LCD_printChar(code) == LCD_FAIL)
             return (LCD_FAIL);
         columnPosition++;
         if (columnPosition >= LCD_MAX_COLUMNS) {
@@ -136,6 +217,7 @@ LCD_StatusTypedef LCD_printText(char * ptrText) {
  * @return LCD_StatusTypedef Returns LCD_OK if the text was printed correctly, otherwise LCD_FAIL.
  */
 LCD_StatusTypedef LCD_printFormattedText(const char * format, float number) {
+    PROFILE_FUNCTION();
     char buffer[32];
     uint8_t integerPart = (uint8_t)number;
     uint8_t decimalPart =
@@ -144,6 +226,287 @@ LCD_StatusTypedef LCD_printFormattedText(const char * format, float number) {
             decimalPart); // Format the string, ensuring the format matches the types used
     return (LCD_printText(buffer));
 }
+
+/**
+ * @brief Brings the display to a new frame, sending only the cells that differ from it.
+ *
+ * The frame is compared with the RAM copy of the display. Changed cells that follow each other
+ * share a single cursor command, since the address counter auto-increments; when nothing
+ * changed the bus is not touched and the display is not woken up.
+ *
+ * @param frame LCD_FRAME_SIZE character codes, row by row.
+ * @return LCD_StatusTypedef Returns LCD_OK if the display shows the frame, otherwise LCD_FAIL.
+ */
+LCD_StatusTypedef LCD_drawFrame(const uint8_t *frame) {
+    PROFILE_FUNCTION();
+    if (frame == NULL)
+        return (LCD_FAIL);
+    bool_t awake = false;
+    for (uint8_t row = 0; row < LCD_CANTIDAD_FILAS; row++) {
+        for (uint8_t col = 0; col < LCD_MAX_COLUMNS; col++) {
+            uint8_t code = frame[row * LCD_MAX_COLUMNS + col];
+            if (code == (uint8_t)screen[row][col])
+                continue;
+            if (!awake && LCD_wake() == LCD_FAIL)
+                return (LCD_FAIL);
+            awake = true;
+            uint8_t address = LCD_ROW_ADDRESS[row] + col;
+            if ((cgramSelected || cursorAddress != address) &&
+                LCD_sendMsg(address | SET_DDRAM_ADDRESS, COMMAND) == LCD_FAIL)
+                return (LCD_FAIL);
+            if (LCD_sendMsg(code, DATA) == LCD_FAIL)
+                return (LCD_FAIL);
+        }
+    }
+    return (LCD_OK);
+}
+
+/**
+ * @brief Writes a custom glyph to CGRAM and uses it for a character missing from the ROM.
+ *
+ * The cursor is restored afterwards. If a transfer fails the display is recovered, but the glyph
+ * is not written again: the caller must retry.
+ *
+ * @param slot CGRAM slot, from 0 to LCD_CHARSET_CGRAM_SLOTS - 1.
+ * @param rows LCD_GLYPH_ROWS rows of 5 pixels (LCD_GLYPH_ROW_MASK), the top row first.
+ * @param codePoint Unicode code point drawn with the glyph.
+ * @return LCD_StatusTypedef Returns LCD_OK if the glyph was written, otherwise LCD_FAIL.
+ */
+LCD_StatusTypedef LCD_defineGlyph(uint8_t slot, const uint8_t *rows, uint32_t codePoint) {
+    PROFILE_FUNCTION();
+    if (rows == NULL || slot >= LCD_CHARSET_CGRAM_SLOTS || LCD_wake() == LCD_FAIL)
+        return (LCD_FAIL);
+    uint8_t cursor = cursorAddress;
+    /* No retry inside the sequence: after a recovery the address counter points to DDRAM */
+    bool_t written =
+        (LCD_transferMsg(SET_CGRAM_ADDRESS | (slot * LCD_GLYPH_ROWS), COMMAND) == LCD_OK);
+    for (uint8_t row = 0; written && row < LCD_GLYPH_ROWS; row++)
+        written = (LCD_transferMsg(rows[row] & LCD_GLYPH_ROW_MASK, DATA) == LCD_OK);
+    if (!written) {
+        if (initialized)
+            LCD_recover();
+        return (LCD_FAIL);
+    }
+    if (LCD_sendMsg(cursor | SET_DDRAM_ADDRESS, COMMAND) == LCD_FAIL)
+        return (LCD_FAIL);
+    LCD_charsetBindGlyph(slot, codePoint);
+    return (LCD_OK);
+}
+
+/**
+ * @brief Streams a precompiled screen or glyph set to the display.
+ *
+ * The stream is sent in bursts of LCD_BLIT_CHUNK bytes with the backlight bit added, without
+ * any formatting or encoding at run time. Assets only hold data and address commands, which
+ * take up to LCD_ASSET_EXECUTION_US. A message executes when E falls on its fourth byte and
+ * the next high nibble is latched by the second byte of the next message; the spacer byte
+ * after every message makes that three bytes, 67.5 us at I2C_CLOCK_SPEED_FAST, the fastest
+ * speed the bus negotiates, so no delays are needed.
+ *
+ * Every stream ends selecting the first cell of DDRAM. On success the RAM copy of the screen
+ * and the glyph bindings are updated from the asset. If a burst fails the display is recovered
+ * with the previous contents and the caller must retry.
+ *
+ * @param asset Asset generated by tools/lcd_assets.c.
+ * @return LCD_StatusTypedef Returns LCD_OK if the asset was sent, otherwise LCD_FAIL.
+ */
+LCD_StatusTypedef LCD_blit(const LCD_AssetTypedef *asset) {
+    PROFILE_FUNCTION();
+    if (asset == NULL || asset->stream == NULL || asset->length % LCD_ASSET_BYTES_PER_MSG != 0 ||
+        LCD_wake() == LCD_FAIL)
+        return (LCD_FAIL);
+    uint8_t chunk[LCD_BLIT_CHUNK];
+    for (uint16_t offset = 0; offset < asset->length; offset += LCD_BLIT_CHUNK) {
+        uint16_t size = asset->length - offset;
+        if (size > LCD_BLIT_CHUNK)
+            size = LCD_BLIT_CHUNK;
+        for (uint16_t index = 0; index < size; index++)
+            chunk[index] = asset->stream[offset + index] | (backLight << BACKLIGHT_SHIFT);
+        if (!LCD_portWriteBurst(chunk, size)) {
+            if (initialized)
+                LCD_recover();
+            return (LCD_FAIL);
+        }
+    }
+    cursorAddress = LCD_ROW_1_ADDRESS;
+    cgramSelected = false;
+    if (asset->frame != NULL) {
+        for (uint8_t row = 0; row < LCD_CANTIDAD_FILAS; row++) {
+            for (uint8_t col = 0; col < LCD_MAX_COLUMNS; col++) {
+                screen[row][col] = asset->frame[row * LCD_MAX_COLUMNS + col];
+                TELEMETRY_LCD_CELL(row, col, screen[row][col]);
+            }
+        }
+    }
+    for (uint8_t slot = 0; asset->glyphs != NULL && slot < LCD_CHARSET_CGRAM_SLOTS; slot++) {
+        if (asset->glyphs[slot] != LCD_CHARSET_NO_GLYPH)
+            LCD_charsetBindGlyph(slot, asset->glyphs[slot]);
+    }
+    return (LCD_OK);
+}
+/**
+ * @brief Measures the controller execution times using the busy flag.
+ *
+ * Writes a blank character and clears the display, timing how long the busy flag stays set
+ * after each one. The measured times plus LCD_TIMING_MARGIN_PERCENT replace the worst-case
+ * delays for the rest of the session. If the busy flag cannot be read the default delays are
+ * kept. Must be called after LCD_init(); it leaves the display cleared.
+ *
+ * @param void This function does not take any parameters.
+ * @return LCD_StatusTypedef Returns LCD_OK if the timing was calibrated, otherwise LCD_FAIL.
+ */
+LCD_StatusTypedef LCD_calibrateTiming(void) {
+    PROFILE_FUNCTION();
+    uint32_t dataWrite;
+    uint32_t clearHome;
+
+    timing = LCD_DEFAULT_TIMING;
+    strobeDelays = false;
+    if (LCD_measureExecution(' ', DATA, &dataWrite) == LCD_FAIL ||
+        LCD_measureExecution(CLEAR_DISPLAY, COMMAND, &clearHome) == LCD_FAIL) {
+        strobeDelays = true;
+        return (LCD_FAIL);
+    }
+    timing.dataWriteMeasuredUs = dataWrite;
+    timing.clearHomeMeasuredUs = clearHome;
+    timing.dataWriteUs = LCD_addMargin(dataWrite);
+    timing.clearHomeUs = LCD_addMargin(clearHome);
+    timing.calibrated = true;
+    return (LCD_OK);
+}
+
+/**
+ * @brief Returns the timing currently in use.
+ *
+ * @param copy Where to copy the measured and applied execution times.
+ * @return void
+ */
+void LCD_getTiming(LCD_TimingTypedef *copy) {
+    PROFILE_FUNCTION();
+    if (copy != NULL)
+        *copy = timing;
+}
+
+/**
+ * @brief Returns the fault recovery counters.
+ *
+ * @param copy Where to copy the counters.
+ * @return void
+ */
+void LCD_getRecoveryStats(LCD_RecoveryStatsTypedef *copy) {
+    PROFILE_FUNCTION();
+    if (copy != NULL)
+        *copy = recovery;
+}
+
+/**
+ * @brief Turns the backlight on or off.
+ *
+ * The backlight is a bit of every expander byte, so by default the change rides along with the
+ * next strobe at no bus cost. When it must change right away a single expander byte is written
+ * with E low, which the controller ignores.
+ *
+ * @param on true to turn the backlight on, false to turn it off.
+ * @param immediate true to write the expander now, false to apply it on the next transfer.
+ * @return LCD_StatusTypedef Returns LCD_OK if the backlight was set, otherwise LCD_FAIL.
+ */
+LCD_StatusTypedef LCD_setBacklight(bool_t on, bool_t immediate) {
+    PROFILE_FUNCTION();
+    backLightRequested = on ? BACKLIGHT_ON : BACKLIGHT_OFF;
+    if (LCD_wake() == LCD_FAIL)
+        return (LCD_FAIL);
+    backLight = backLightRequested;
+    if (!immediate)
+        return (LCD_OK);
+    return (LCD_applyBacklight());
+}
+
+/**
+ * @brief Turns the display (DDRAM output) on or off, keeping its contents.
+ *
+ * @param on true to turn the display on, false to turn it off.
+ * @return LCD_StatusTypedef Returns LCD_OK if the command was sent, otherwise LCD_FAIL.
+ */
+LCD_StatusTypedef LCD_setDisplay(bool_t on) {
+    PROFILE_FUNCTION();
+    displayRequested = on;
+    bool_t woken = on && idleState == LCD_IDLE_OFF;
+    if (LCD_wake() == LCD_FAIL)
+        return (LCD_FAIL);
+    if (woken)
+        return (LCD_OK); /* LCD_wake() already turned the display back on */
+    displayControl = on ? (displayControl | DISPLAY_ON) : (displayControl & ~DISPLAY_ON);
+    return (LCD_sendMsg(displayControl, COMMAND));
+}
+
+/**
+ * @brief Configures the inactivity timeouts.
+ *
+ * @param backlightMs Time without activity before the backlight is turned off, or
+ * LCD_IDLE_DISABLED.
+ * @param displayMs Time without activity before the display is turned off, or LCD_IDLE_DISABLED.
+ * @return void
+ */
+void LCD_setIdleTimeouts(uint32_t backlightMs, uint32_t displayMs) {
+    PROFILE_FUNCTION();
+    idleBacklightMs = backlightMs;
+    idleDisplayMs = displayMs;
+    activity = true;
+}
+
+/**
+ * @brief Runs the inactivity timer; call it periodically with a millisecond time stamp.
+ *
+ * Any LCD call in between counts as activity. Everything turned off by the timer is turned back
+ * on by the next LCD call.
+ *
+ * @param nowMs Current time in milliseconds.
+ * @return LCD_StatusTypedef Returns LCD_OK unless a power-down transfer failed.
+ */
+LCD_StatusTypedef LCD_idleTask(uint32_t nowMs) {
+    PROFILE_FUNCTION();
+    if (activity) {
+        activity = false;
+        lastActivityMs = nowMs;
+        return (LCD_OK);
+    }
+    uint32_t idleMs = nowMs - lastActivityMs;
+    if (idleState == LCD_IDLE_ACTIVE && idleBacklightMs != LCD_IDLE_DISABLED &&
+        idleMs >= idleBacklightMs) {
+        idleState = LCD_IDLE_DIMMED;
+        if (backLight != BACKLIGHT_OFF) {
+            backLight = BACKLIGHT_OFF;
+            if (LCD_applyBacklight() == LCD_FAIL)
+                return (LCD_FAIL);
+        }
+    }
+    if (idleState != LCD_IDLE_OFF && idleDisplayMs != LCD_IDLE_DISABLED &&
+        idleMs >= idleDisplayMs) {
+        idleState = LCD_IDLE_OFF;
+        bool_t lit = backLight != BACKLIGHT_OFF;
+        backLight = BACKLIGHT_OFF;
+        if (displayControl & DISPLAY_ON) {
+            displayControl &= ~DISPLAY_ON;
+            return (LCD_sendMsg(displayControl, COMMAND));
+        }
+        /* The display was already turned off by the user, only the backlight is left */
+        if (lit)
+            return (LCD_applyBacklight());
+    }
+    return (LCD_OK);
+}
+
+/**
+ * @brief Returns the state of the inactivity timer.
+ *
+ * @param void
+ * @return LCD_IdleStateTypedef Active, backlight dimmed or display off.
+ */
+LCD_IdleStateTypedef LCD_getIdleState(void) {
+    PROFILE_FUNCTION();
+    return (idleState);
+}
+
 /**
  * @brief Prints a character on the LCD.
  *
@@ -152,6 +515,7 @@ LCD_StatusTypedef LCD_printFormattedText(const char * format, float number) {
  * LCD_FAIL.
  */
 LCD_StatusTypedef LCD_printChar(char dato) {
+    PROFILE_FUNCTION();
     return (LCD_sendMsg(dato, DATA));
 }
 
@@ -162,6 +526,7 @@ LCD_StatusTypedef LCD_printChar(char dato) {
  * @return void
  */
 static void LCD_delay(uint8_t delay) {
+    PROFILE_SCOPE("LCD delay");
     LCD_portDelay(delay);
 }
 
@@ -177,34 +542,299 @@ static LCD_StatusTypedef LCD_sendNibble(uint8_t data, uint8_t rs) {
                          (backLight << BACKLIGHT_SHIFT) | rs));
 }
 
+/**
+ * @brief Waits for the controller to execute a message once the timing is calibrated.
+ *
+ * Clear display and return home are the only commands below ENTRY_MODE_SET and take much
+ * longer than the rest.
+ *
+ * @param data Data sent.
+ * @param rs Register select flag (COMMAND = 0 or DATA = 1).
+ * @return void
+ */
+static void LCD_waitExecution(uint8_t data, uint8_t rs) {
+    PROFILE_SCOPE("LCD execution wait");
+    if (!timing.calibrated)
+        return;
+    if (rs == COMMAND && data < ENTRY_MODE_SET)
+        LCD_portDelayUs(timing.clearHomeUs);
+    else
+        LCD_portDelayUs(timing.dataWriteUs);
+}
+
+/**
+ * @brief Reads the busy flag of the controller.
+ *
+ * Both nibbles of the status register are clocked out; the busy flag is in the first one.
+ *
+ * @param busy Where to store the flag.
+ * @return LCD_StatusTypedef Returns LCD_OK if the flag was read, otherwise LCD_FAIL.
+ */
+static LCD_StatusTypedef LCD_readBusyFlag(bool_t *busy) {
+    PROFILE_SCOPE("LCD busy flag read");
+    uint8_t idle = HIGH_NIBBLE_MASK | (backLight << BACKLIGHT_SHIFT) | READ_WRITE | COMMAND;
+    uint8_t status;
+    if (!LCD_portWriteByte(idle))
+        return (LCD_FAIL);
+    if (!LCD_portWriteByte(idle | ENABLE))
+        return (LCD_FAIL);
+    if (!LCD_portReadByte(&status))
+        return (LCD_FAIL);
+    if (!LCD_portWriteByte(idle))
+        return (LCD_FAIL);
+    if (!LCD_portWriteByte(idle | ENABLE))
+        return (LCD_FAIL);
+    if (!LCD_portWriteByte(idle))
+        return (LCD_FAIL);
+    *busy = (status & BUSY_FLAG) != 0;
+    return (LCD_OK);
+}
+
+/**
+ * @brief Sends a message and measures how long the controller stays busy with it.
+ *
+ * @param data Data to send.
+ * @param rs Register select flag (COMMAND = 0 or DATA = 1).
+ * @param elapsed Where to store the execution time in microseconds.
+ * @return LCD_StatusTypedef Returns LCD_OK if the busy flag cleared before LCD_BUSY_TIMEOUT_US,
+ * otherwise LCD_FAIL.
+ */
+static LCD_StatusTypedef LCD_measureExecution(uint8_t data, uint8_t rs, uint32_t *elapsed) {
+    bool_t busy;
+    if (LCD_sendMsg(data, rs) == LCD_FAIL)
+        return (LCD_FAIL);
+    uint32_t start = LCD_portGetMicros();
+    do {
+        if (LCD_readBusyFlag(&busy) == LCD_FAIL)
+            return (LCD_FAIL);
+        *elapsed = LCD_portGetMicros() - start;
+    } while (busy && *elapsed < LCD_BUSY_TIMEOUT_US);
+    return (busy ? LCD_FAIL : LCD_OK);
+}
+
+/**
+ * @brief Adds the safety margin to a measured execution time.
+ *
+ * @param measured Measured time in microseconds.
+ * @return uint32_t Time to wait in microseconds.
+ */
+static uint32_t LCD_addMargin(uint32_t measured) {
+    return (measured + (measured * LCD_TIMING_MARGIN_PERCENT + 99) / 100);
+}
+
 /**
  * @brief Sends a message (byte) to the LCD.
  *
+ * If the transfer fails once the display is initialized, the bus and the 4-bit interface are
+ * recovered and the message is sent again.
+ *
  * @param data Data to send.
  * @param rs Register select flag (COMMAND = 0 or DATA = 1).
  * @return LCD_StatusTypedef Returns LCD_OK if the message was sent correctly, otherwise LCD_FAIL.
  */
 static LCD_StatusTypedef LCD_sendMsg(uint8_t data, uint8_t rs) {
+    if (LCD_transferMsg(data, rs) == LCD_OK)
+        return (LCD_OK);
+    if (!initialized || LCD_recover() == LCD_FAIL)
+        return (LCD_FAIL);
+    return (LCD_transferMsg(data, rs));
+}
+
+/**
+ * @brief Transfers a message (byte) to the LCD as two nibbles.
+ *
+ * @param data Data to send.
+ * @param rs Register select flag (COMMAND = 0 or DATA = 1).
+ * @return LCD_StatusTypedef Returns LCD_OK if the message was sent correctly, otherwise LCD_FAIL.
+ */
+static LCD_StatusTypedef LCD_transferMsg(uint8_t data, uint8_t rs) {
     if (LCD_sendByte((data & HIGH_NIBBLE_MASK) | (backLight << BACKLIGHT_SHIFT) | rs) == LCD_FAIL)
         return (LCD_FAIL);
     if (LCD_sendByte((data & LOW_NIBBLE_MASK) << TO_HIGH_NIBBLE_SHIFT |
                      (backLight << BACKLIGHT_SHIFT) | rs) == LCD_FAIL)
         return (LCD_FAIL);
+    LCD_trackMsg(data, rs);
+    LCD_waitExecution(data, rs);
     return (LCD_OK);
 }
 
+/**
+ * @brief Keeps the RAM copy of the display in step with a message the controller accepted.
+ *
+ * @param data Data sent.
+ * @param rs Register select flag (COMMAND = 0 or DATA = 1).
+ * @return void
+ */
+static void LCD_trackMsg(uint8_t data, uint8_t rs) {
+    if (rs == DATA) {
+        if (cgramSelected)
+            return;
+        uint8_t row = (cursorAddress >= LCD_ROW_2_ADDRESS) ? LCD_ROW_2 : LCD_ROW_1;
+        uint8_t col = cursorAddress - LCD_ROW_ADDRESS[row];
+        if (col < LCD_MAX_COLUMNS) {
+            screen[row][col] = data;
+            TELEMETRY_LCD_CELL(row, col, data);
+        }
+        cursorAddress++;
+    } else if (data & SET_DDRAM_ADDRESS) {
+        cursorAddress = data & DDRAM_ADDRESS_MASK;
+        cgramSelected = false;
+    } else if (data & SET_CGRAM_ADDRESS) {
+        cgramSelected = true;
+    } else if (data < ENTRY_MODE_SET) {
+        if (data == CLEAR_DISPLAY) {
+            memset(screen, BLANK_CHAR, sizeof(screen));
+            TELEMETRY_LCD_CLEAR();
+        }
+        cursorAddress = LCD_ROW_1_ADDRESS;
+        cgramSelected = false;
+    }
+}
+
+/**
+ * @brief Recovers from a failed transfer without a full initialization.
+ *
+ * A transfer that failed between the two nibbles leaves the controller out of phase. The bus
+ * is freed, the interface is resynchronized and the screen is repainted from the RAM copy.
+ * The strobes are sent without the millisecond delays: if the timing is not calibrated the
+ * execution of every message is waited for with LCD_RECOVERY_TIMING instead, so a recovery
+ * costs a few milliseconds rather than two per strobe.
+ *
+ * @param void
+ * @return LCD_StatusTypedef Returns LCD_OK if the display was recovered, otherwise LCD_FAIL.
+ */
+static LCD_StatusTypedef LCD_recover(void) {
+    LCD_StatusTypedef status = LCD_OK;
+    LCD_TimingTypedef sessionTiming = timing;
+    bool_t sessionDelays = strobeDelays;
+
+    recovery.recoveries++;
+    if (!timing.calibrated)
+        timing = LCD_RECOVERY_TIMING;
+    strobeDelays = false;
+    if (!LCD_portBusRecovery() || LCD_resync() == LCD_FAIL || LCD_repaint() == LCD_FAIL) {
+        recovery.failures++;
+        status = LCD_FAIL;
+    }
+    timing = sessionTiming;
+    strobeDelays = sessionDelays;
+    return (status);
+}
+
+/**
+ * @brief Brings the 4-bit interface back in phase.
+ *
+ * Three 0x3 nibbles select 8-bit mode whatever nibble the controller was waiting for, and 0x2
+ * returns it to 4-bit mode. Unlike LCD_init() no power-up delays are needed. The first nibble
+ * may complete a clear or return home left half sent, so it waits the longest execution time;
+ * the rest are function sets.
+ *
+ * @param void
+ * @return LCD_StatusTypedef Returns LCD_OK if the interface was resynchronized, otherwise LCD_FAIL.
+ */
+static LCD_StatusTypedef LCD_resync(void) {
+    const uint8_t resyncCmd[] = {_4BIT_MODE, displayControl, ENTRY_MODE_SET | AUTOINCREMENT};
+    for (uint8_t index = 0; index < LCD_RESYNC_NIBBLES; index++) {
+        if (LCD_sendNibble(CMD_INI1, COMMAND) == LCD_FAIL)
+            return (LCD_FAIL);
+        LCD_portDelayUs(index == 0 ? timing.clearHomeUs : timing.dataWriteUs);
+    }
+    if (LCD_sendNibble(CMD_INI2, COMMAND) == LCD_FAIL)
+        return (LCD_FAIL);
+    LCD_portDelayUs(timing.dataWriteUs);
+    for (uint8_t index = 0; index < sizeof(resyncCmd); index++) {
+        if (LCD_transferMsg(resyncCmd[index], COMMAND) == LCD_FAIL)
+            return (LCD_FAIL);
+    }
+    return (LCD_OK);
+}
+
+/**
+ * @brief Records activity and undoes what the inactivity timer turned off.
+ *
+ * The backlight comes back with the strobes of the call that woke the display.
+ *
+ * @param void
+ * @return LCD_StatusTypedef Returns LCD_OK unless the display could not be turned back on.
+ */
+static LCD_StatusTypedef LCD_wake(void) {
+    activity = true;
+    if (idleState == LCD_IDLE_ACTIVE)
+        return (LCD_OK);
+    LCD_IdleStateTypedef previous = idleState;
+    idleState = LCD_IDLE_ACTIVE;
+    backLight = backLightRequested;
+    if (previous == LCD_IDLE_OFF && displayRequested) {
+        displayControl |= DISPLAY_ON;
+        return (LCD_sendMsg(displayControl, COMMAND));
+    }
+    return (LCD_OK);
+}
+
+/**
+ * @brief Writes the backlight bit alone, with E low so the controller ignores the byte.
+ *
+ * @param void
+ * @return LCD_StatusTypedef Returns LCD_OK if the expander was written, otherwise LCD_FAIL.
+ */
+static LCD_StatusTypedef LCD_applyBacklight(void) {
+    return (LCD_writeExpander(backLight << BACKLIGHT_SHIFT) ? LCD_OK : LCD_FAIL);
+}
+
+/**
+ * @brief Rewrites every visible cell from the RAM copy and restores the cursor.
+ *
+ * @param void
+ * @return LCD_StatusTypedef Returns LCD_OK if the screen was repainted, otherwise LCD_FAIL.
+ */
+static LCD_StatusTypedef LCD_repaint(void) {
+    uint8_t cursor = cursorAddress;
+    for (uint8_t row = 0; row < LCD_CANTIDAD_FILAS; row++) {
+        if (LCD_transferMsg(LCD_ROW_ADDRESS[row] | SET_DDRAM_ADDRESS, COMMAND) == LCD_FAIL)
+            return (LCD_FAIL);
+        for (uint8_t col = 0; col < LCD_MAX_COLUMNS; col++) {
+            if (LCD_transferMsg(screen[row][col], DATA) == LCD_FAIL)
+                return (LCD_FAIL);
+        }
+    }
+    return (LCD_transferMsg(cursor | SET_DDRAM_ADDRESS, COMMAND));
+}
+
 /**
  * @brief Sends a byte to the LCD.
  *
+ * Once the timing is calibrated the strobe needs no delay: an I2C frame is already longer than
+ * the minimum enable pulse, and the execution time is waited for by LCD_sendMsg().
+ *
  * @param byte Byte to send.
  * @return LCD_StatusTypedef Returns LCD_OK if the byte was sent correctly, otherwise LCD_FAIL.
  */
 static LCD_StatusTypedef LCD_sendByte(uint8_t byte) {
-    if (!LCD_portWriteByte(byte | ENABLE))
+    if (!LCD_writeExpander(byte | ENABLE))
         return (LCD_FAIL);
-    LCD_delay(DELAY1ms);
-    if (!LCD_portWriteByte(byte))
+    if (strobeDelays)
+        LCD_delay(DELAY1ms);
+    if (!LCD_writeExpander(byte))
         return (LCD_FAIL);
-    LCD_delay(DELAY1ms);
+    if (strobeDelays)
+        LCD_delay(DELAY1ms);
     return (LCD_OK);
 }
+
+/**
+ * @brief Writes the I2C expander, retrying a bounded number of times.
+ *
+ * Rewriting the same expander byte is harmless: E only latches on its falling edge.
+ *
+ * @param byte Byte to write.
+ * @return bool_t Returns true if one of the LCD_WRITE_RETRIES attempts succeeded.
+ */
+static bool_t LCD_writeExpander(uint8_t byte) {
+    PROFILE_SCOPE("LCD port write");
+    for (uint8_t attempt = 0; attempt < LCD_WRITE_RETRIES; attempt++) {
+        if (LCD_portWriteByte(byte))
+            return (true);
+        recovery.retries++;
+    }
+    return (false);
+}
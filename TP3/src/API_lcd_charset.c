@@ -0,0 +1,289 @@
+/*
+ * API_lcd_charset.c
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: juanma
+ */
+#include "API_lcd_charset.h"
+#include "string.h"
+
+/*
+ * UTF-8 text is decoded one byte at a time, so strings are never copied or measured first. An
+ * ASCII byte costs a single lookup in a 128 entry table; the Latin-1 supplement (where the
+ * Spanish letters live) is another direct table, and the few Greek letters, arrows and math
+ * symbols the ROMs carry are found by a binary search in a short sorted table. A code point the
+ * ROM does not have is drawn with the CGRAM glyph bound to it, or with LCD_CHARSET_REPLACEMENT.
+ */
+
+#define UNMAPPED				0
+#define ROW8(base)				(base), (base) + 1, (base) + 2, (base) + 3, \
+								(base) + 4, (base) + 5, (base) + 6, (base) + 7
+#define REPLACEMENT_ROW8		LCD_CHARSET_REPLACEMENT, LCD_CHARSET_REPLACEMENT, \
+								LCD_CHARSET_REPLACEMENT, LCD_CHARSET_REPLACEMENT, \
+								LCD_CHARSET_REPLACEMENT, LCD_CHARSET_REPLACEMENT, \
+								LCD_CHARSET_REPLACEMENT, LCD_CHARSET_REPLACEMENT
+#define LATIN1_FIRST			0xA0
+#define LATIN1_LIMIT			0x100
+#define LATIN1(codePoint)		((codePoint) - LATIN1_FIRST)
+#define UTF8_CONTINUATION_MASK	0xC0
+#define UTF8_CONTINUATION		0x80
+#define UTF8_PAYLOAD_BITS		6
+#define UTF8_PAYLOAD_MASK		0x3F
+#define UTF8_LEAD_2_FIRST		0xC2
+#define UTF8_LEAD_3_FIRST		0xE0
+#define UTF8_LEAD_4_FIRST		0xF0
+#define UTF8_LEAD_4_LAST		0xF4
+#define UTF8_LEAD_2_MASK		0x1F
+#define UTF8_LEAD_3_MASK		0x0F
+#define UTF8_LEAD_4_MASK		0x07
+#define SURROGATE_FIRST			0xD800
+#define SURROGATE_LAST			0xDFFF
+#define CODE_POINT_LAST			0x10FFFF
+
+typedef struct
+{
+	uint16_t codePoint;
+	uint8_t code;
+} LCD_SymbolTypedef;
+
+typedef struct
+{
+	const uint8_t *ascii;
+	const uint8_t *latin1;
+	const LCD_SymbolTypedef *symbols;
+	uint8_t symbolCount;
+} LCD_CharsetTypedef;
+
+static uint8_t LCD_charsetFallback(uint32_t codePoint);
+static uint8_t LCD_charsetFindSymbol(uint32_t codePoint);
+
+/* Bytes 0x01 to 0x07 keep selecting the CGRAM glyphs, as they did before the text was decoded */
+static const uint8_t ASCII_A00[LCD_CHARSET_ASCII_LIMIT] = {
+    UNMAPPED, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+    REPLACEMENT_ROW8, REPLACEMENT_ROW8, REPLACEMENT_ROW8,
+    ROW8(0x20), ROW8(0x28), ROW8(0x30), ROW8(0x38), ROW8(0x40), ROW8(0x48), ROW8(0x50),
+    0x58, 0x59, 0x5A, 0x5B, UNMAPPED, 0x5D, 0x5E, 0x5F, /* 0x5C is the yen sign */
+    ROW8(0x60), ROW8(0x68), ROW8(0x70),
+    0x78, 0x79, 0x7A, 0x7B, 0x7C, 0x7D, UNMAPPED, UNMAPPED /* 0x7E and 0x7F are arrows */
+};
+
+static const uint8_t ASCII_A02[LCD_CHARSET_ASCII_LIMIT] = {
+    UNMAPPED, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+    REPLACEMENT_ROW8, REPLACEMENT_ROW8, REPLACEMENT_ROW8,
+    ROW8(0x20), ROW8(0x28), ROW8(0x30), ROW8(0x38), ROW8(0x40), ROW8(0x48), ROW8(0x50),
+    ROW8(0x58), ROW8(0x60), ROW8(0x68), ROW8(0x70),
+    0x78, 0x79, 0x7A, 0x7B, 0x7C, 0x7D, 0x7E, UNMAPPED
+};
+
+static const uint8_t LATIN1_A00[LATIN1_LIMIT - LATIN1_FIRST] = {
+    [LATIN1(0xA0)] = ' ',  [LATIN1(0xA2)] = 0xEC, [LATIN1(0xA5)] = 0x5C, [LATIN1(0xB0)] = 0xDF,
+    [LATIN1(0xB5)] = 0xE4, [LATIN1(0xB7)] = 0xA5, [LATIN1(0xE4)] = 0xE1, [LATIN1(0xF1)] = 0xEE,
+    [LATIN1(0xF6)] = 0xEF, [LATIN1(0xF7)] = 0xFD, [LATIN1(0xFC)] = 0xF5,
+};
+
+/* The A02 upper half follows ISO 8859-1, except for Phi replacing the slashed O */
+static const uint8_t LATIN1_A02[LATIN1_LIMIT - LATIN1_FIRST] = {
+    [LATIN1(0xA0)] = ' ',  [LATIN1(0xA1)] = 0xA1, [LATIN1(0xA2)] = 0xA2, [LATIN1(0xA3)] = 0xA3,
+    [LATIN1(0xA5)] = 0xA5, [LATIN1(0xA7)] = 0xA7, [LATIN1(0xA9)] = 0xA9, [LATIN1(0xAB)] = 0xAB,
+    [LATIN1(0xAE)] = 0xAE, [LATIN1(0xB0)] = 0xB0, [LATIN1(0xB1)] = 0xB1, [LATIN1(0xB2)] = 0xB2,
+    [LATIN1(0xB3)] = 0xB3, [LATIN1(0xB5)] = 0xB5, [LATIN1(0xB6)] = 0xB6, [LATIN1(0xB7)] = 0xB7,
+    [LATIN1(0xBB)] = 0xBB, [LATIN1(0xBC)] = 0xBC, [LATIN1(0xBD)] = 0xBD, [LATIN1(0xBE)] = 0xBE,
+    [LATIN1(0xBF)] = 0xBF,
+    ROW8(0xC0), ROW8(0xC8), ROW8(0xD0),
+    UNMAPPED, 0xD9, 0xDA, 0xDB, 0xDC, 0xDD, 0xDE, 0xDF,
+    ROW8(0xE0), ROW8(0xE8), ROW8(0xF0),
+    UNMAPPED, 0xF9, 0xFA, 0xFB, 0xFC, 0xFD, 0xFE, 0xFF
+};
+
+/* Sorted by code point */
+static const LCD_SymbolTypedef SYMBOLS_A00[] = {
+    {0x03A3, 0xF6}, /* Sigma */
+    {0x03A9, 0xF4}, /* Omega */
+    {0x03B1, 0xE0}, /* alpha */
+    {0x03B2, 0xE2}, /* beta */
+    {0x03B5, 0xE3}, /* epsilon */
+    {0x03B8, 0xF2}, /* theta */
+    {0x03BC, 0xE4}, /* mu */
+    {0x03C0, 0xF7}, /* pi */
+    {0x03C1, 0xE6}, /* rho */
+    {0x03C3, 0xE5}, /* sigma */
+    {0x2190, 0x7F}, /* left arrow */
+    {0x2192, 0x7E}, /* right arrow */
+    {0x221A, 0xE8}, /* square root */
+    {0x221E, 0xF3}, /* infinity */
+    {0x2588, 0xFF}, /* full block */
+};
+
+static const LCD_SymbolTypedef SYMBOLS_A02[] = {
+    {0x03A3, 0x94}, /* Sigma */
+    {0x03A9, 0x9A}, /* Omega */
+    {0x03B1, 0x90}, /* alpha */
+    {0x03B5, 0x9E}, /* epsilon */
+    {0x03BC, 0xB5}, /* mu */
+    {0x03C0, 0x93}, /* pi */
+    {0x03C3, 0x95}, /* sigma */
+    {0x2190, 0x1B}, /* left arrow */
+    {0x2191, 0x18}, /* up arrow */
+    {0x2192, 0x1A}, /* right arrow */
+    {0x2193, 0x19}, /* down arrow */
+    {0x221E, 0x9C}, /* infinity */
+    {0x2264, 0x1C}, /* less than or equal */
+    {0x2265, 0x1D}, /* greater than or equal */
+};
+
+static const LCD_CharsetTypedef CHARSETS[] = {
+    [LCD_CHARSET_ROM_A00] = {ASCII_A00, LATIN1_A00, SYMBOLS_A00,
+                             sizeof(SYMBOLS_A00) / sizeof(SYMBOLS_A00[0])},
+    [LCD_CHARSET_ROM_A02] = {ASCII_A02, LATIN1_A02, SYMBOLS_A02,
+                             sizeof(SYMBOLS_A02) / sizeof(SYMBOLS_A02[0])},
+};
+
+/* Smallest code point that needs a sequence of each length, shorter forms are overlong */
+static const uint32_t UTF8_MINIMUM[] = {0, 0, 0x80, 0x800, 0x10000};
+
+static const LCD_CharsetTypedef *charset = &CHARSETS[LCD_CHARSET_ROM];
+static uint32_t glyphs[LCD_CHARSET_CGRAM_SLOTS];
+
+/**
+ * @brief Selects the character ROM of the controller and forgets every CGRAM glyph binding.
+ *
+ * @param rom LCD_CHARSET_ROM_A00 or LCD_CHARSET_ROM_A02, anything else selects LCD_CHARSET_ROM.
+ * @return void
+ */
+void LCD_charsetInit(uint8_t rom) {
+    if (rom >= sizeof(CHARSETS) / sizeof(CHARSETS[0]))
+        rom = LCD_CHARSET_ROM;
+    charset = &CHARSETS[rom];
+    memset(glyphs, LCD_CHARSET_NO_GLYPH, sizeof(glyphs));
+}
+
+/**
+ * @brief Prepares a decoder for a new string.
+ *
+ * @param decoder Decoder to reset.
+ * @return void
+ */
+void LCD_charsetDecoderInit(LCD_Utf8DecoderTypedef *decoder) {
+    decoder->codePoint = 0;
+    decoder->pending = 0;
+    decoder->length = 0;
+}
+
+/**
+ * @brief Feeds one byte of UTF-8 text to the decoder.
+ *
+ * Invalid bytes and overlong or out of range sequences become LCD_CHARSET_REPLACEMENT; a
+ * sequence cut short by the next character or by the end of the string is dropped.
+ *
+ * @param decoder Decoder of the string.
+ * @param byte Next byte of the string.
+ * @param code Where to store the character code for the controller.
+ * @return bool Returns true if a character is complete and code must be sent.
+ */
+bool LCD_charsetDecode(LCD_Utf8DecoderTypedef *decoder, uint8_t byte, uint8_t *code) {
+    if (byte < LCD_CHARSET_ASCII_LIMIT) {
+        decoder->pending = 0;
+        *code = charset->ascii[byte];
+        if (*code == UNMAPPED)
+            *code = LCD_charsetFallback(byte);
+        return (true);
+    }
+    if ((byte & UTF8_CONTINUATION_MASK) == UTF8_CONTINUATION) {
+        if (decoder->pending == 0) {
+            *code = LCD_CHARSET_REPLACEMENT;
+            return (true);
+        }
+        decoder->codePoint = (decoder->codePoint << UTF8_PAYLOAD_BITS) | (byte & UTF8_PAYLOAD_MASK);
+        if (--decoder->pending > 0)
+            return (false);
+        uint32_t codePoint = decoder->codePoint;
+        bool valid = codePoint >= UTF8_MINIMUM[decoder->length] && codePoint <= CODE_POINT_LAST &&
+                     (codePoint < SURROGATE_FIRST || codePoint > SURROGATE_LAST);
+        *code = valid ? LCD_charsetMap(codePoint) : LCD_CHARSET_REPLACEMENT;
+        return (true);
+    }
+    if (byte >= UTF8_LEAD_2_FIRST && byte < UTF8_LEAD_3_FIRST) {
+        decoder->codePoint = byte & UTF8_LEAD_2_MASK;
+        decoder->length = 2;
+    } else if (byte >= UTF8_LEAD_3_FIRST && byte < UTF8_LEAD_4_FIRST) {
+        decoder->codePoint = byte & UTF8_LEAD_3_MASK;
+        decoder->length = 3;
+    } else if (byte >= UTF8_LEAD_4_FIRST && byte <= UTF8_LEAD_4_LAST) {
+        decoder->codePoint = byte & UTF8_LEAD_4_MASK;
+        decoder->length = 4;
+    } else {
+        decoder->pending = 0;
+        *code = LCD_CHARSET_REPLACEMENT;
+        return (true);
+    }
+    decoder->pending = decoder->length - 1;
+    return (false);
+}
+
+/**
+ * @brief Translates a Unicode code point to the character code of the selected ROM.
+ *
+ * @param codePoint Code point to draw.
+ * @return uint8_t ROM code, CGRAM slot bound to the code point or LCD_CHARSET_REPLACEMENT.
+ */
+uint8_t LCD_charsetMap(uint32_t codePoint) {
+    uint8_t code = UNMAPPED;
+    if (codePoint < LCD_CHARSET_ASCII_LIMIT)
+        code = charset->ascii[codePoint];
+    else if (codePoint >= LATIN1_FIRST && codePoint < LATIN1_LIMIT)
+        code = charset->latin1[LATIN1(codePoint)];
+    else
+        code = LCD_charsetFindSymbol(codePoint);
+    return ((code != UNMAPPED) ? code : LCD_charsetFallback(codePoint));
+}
+
+/**
+ * @brief Draws a code point missing from the ROM with a CGRAM glyph.
+ *
+ * Only records the binding, the glyph itself is written with LCD_defineGlyph().
+ *
+ * @param slot CGRAM slot, from 0 to LCD_CHARSET_CGRAM_SLOTS - 1.
+ * @param codePoint Code point drawn by the slot, LCD_CHARSET_NO_GLYPH to free the slot.
+ * @return bool Returns false if the slot does not exist.
+ */
+bool LCD_charsetBindGlyph(uint8_t slot, uint32_t codePoint) {
+    if (slot >= LCD_CHARSET_CGRAM_SLOTS)
+        return (false);
+    glyphs[slot] = codePoint;
+    return (true);
+}
+
+/**
+ * @brief Looks for a CGRAM glyph bound to a code point the ROM does not have.
+ *
+ * @param codePoint Code point to draw.
+ * @return uint8_t CGRAM slot bound to the code point, otherwise LCD_CHARSET_REPLACEMENT.
+ */
+static uint8_t LCD_charsetFallback(uint32_t codePoint) {
+    for (uint8_t slot = 0; slot < LCD_CHARSET_CGRAM_SLOTS; slot++) {
+        if (glyphs[slot] == codePoint && codePoint != LCD_CHARSET_NO_GLYPH)
+            return (slot);
+    }
+    return (LCD_CHARSET_REPLACEMENT);
+}
+
+/**
+ * @brief Binary search of a code point in the symbols of the selected ROM.
+ *
+ * @param codePoint Code point to draw.
+ * @return uint8_t ROM code of the symbol, or UNMAPPED.
+ */
+static uint8_t LCD_charsetFindSymbol(uint32_t codePoint) {
+    uint8_t low = 0;
+    uint8_t high = charset->symbolCount;
+    while (low < high) {
+        uint8_t middle = (low + high) / 2;
+        if (charset->symbols[middle].codePoint < codePoint)
+            low = middle + 1;
+        else
+            high = middle;
+    }
+    if (low < charset->symbolCount && charset->symbols[low].codePoint == codePoint)
+        return (charset->symbols[low].code);
+    return (UNMAPPED);
+}
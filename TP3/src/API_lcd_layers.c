@@ -0,0 +1,229 @@
+/*
+ * API_lcd_layers.c
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: juanma
+ */
+#include "API_lcd_layers.h"
+#include "string.h"
+
+/*
+ * Every layer is a full screen of character codes plus a mask of the cells it covers. The base
+ * layer covers every cell and sits below all the overlays; an overlay only covers the cells it
+ * wrote, or the whole screen if it was opened opaque. Writes only touch RAM: the layers are
+ * composed by LCD_layersRender() and LCD_drawFrame() sends the cells that changed, so the base
+ * screen can keep updating under an alarm without any bus traffic. A display driven through the
+ * layers must not be written with LCD_printText(), which clears the whole screen.
+ */
+
+#define LAYER_COUNT				(LCD_LAYERS_MAX_OVERLAYS + 1)
+#define PRIORITY_BASE			UINT8_MAX
+#define ROW_MASK_ALL			((1U << LCD_MAX_COLUMNS) - 1)
+
+_Static_assert(LCD_MAX_COLUMNS <= 16, "The cell mask of a row is 16 bits wide");
+
+typedef struct
+{
+	bool_t open;
+	bool_t opaque;
+	bool_t started;
+	uint8_t priority;
+	uint32_t timeoutMs;
+	uint32_t openedMs;
+	uint16_t mask[LCD_CANTIDAD_FILAS];
+	uint8_t cells[LCD_CANTIDAD_FILAS][LCD_MAX_COLUMNS];
+} LCD_LayerTypedef;
+
+static bool_t LCD_layerValid(int8_t layer);
+static void LCD_layerBlank(LCD_LayerTypedef *target);
+static void LCD_layersCompose(uint8_t *frame);
+
+static LCD_LayerTypedef layers[LAYER_COUNT];
+static bool_t dirty;
+
+/**
+ * @brief Clears the base layer and closes every overlay.
+ *
+ * @param void
+ * @return void
+ */
+void LCD_layersInit(void) {
+    memset(layers, 0, sizeof(layers));
+    layers[LCD_LAYER_BASE].open = true;
+    layers[LCD_LAYER_BASE].opaque = true;
+    layers[LCD_LAYER_BASE].priority = PRIORITY_BASE;
+    LCD_layerBlank(&layers[LCD_LAYER_BASE]);
+    dirty = true;
+}
+
+/**
+ * @brief Opens an overlay above the base layer.
+ *
+ * The timeout starts with the first LCD_layersRender() after the overlay was opened.
+ *
+ * @param priority Priority of the overlay, the lowest value is drawn on top.
+ * @param timeoutMs Time after which the overlay closes by itself, or LCD_LAYER_NO_TIMEOUT.
+ * @param opaque True to hide the whole screen below the overlay with blanks, false to only cover
+ * the cells the overlay writes.
+ * @return int8_t Handle of the overlay, or LCD_LAYER_NONE if every overlay is in use.
+ */
+int8_t LCD_layerOpen(uint8_t priority, uint32_t timeoutMs, bool_t opaque) {
+    for (int8_t layer = LCD_LAYER_BASE + 1; layer < LAYER_COUNT; layer++) {
+        LCD_LayerTypedef *target = &layers[layer];
+        if (target->open)
+            continue;
+        target->open = true;
+        target->opaque = opaque;
+        target->started = false;
+        target->priority = priority;
+        target->timeoutMs = timeoutMs;
+        LCD_layerClear(layer);
+        return (layer);
+    }
+    return (LCD_LAYER_NONE);
+}
+
+/**
+ * @brief Writes UTF-8 text into a layer, clipped at the end of the row.
+ *
+ * @param layer LCD_LAYER_BASE or the handle of an open overlay.
+ * @param row Row of the first character.
+ * @param col Column of the first character.
+ * @param text Text to write.
+ * @return LCD_StatusTypedef Returns LCD_FAIL if the layer is not open or the position is off
+ * screen.
+ */
+LCD_StatusTypedef LCD_layerWrite(int8_t layer, uint8_t row, uint8_t col, const char *text) {
+    if (!LCD_layerValid(layer) || text == NULL || row >= LCD_CANTIDAD_FILAS ||
+        col >= LCD_MAX_COLUMNS)
+        return (LCD_FAIL);
+    LCD_LayerTypedef *target = &layers[layer];
+    LCD_Utf8DecoderTypedef decoder;
+    uint8_t code;
+    LCD_charsetDecoderInit(&decoder);
+    while (*text != NULL_CHAR && col < LCD_MAX_COLUMNS) {
+        if (!LCD_charsetDecode(&decoder, (uint8_t)*text++, &code))
+            continue;
+        if (target->cells[row][col] != code || !(target->mask[row] & (1U << col)))
+            dirty = true;
+        target->cells[row][col] = code;
+        target->mask[row] |= 1U << col;
+        col++;
+    }
+    return (LCD_OK);
+}
+
+/**
+ * @brief Blanks the base layer or an opaque overlay, makes a transparent overlay empty.
+ *
+ * @param layer LCD_LAYER_BASE or the handle of an open overlay.
+ * @return LCD_StatusTypedef Returns LCD_FAIL if the layer is not open.
+ */
+LCD_StatusTypedef LCD_layerClear(int8_t layer) {
+    if (!LCD_layerValid(layer))
+        return (LCD_FAIL);
+    LCD_LayerTypedef *target = &layers[layer];
+    LCD_layerBlank(target);
+    if (!target->opaque)
+        memset(target->mask, 0, sizeof(target->mask));
+    dirty = true;
+    return (LCD_OK);
+}
+
+/**
+ * @brief Closes an overlay, the layers below show again with the next render.
+ *
+ * @param layer Handle of the overlay, the base layer cannot be closed.
+ * @return void
+ */
+void LCD_layerClose(int8_t layer) {
+    if (layer == LCD_LAYER_BASE || !LCD_layerValid(layer))
+        return;
+    layers[layer].open = false;
+    dirty = true;
+}
+
+/**
+ * @brief Tells whether a layer is open, overlays close by themselves when they time out.
+ *
+ * @param layer Handle of the layer.
+ * @return bool_t Returns true if the layer is open.
+ */
+bool_t LCD_layerIsOpen(int8_t layer) {
+    return (LCD_layerValid(layer));
+}
+
+/**
+ * @brief Closes the overlays that timed out and brings the display to the composed screen.
+ *
+ * Must be called periodically from the context that owns the display. Only the cells whose
+ * composed character changed are sent; without changes the bus is not touched at all.
+ *
+ * @param nowMs Current time in milliseconds.
+ * @return LCD_StatusTypedef Status returned by LCD_drawFrame(), LCD_OK if nothing changed.
+ */
+LCD_StatusTypedef LCD_layersRender(uint32_t nowMs) {
+    for (int8_t layer = LCD_LAYER_BASE + 1; layer < LAYER_COUNT; layer++) {
+        LCD_LayerTypedef *target = &layers[layer];
+        if (!target->open || target->timeoutMs == LCD_LAYER_NO_TIMEOUT)
+            continue;
+        if (!target->started) {
+            target->started = true;
+            target->openedMs = nowMs;
+        } else if (nowMs - target->openedMs >= target->timeoutMs) {
+            LCD_layerClose(layer);
+        }
+    }
+    if (!dirty)
+        return (LCD_OK);
+    uint8_t frame[LCD_FRAME_SIZE];
+    LCD_layersCompose(frame);
+    if (LCD_drawFrame(frame) == LCD_FAIL)
+        return (LCD_FAIL);
+    dirty = false;
+    return (LCD_OK);
+}
+
+/**
+ * @brief Checks a layer handle.
+ *
+ * @param layer Handle of the layer.
+ * @return bool_t Returns true if the handle names an open layer.
+ */
+static bool_t LCD_layerValid(int8_t layer) {
+    return (layer >= LCD_LAYER_BASE && layer < LAYER_COUNT && layers[layer].open);
+}
+
+/**
+ * @brief Fills a layer with blanks covering every cell.
+ *
+ * @param target Layer to fill.
+ * @return void
+ */
+static void LCD_layerBlank(LCD_LayerTypedef *target) {
+    memset(target->cells, BLANK_CHAR, sizeof(target->cells));
+    for (uint8_t row = 0; row < LCD_CANTIDAD_FILAS; row++) {
+        target->mask[row] = ROW_MASK_ALL;
+    }
+}
+
+/**
+ * @brief Composes the layers: every cell shows the top layer covering it.
+ *
+ * @param frame Where to store the LCD_FRAME_SIZE composed character codes.
+ * @return void
+ */
+static void LCD_layersCompose(uint8_t *frame) {
+    for (uint8_t row = 0; row < LCD_CANTIDAD_FILAS; row++) {
+        for (uint8_t col = 0; col < LCD_MAX_COLUMNS; col++) {
+            const LCD_LayerTypedef *top = &layers[LCD_LAYER_BASE];
+            for (int8_t layer = LCD_LAYER_BASE + 1; layer < LAYER_COUNT; layer++) {
+                const LCD_LayerTypedef *candidate = &layers[layer];
+                if (candidate->open && (candidate->mask[row] & (1U << col)) &&
+                    candidate->priority <= top->priority)
+                    top = candidate;
+            }
+            frame[row * LCD_MAX_COLUMNS + col] = top->cells[row][col];
+        }
+    }
+}
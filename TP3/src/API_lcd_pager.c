@@ -0,0 +1,229 @@
+/*
+ * API_lcd_pager.c
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: juanma
+ */
+#include "API_lcd_pager.h"
+#include "string.h"
+
+/*
+ * The message is word-wrapped once, when the pager is initialized: the index keeps the byte
+ * offsets where every line starts and ends inside the caller's string, which is never copied and
+ * must stay valid while the pager is used. A page is LCD_CANTIDAD_FILAS consecutive lines, so
+ * the first line of any page is found with a multiplication. Every flip composes the page in a
+ * frame and LCD_drawFrame() only sends the cells that differ from the page shown before.
+ */
+
+#define LINE_BREAK				'\n'
+#define WORD_BREAK				' '
+#define UTF8_CONTINUATION_MASK	0xC0
+#define UTF8_CONTINUATION		0x80
+
+static uint16_t LCD_pagerWrapLine(const char *text, uint16_t start, uint16_t *end);
+static uint16_t LCD_pagerSkipBlanks(const char *text, uint16_t offset);
+static uint16_t LCD_pagerCharLength(const char *text, uint16_t offset);
+static LCD_StatusTypedef LCD_pagerRender(LCD_PagerTypedef *pager);
+
+/**
+ * @brief Builds the line index of a message and shows its first page.
+ *
+ * Lines break between words, at '\n', or inside a word longer than a row. Multi-byte UTF-8
+ * characters take a single cell.
+ *
+ * @param pager Storage of the pager, provided by the caller.
+ * @param text Message to show, must stay valid while the pager is used.
+ * @param dwellMs Time every page is shown by LCD_pagerTick(), or LCD_PAGER_NO_DWELL to only
+ * flip the pages on request.
+ * @return LCD_StatusTypedef Status of the first page render, LCD_FAIL if an argument is NULL.
+ */
+LCD_StatusTypedef LCD_pagerInit(LCD_PagerTypedef *pager, const char *text, uint32_t dwellMs) {
+    if (pager == NULL || text == NULL)
+        return (LCD_FAIL);
+    memset(pager, 0, sizeof(*pager));
+    pager->text = text;
+    pager->dwellMs = dwellMs;
+    uint16_t offset = LCD_pagerSkipBlanks(text, 0);
+    while (text[offset] != NULL_CHAR) {
+        if (pager->lineCount == LCD_PAGER_MAX_LINES) {
+            pager->truncated = true;
+            break;
+        }
+        pager->lineStart[pager->lineCount] = offset;
+        offset = LCD_pagerWrapLine(text, offset, &pager->lineEnd[pager->lineCount]);
+        pager->lineCount++;
+    }
+    pager->pageCount = (pager->lineCount + LCD_CANTIDAD_FILAS - 1) / LCD_CANTIDAD_FILAS;
+    if (pager->pageCount == 0)
+        pager->pageCount = 1;
+    return (LCD_pagerRender(pager));
+}
+
+/**
+ * @brief Returns the number of pages of the message.
+ *
+ * @param pager Pager of the message.
+ * @return uint8_t Number of pages, at least 1.
+ */
+uint8_t LCD_pagerPageCount(const LCD_PagerTypedef *pager) {
+    return (pager->pageCount);
+}
+
+/**
+ * @brief Returns the page being shown.
+ *
+ * @param pager Pager of the message.
+ * @return uint8_t Index of the page, starting at 0.
+ */
+uint8_t LCD_pagerPage(const LCD_PagerTypedef *pager) {
+    return (pager->page);
+}
+
+/**
+ * @brief Shows a page of the message and restarts the dwell time.
+ *
+ * @param pager Pager of the message.
+ * @param page Index of the page, starting at 0.
+ * @return LCD_StatusTypedef Status of the render, LCD_FAIL if the page does not exist.
+ */
+LCD_StatusTypedef LCD_pagerShow(LCD_PagerTypedef *pager, uint8_t page) {
+    if (page >= pager->pageCount)
+        return (LCD_FAIL);
+    pager->page = page;
+    pager->started = false;
+    return (LCD_pagerRender(pager));
+}
+
+/**
+ * @brief Shows the next page, the first one after the last.
+ *
+ * @param pager Pager of the message.
+ * @return LCD_StatusTypedef Status of the render.
+ */
+LCD_StatusTypedef LCD_pagerNext(LCD_PagerTypedef *pager) {
+    return (LCD_pagerShow(pager, (pager->page + 1) % pager->pageCount));
+}
+
+/**
+ * @brief Shows the previous page, the last one before the first.
+ *
+ * @param pager Pager of the message.
+ * @return LCD_StatusTypedef Status of the render.
+ */
+LCD_StatusTypedef LCD_pagerPrevious(LCD_PagerTypedef *pager) {
+    return (LCD_pagerShow(pager, (pager->page + pager->pageCount - 1) % pager->pageCount));
+}
+
+/**
+ * @brief Advances to the next page once the current one was shown for the dwell time.
+ *
+ * Must be called periodically. The dwell time starts with the first call after the page was
+ * shown, so a page flipped by hand is also shown for the whole dwell time.
+ *
+ * @param pager Pager of the message.
+ * @param nowMs Current time in milliseconds.
+ * @return LCD_StatusTypedef Status of the render, LCD_OK if the page did not change.
+ */
+LCD_StatusTypedef LCD_pagerTick(LCD_PagerTypedef *pager, uint32_t nowMs) {
+    if (pager->dwellMs == LCD_PAGER_NO_DWELL || pager->pageCount < 2)
+        return (LCD_OK);
+    if (!pager->started) {
+        pager->started = true;
+        pager->shownMs = nowMs;
+        return (LCD_OK);
+    }
+    if (nowMs - pager->shownMs < pager->dwellMs)
+        return (LCD_OK);
+    LCD_StatusTypedef status = LCD_pagerNext(pager);
+    pager->started = true;
+    pager->shownMs = nowMs;
+    return (status);
+}
+
+/**
+ * @brief Finds the end of the line that starts at an offset.
+ *
+ * @param text Message.
+ * @param start Offset of the first character of the line.
+ * @param end Where to store the offset just past the last character of the line.
+ * @return uint16_t Offset where the next line starts.
+ */
+static uint16_t LCD_pagerWrapLine(const char *text, uint16_t start, uint16_t *end) {
+    uint16_t offset = start;
+    uint16_t wordEnd = start;
+    uint8_t cells = 0;
+    while (text[offset] != NULL_CHAR) {
+        if (text[offset] == LINE_BREAK) {
+            *end = offset;
+            return (LCD_pagerSkipBlanks(text, offset + 1));
+        }
+        if (text[offset] == WORD_BREAK)
+            wordEnd = offset;
+        if (cells == LCD_MAX_COLUMNS) {
+            if (text[offset] == WORD_BREAK || wordEnd == start) {
+                /* The row ends between words, or a word longer than a row is split */
+                *end = offset;
+                return (LCD_pagerSkipBlanks(text, offset));
+            }
+            *end = wordEnd;
+            return (LCD_pagerSkipBlanks(text, wordEnd));
+        }
+        offset += LCD_pagerCharLength(text, offset);
+        cells++;
+    }
+    *end = offset;
+    return (offset);
+}
+
+/**
+ * @brief Skips the blanks at the start of a line.
+ *
+ * @param text Message.
+ * @param offset Offset where the line starts.
+ * @return uint16_t Offset of the first character that is not a blank.
+ */
+static uint16_t LCD_pagerSkipBlanks(const char *text, uint16_t offset) {
+    while (text[offset] == WORD_BREAK)
+        offset++;
+    return (offset);
+}
+
+/**
+ * @brief Returns the length of the UTF-8 sequence of a character.
+ *
+ * @param text Message.
+ * @param offset Offset of the first byte of the character.
+ * @return uint16_t Bytes of the character, its continuation bytes included.
+ */
+static uint16_t LCD_pagerCharLength(const char *text, uint16_t offset) {
+    uint16_t length = 1;
+    while (((uint8_t)text[offset + length] & UTF8_CONTINUATION_MASK) == UTF8_CONTINUATION)
+        length++;
+    return (length);
+}
+
+/**
+ * @brief Composes the current page and draws it.
+ *
+ * @param pager Pager of the message.
+ * @return LCD_StatusTypedef Status returned by LCD_drawFrame().
+ */
+static LCD_StatusTypedef LCD_pagerRender(LCD_PagerTypedef *pager) {
+    uint8_t frame[LCD_FRAME_SIZE];
+    memset(frame, BLANK_CHAR, sizeof(frame));
+    for (uint8_t row = 0; row < LCD_CANTIDAD_FILAS; row++) {
+        uint16_t line = (uint16_t)pager->page * LCD_CANTIDAD_FILAS + row;
+        if (line >= pager->lineCount)
+            break;
+        LCD_Utf8DecoderTypedef decoder;
+        uint8_t *cell = &frame[row * LCD_MAX_COLUMNS];
+        uint8_t col = 0;
+        LCD_charsetDecoderInit(&decoder);
+        for (uint16_t offset = pager->lineStart[line];
+             offset < pager->lineEnd[line] && col < LCD_MAX_COLUMNS; offset++) {
+            if (LCD_charsetDecode(&decoder, (uint8_t)pager->text[offset], &cell[col]))
+                col++;
+        }
+    }
+    return (LCD_drawFrame(frame));
+}
@@ -7,28 +7,65 @@
 #include "API_lcd_port.h"
 
 static I2C_HandleTypeDef I2C_HANDLE;
+static bool_t i2cInitialized = false;
+static int8_t lcdClient = I2C_BUS_NO_CLIENT;
+
+/* Clock speeds tried by the negotiation, highest first */
+static const uint32_t I2C_CLOCK_SPEEDS[] = {I2C_CLOCK_SPEED_FAST, I2C_CLOCK_SPEED_MEDIUM,
+                                            I2C_CLOCK_SPEED};
 
 static bool_t port_i2cInit(void);
+static void port_timerInit(void);
+static I2C_ResultTypedef port_i2cResult(HAL_StatusTypeDef status);
 
 /**
  * @brief Initializes the port used by the LCD.
  *
+ * The bus starts at the highest speed in I2C_CLOCK_SPEEDS and is moved down or up by the
+ * clock negotiation as transfers fail or succeed. The first call also starts the bus manager
+ * and registers the LCD as its first client; other devices register after LCD_init().
+ *
  * @param void
  * @return bool_t Returns true if the initialization was successful, otherwise false.
  */
 bool_t port_init(void) {
+    port_timerInit();
+    I2C_speedInit(I2C_CLOCK_SPEEDS, sizeof(I2C_CLOCK_SPEEDS) / sizeof(I2C_CLOCK_SPEEDS[0]));
+    if (lcdClient == I2C_BUS_NO_CLIENT) {
+        I2C_busInit(port_i2cTransfer, HAL_GetTick, LCD_portGetMicros);
+        lcdClient = I2C_busRegisterClient();
+    }
     return (port_i2cInit());
 }
 
+/**
+ * @brief Starts the DWT cycle counter used for microsecond timing.
+ *
+ * @param void
+ * @return void
+ */
+static void port_timerInit(void) {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
 /**
  * @brief Initializes the I2C port with configured parameters.
  *
+ * If the peripheral was already running it is de-initialized first, so this is also used to
+ * apply a new clock speed.
+ *
  * @param void
  * @return bool_t Returns true if the initialization was successful, otherwise false.
  */
 static bool_t port_i2cInit(void) {
+    if (i2cInitialized) {
+        HAL_I2C_DeInit(&I2C_HANDLE);
+        i2cInitialized = false;
+    }
     I2C_HANDLE.Instance = I2C_INSTANCE;
-    I2C_HANDLE.Init.ClockSpeed = I2C_CLOCK_SPEED;
+    I2C_HANDLE.Init.ClockSpeed = I2C_speedGetClock();
     I2C_HANDLE.Init.DutyCycle = I2C_DUTYCYCLE_2;
     I2C_HANDLE.Init.OwnAddress1 = 0;
     I2C_HANDLE.Init.AddressingMode = I2C_ADDRESSINGMODE_7BIT;
@@ -41,6 +78,7 @@ static bool_t port_i2cInit(void) {
 
     if (HAL_I2C_Init(&I2C_HANDLE) == HAL_OK) {
         estado = true;
+        i2cInitialized = true;
     }
 
     return (estado);
@@ -57,15 +95,196 @@ void LCD_portDelay(uint32_t delay) {
 }
 
 /**
- * @brief Writes a byte to the I2C port.
+ * @brief Introduces a short busy-wait delay.
+ *
+ * @param delay Amount of time to delay in microseconds.
+ * @return void
+ */
+void LCD_portDelayUs(uint32_t delay) {
+    uint32_t start = DWT->CYCCNT;
+    uint32_t cycles = delay * (SystemCoreClock / 1000000U);
+    while ((DWT->CYCCNT - start) < cycles) {
+    }
+}
+
+/**
+ * @brief Returns a free-running microsecond time stamp.
+ *
+ * The cycle counter wraps every few seconds, so it is folded into a microsecond count on each
+ * call; differences between two time stamps are valid as long as the function is called at
+ * least once per counter wrap.
+ *
+ * @param void
+ * @return uint32_t Time stamp in microseconds.
+ */
+uint32_t LCD_portGetMicros(void) {
+    static uint32_t lastCycles;
+    static uint32_t pendingCycles;
+    static uint32_t micros;
+    uint32_t cyclesPerMicro = SystemCoreClock / 1000000U;
+    uint32_t now = DWT->CYCCNT;
+
+    pendingCycles += now - lastCycles;
+    lastCycles = now;
+    micros += pendingCycles / cyclesPerMicro;
+    pendingCycles %= cyclesPerMicro;
+    return (micros);
+}
+
+/**
+ * @brief Writes a byte to the LCD expander through the bus manager.
+ *
+ * Every byte is a frame of its own, so more urgent transactions of other clients are sent
+ * between two bytes of a long LCD burst.
  *
  * @param byte Byte to write.
  * @return bool_t Returns true if the write was successful, otherwise false.
  */
 bool_t LCD_portWriteByte(uint8_t byte) {
-    if (HAL_I2C_Master_Transmit(&I2C_HANDLE, LCD_ADDRESS << 1, &byte, 1, 100) == HAL_OK) {
-        return (true);
-    } else {
+    return (I2C_busTransfer(lcdClient, LCD_BUS_PRIORITY, LCD_ADDRESS, I2C_BUS_WRITE, &byte, 1) ==
+            I2C_RESULT_OK);
+}
+
+/**
+ * @brief Writes several bytes to the LCD expander in a single bus transaction.
+ *
+ * The expander outputs take every byte in turn, so a burst of pre-encoded bytes strobes the
+ * controller without a bus transaction per byte.
+ *
+ * @param bytes Bytes to write.
+ * @param length Number of bytes.
+ * @return bool_t Returns true if the write was successful, otherwise false.
+ */
+bool_t LCD_portWriteBurst(uint8_t *bytes, uint16_t length) {
+    return (I2C_busTransfer(lcdClient, LCD_BUS_PRIORITY, LCD_ADDRESS, I2C_BUS_WRITE, bytes,
+                            length) == I2C_RESULT_OK);
+}
+
+/**
+ * @brief Reads a byte from the LCD expander through the bus manager.
+ *
+ * @param byte Where to store the byte read.
+ * @return bool_t Returns true if the read was successful, otherwise false.
+ */
+bool_t LCD_portReadByte(uint8_t *byte) {
+    return (I2C_busTransfer(lcdClient, LCD_BUS_PRIORITY, LCD_ADDRESS, I2C_BUS_READ, byte, 1) ==
+            I2C_RESULT_OK);
+}
+
+/**
+ * @brief Performs one frame on the peripheral, it must only be called by the bus manager.
+ *
+ * Every transfer outcome is fed to the clock negotiation; when it asks for another speed the
+ * peripheral is re-initialized before returning.
+ *
+ * @param address 7-bit address of the device.
+ * @param direction Write or read.
+ * @param data Data to write or where to store the data read.
+ * @param length Number of bytes.
+ * @return I2C_ResultTypedef Outcome of the frame.
+ */
+I2C_ResultTypedef port_i2cTransfer(uint8_t address, I2C_BusDirectionTypedef direction,
+                                   uint8_t *data, uint16_t length) {
+    HAL_StatusTypeDef status;
+    if (direction == I2C_BUS_READ)
+        status = HAL_I2C_Master_Receive(&I2C_HANDLE, address << 1, data, length, I2C_TIMEOUT);
+    else
+        status = HAL_I2C_Master_Transmit(&I2C_HANDLE, address << 1, data, length, I2C_TIMEOUT);
+    I2C_ResultTypedef result = port_i2cResult(status);
+    if (I2C_speedRecord(result))
+        port_i2cInit();
+    return (result);
+}
+
+/**
+ * @brief Frees a stuck I2C bus and re-initializes the peripheral.
+ *
+ * A slave that lost a clock in the middle of a byte may hold SDA low forever. SCL is clocked
+ * as a GPIO until the slave releases SDA (at most I2C_RECOVERY_CLOCKS pulses), then a STOP
+ * condition is generated and the peripheral is initialized again at the current speed.
+ *
+ * @param void
+ * @return bool_t Returns true if SDA was released and the peripheral re-initialized.
+ */
+bool_t LCD_portBusRecovery(void) {
+    GPIO_InitTypeDef gpio = {0};
+
+    if (i2cInitialized) {
+        HAL_I2C_DeInit(&I2C_HANDLE);
+        i2cInitialized = false;
+    }
+    HAL_GPIO_WritePin(I2C_GPIO_PORT, I2C_SCL_PIN | I2C_SDA_PIN, GPIO_PIN_SET);
+    gpio.Pin = I2C_SCL_PIN | I2C_SDA_PIN;
+    gpio.Mode = GPIO_MODE_OUTPUT_OD;
+    gpio.Pull = GPIO_PULLUP;
+    gpio.Speed = GPIO_SPEED_FREQ_HIGH;
+    HAL_GPIO_Init(I2C_GPIO_PORT, &gpio);
+
+    for (uint8_t clock = 0; clock < I2C_RECOVERY_CLOCKS; clock++) {
+        if (HAL_GPIO_ReadPin(I2C_GPIO_PORT, I2C_SDA_PIN) == GPIO_PIN_SET)
+            break;
+        HAL_GPIO_WritePin(I2C_GPIO_PORT, I2C_SCL_PIN, GPIO_PIN_RESET);
+        LCD_portDelayUs(I2C_RECOVERY_HALF_PERIOD);
+        HAL_GPIO_WritePin(I2C_GPIO_PORT, I2C_SCL_PIN, GPIO_PIN_SET);
+        LCD_portDelayUs(I2C_RECOVERY_HALF_PERIOD);
+    }
+
+    /* STOP: SDA rises while SCL is high */
+    HAL_GPIO_WritePin(I2C_GPIO_PORT, I2C_SDA_PIN, GPIO_PIN_RESET);
+    LCD_portDelayUs(I2C_RECOVERY_HALF_PERIOD);
+    HAL_GPIO_WritePin(I2C_GPIO_PORT, I2C_SDA_PIN, GPIO_PIN_SET);
+    LCD_portDelayUs(I2C_RECOVERY_HALF_PERIOD);
+
+    if (HAL_GPIO_ReadPin(I2C_GPIO_PORT, I2C_SDA_PIN) != GPIO_PIN_SET)
         return (false);
+    return (port_i2cInit());
+}
+
+/**
+ * @brief Returns the clock speed the I2C port is running at.
+ *
+ * @param void
+ * @return uint32_t Clock speed in Hz.
+ */
+uint32_t port_getClockSpeed(void) {
+    return (I2C_speedGetClock());
+}
+
+/**
+ * @brief Returns the bus manager client number of the LCD.
+ *
+ * @param void
+ * @return int8_t Client number, I2C_BUS_NO_CLIENT before port_init().
+ */
+int8_t port_getLcdClient(void) {
+    return (lcdClient);
+}
+
+/**
+ * @brief Copies the I2C clock speed and error counters.
+ *
+ * @param stats Where to copy the counters.
+ * @return void
+ */
+void port_getStats(I2C_SpeedStatsTypedef *stats) {
+    I2C_speedGetStats(stats);
+}
+
+/**
+ * @brief Classifies the outcome of a HAL transfer for the clock negotiation.
+ *
+ * @param status Status returned by the HAL.
+ * @return I2C_ResultTypedef NACK when the slave did not acknowledge, TIMEOUT or ERROR otherwise.
+ */
+static I2C_ResultTypedef port_i2cResult(HAL_StatusTypeDef status) {
+    switch (status) {
+    case HAL_OK:
+        return (I2C_RESULT_OK);
+    case HAL_TIMEOUT:
+        return (I2C_RESULT_TIMEOUT);
+    default:
+        if (HAL_I2C_GetError(&I2C_HANDLE) & HAL_I2C_ERROR_AF)
+            return (I2C_RESULT_NACK);
+        return (I2C_RESULT_ERROR);
     }
 }
@@ -0,0 +1,252 @@
+/*
+ * API_lcd_queue.c
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: juanma
+ */
+#include "API_lcd_queue.h"
+#include "string.h"
+
+/*
+ * Multi-producer, single-consumer bounded queue. Every slot carries a sequence number: a
+ * producer claims a position by advancing the tail with a compare-and-swap, copies the record
+ * and publishes it by storing the sequence; the consumer only takes a slot whose sequence says
+ * it is published. No locks are taken and interrupts are never masked, so LCD_queuePost() may
+ * be called from tasks and interrupt handlers alike. Only the drain task touches the bus.
+ */
+
+#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__)
+#define LCD_QUEUE_USE_LDREX_STREX
+typedef volatile uint32_t LCD_atomicTypedef;
+#else
+#include "stdatomic.h"
+typedef _Atomic uint32_t LCD_atomicTypedef;
+#endif
+
+#define LCD_QUEUE_MASK			(LCD_QUEUE_SLOTS - 1)
+
+_Static_assert((LCD_QUEUE_SLOTS & LCD_QUEUE_MASK) == 0, "LCD_QUEUE_SLOTS must be a power of two");
+
+typedef struct
+{
+	LCD_atomicTypedef sequence;
+	LCD_UpdateTypedef update;
+} LCD_QueueSlotTypedef;
+
+static uint32_t LCD_atomicLoad(LCD_atomicTypedef *ptr);
+static void LCD_atomicStore(LCD_atomicTypedef *ptr, uint32_t value);
+static bool_t LCD_atomicCompareExchange(LCD_atomicTypedef *ptr, uint32_t *expected,
+                                        uint32_t desired);
+static void LCD_atomicIncrement(LCD_atomicTypedef *ptr);
+static LCD_StatusTypedef LCD_queueApply(const LCD_UpdateTypedef *update);
+
+static LCD_QueueSlotTypedef slots[LCD_QUEUE_SLOTS];
+static LCD_atomicTypedef tail;
+static LCD_atomicTypedef dropped;
+static LCD_atomicTypedef failed;
+static uint32_t head;
+
+/**
+ * @brief Initializes the update queue.
+ *
+ * Must be called before any producer posts an update, with no producer or consumer running.
+ *
+ * @param void This function does not take any parameters.
+ * @return void
+ */
+void LCD_queueInit(void) {
+    for (uint32_t index = 0; index < LCD_QUEUE_SLOTS; index++) {
+        LCD_atomicStore(&slots[index].sequence, index);
+    }
+    LCD_atomicStore(&tail, 0);
+    LCD_atomicStore(&dropped, 0);
+    LCD_atomicStore(&failed, 0);
+    head = 0;
+}
+
+/**
+ * @brief Posts a display update to the queue.
+ *
+ * Safe to call from any task or interrupt handler. It never blocks: when the queue is full the
+ * update is discarded and counted as dropped.
+ *
+ * @param update Update to copy into the queue.
+ * @return LCD_StatusTypedef Returns LCD_OK if the update was queued, otherwise LCD_FAIL.
+ */
+LCD_StatusTypedef LCD_queuePost(const LCD_UpdateTypedef *update) {
+    if (update == NULL)
+        return (LCD_FAIL);
+    uint32_t position = LCD_atomicLoad(&tail);
+    LCD_QueueSlotTypedef *slot;
+    for (;;) {
+        slot = &slots[position & LCD_QUEUE_MASK];
+        int32_t difference = (int32_t)(LCD_atomicLoad(&slot->sequence) - position);
+        if (difference == 0) {
+            if (LCD_atomicCompareExchange(&tail, &position, position + 1))
+                break;
+        } else if (difference < 0) {
+            LCD_atomicIncrement(&dropped);
+            return (LCD_FAIL);
+        } else {
+            position = LCD_atomicLoad(&tail);
+        }
+    }
+    slot->update = *update;
+    slot->update.text[LCD_QUEUE_TEXT_SIZE - 1] = NULL_CHAR;
+    LCD_atomicStore(&slot->sequence, position + 1);
+    return (LCD_OK);
+}
+
+/**
+ * @brief Posts a text update to the queue.
+ *
+ * Text longer than the display is truncated to LCD_QUEUE_TEXT_SIZE - 1 characters.
+ *
+ * @param ptrText Pointer to the text to print.
+ * @return LCD_StatusTypedef Returns LCD_OK if the update was queued, otherwise LCD_FAIL.
+ */
+LCD_StatusTypedef LCD_queuePostText(const char *ptrText) {
+    if (ptrText == NULL)
+        return (LCD_FAIL);
+    LCD_UpdateTypedef update = {.type = LCD_UPDATE_TEXT};
+    strncpy(update.text, ptrText, LCD_QUEUE_TEXT_SIZE - 1);
+    return (LCD_queuePost(&update));
+}
+
+/**
+ * @brief Takes the oldest published update out of the queue.
+ *
+ * Must only be called from the single consumer (the drain task).
+ *
+ * @param update Where to copy the update.
+ * @return LCD_StatusTypedef Returns LCD_OK if an update was taken, LCD_FAIL if the queue is empty.
+ */
+LCD_StatusTypedef LCD_queuePop(LCD_UpdateTypedef *update) {
+    if (update == NULL)
+        return (LCD_FAIL);
+    LCD_QueueSlotTypedef *slot = &slots[head & LCD_QUEUE_MASK];
+    if (LCD_atomicLoad(&slot->sequence) != head + 1)
+        return (LCD_FAIL);
+    *update = slot->update;
+    LCD_atomicStore(&slot->sequence, head + LCD_QUEUE_SLOTS);
+    head++;
+    return (LCD_OK);
+}
+
+/**
+ * @brief Applies queued updates to the display.
+ *
+ * Must only be called from the single consumer (the drain task), which is the only context
+ * allowed to talk to the bus. An update the LCD API fails to apply is not retried, since the
+ * driver already retried and recovered the bus; it is counted by LCD_queueGetFailed().
+ *
+ * @param maxUpdates Maximum number of updates to apply in this call.
+ * @return uint32_t Number of updates taken out of the queue, applied or failed.
+ */
+uint32_t LCD_queueDrain(uint32_t maxUpdates) {
+    LCD_UpdateTypedef update;
+    uint32_t count = 0;
+    while (count < maxUpdates && LCD_queuePop(&update) == LCD_OK) {
+        if (LCD_queueApply(&update) == LCD_FAIL)
+            LCD_atomicIncrement(&failed);
+        count++;
+    }
+    return (count);
+}
+
+/**
+ * @brief Returns the number of updates discarded because the queue was full.
+ *
+ * @param void This function does not take any parameters.
+ * @return uint32_t Number of dropped updates since LCD_queueInit().
+ */
+uint32_t LCD_queueGetDropped(void) {
+    return (LCD_atomicLoad(&dropped));
+}
+
+/**
+ * @brief Returns the number of updates taken out of the queue that the LCD API failed to apply.
+ *
+ * @param void This function does not take any parameters.
+ * @return uint32_t Number of failed updates since LCD_queueInit().
+ */
+uint32_t LCD_queueGetFailed(void) {
+    return (LCD_atomicLoad(&failed));
+}
+
+/**
+ * @brief Sends one update to the display through the LCD API.
+ *
+ * @param update Update to apply.
+ * @return LCD_StatusTypedef Status returned by the LCD API.
+ */
+static LCD_StatusTypedef LCD_queueApply(const LCD_UpdateTypedef *update) {
+    switch (update->type) {
+    case LCD_UPDATE_CLEAR:
+        return (LCD_clear());
+    case LCD_UPDATE_CURSOR:
+        return (LCD_setCursor(update->row, update->col));
+    case LCD_UPDATE_TEXT:
+        return (LCD_printText((char *)update->text));
+    default:
+        return (LCD_FAIL);
+    }
+}
+
+#ifdef LCD_QUEUE_USE_LDREX_STREX
+
+static uint32_t LCD_atomicLoad(LCD_atomicTypedef *ptr) {
+    uint32_t value = *ptr;
+    __asm volatile("dmb" ::: "memory");
+    return (value);
+}
+
+static void LCD_atomicStore(LCD_atomicTypedef *ptr, uint32_t value) {
+    __asm volatile("dmb" ::: "memory");
+    *ptr = value;
+}
+
+/* Weak compare-and-swap: a STREX that loses the reservation (e.g. an interrupt hit between
+ * LDREX and STREX) reports failure and the caller retries. */
+static bool_t LCD_atomicCompareExchange(LCD_atomicTypedef *ptr, uint32_t *expected,
+                                        uint32_t desired) {
+    uint32_t current;
+    uint32_t failed;
+    __asm volatile("ldrex %0, [%1]" : "=r"(current) : "r"(ptr) : "memory");
+    if (current != *expected) {
+        __asm volatile("clrex" ::: "memory");
+        *expected = current;
+        return (false);
+    }
+    __asm volatile("strex %0, %2, [%1]" : "=&r"(failed) : "r"(ptr), "r"(desired) : "memory");
+    __asm volatile("dmb" ::: "memory");
+    return (failed == 0);
+}
+
+static void LCD_atomicIncrement(LCD_atomicTypedef *ptr) {
+    uint32_t value = *ptr;
+    while (!LCD_atomicCompareExchange(ptr, &value, value + 1)) {
+    }
+}
+
+#else
+
+static uint32_t LCD_atomicLoad(LCD_atomicTypedef *ptr) {
+    return (atomic_load_explicit(ptr, memory_order_acquire));
+}
+
+static void LCD_atomicStore(LCD_atomicTypedef *ptr, uint32_t value) {
+    atomic_store_explicit(ptr, value, memory_order_release);
+}
+
+static bool_t LCD_atomicCompareExchange(LCD_atomicTypedef *ptr, uint32_t *expected,
+                                        uint32_t desired) {
+    return (atomic_compare_exchange_weak_explicit(ptr, expected, desired, memory_order_acq_rel,
+                                                  memory_order_relaxed));
+}
+
+static void LCD_atomicIncrement(LCD_atomicTypedef *ptr) {
+    atomic_fetch_add_explicit(ptr, 1, memory_order_relaxed);
+}
+
+#endif
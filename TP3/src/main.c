@@ -26,24 +26,179 @@ SPDX-License-Identifier: MIT
 /* === Headers files inclusions =============================================================== */
 
 #include "main.h"
+#include "API_lcd.h"
+#include "API_lcd_port.h"
+#include "API_lcd_queue.h"
+#include "API_i2c_bus.h"
+#include "app_tasks.h"
+#include "lcd_assets.h"
+#include "scheduler.h"
+#include "telemetry.h"
 
 /* === Macros definitions ====================================================================== */
 
+#if TELEMETRY_ENABLED
+//! UART of the ST-LINK virtual COM port, where the telemetry frames are sent
+#define TELEMETRY_UART_INSTANCE USART2
+
+//! Timeout of a telemetry chunk, in milliseconds
+#define TELEMETRY_UART_TIMEOUT_MS 10
+#endif
+
 /* === Private data type declarations ========================================================== */
 
 /* === Private variable declarations =========================================================== */
 
 /* === Private function declarations =========================================================== */
 
+/**
+ * @brief Millisecond tick source, from the HAL tick.
+ *
+ * @return uint32_t Time in milliseconds.
+ */
+static uint32_t boardMillis(void);
+
+/**
+ * @brief Control loop of the application, it has the highest priority.
+ *
+ * @param context Not used.
+ */
+static void controlTask(void * context);
+
+/**
+ * @brief Sends queued transactions of the shared I2C bus while they fit in the budget.
+ *
+ * @param context Not used.
+ */
+static void busTask(void * context);
+
+/**
+ * @brief Applies queued display updates while they fit before the next control release.
+ *
+ * The control period is longer than DISPLAY_UPDATE_COST_US, so an update is only postponed, never
+ * dropped, when the control loop is close to its release.
+ *
+ * @param context Not used.
+ */
+static void displayTask(void * context);
+
+/**
+ * @brief Dims and turns off the display after the idle timeouts.
+ *
+ * @param context Not used.
+ */
+static void idleTask(void * context);
+
+#if TELEMETRY_ENABLED
+/**
+ * @brief Starts the UART where the telemetry frames are sent.
+ *
+ * @return true if the UART was started, false otherwise.
+ */
+static bool telemetryUartInit(void);
+
+/**
+ * @brief Sends the queued telemetry frames to the UART while they fit in the budget.
+ *
+ * It has a low priority: the frames wait in the ring, and if it fills up the ring drops them and
+ * sends the whole panel again when there is room.
+ *
+ * @param context Not used.
+ */
+static void telemetryTask(void * context);
+#endif
+
 /* === Public variable definitions ============================================================= */
 
 /* === Private variable definitions ============================================================ */
 
+#if TELEMETRY_ENABLED
+//! UART where the telemetry frames are sent
+static UART_HandleTypeDef telemetryUart;
+#endif
+
 /* === Private function implementation ========================================================= */
 
+uint32_t boardMillis(void) {
+    return HAL_GetTick();
+}
+
+void controlTask(void * context) {
+    (void)context;
+}
+
+void busTask(void * context) {
+    (void)context;
+    while (Scheduler_hasBudget(BUS_FRAME_COST_US) && I2C_busService()) {
+    }
+}
+
+void displayTask(void * context) {
+    (void)context;
+    while (Scheduler_hasBudget(DISPLAY_UPDATE_COST_US) && LCD_queueDrain(1) > 0) {
+    }
+}
+
+void idleTask(void * context) {
+    (void)context;
+    LCD_idleTask(HAL_GetTick());
+}
+
+#if TELEMETRY_ENABLED
+bool telemetryUartInit(void) {
+    telemetryUart.Instance = TELEMETRY_UART_INSTANCE;
+    telemetryUart.Init.BaudRate = TELEMETRY_BAUD_RATE;
+    telemetryUart.Init.WordLength = UART_WORDLENGTH_8B;
+    telemetryUart.Init.StopBits = UART_STOPBITS_1;
+    telemetryUart.Init.Parity = UART_PARITY_NONE;
+    telemetryUart.Init.Mode = UART_MODE_TX;
+    telemetryUart.Init.HwFlowCtl = UART_HWCONTROL_NONE;
+    telemetryUart.Init.OverSampling = UART_OVERSAMPLING_16;
+    return (HAL_UART_Init(&telemetryUart) == HAL_OK);
+}
+
+void telemetryTask(void * context) {
+    uint8_t chunk[TELEMETRY_CHUNK_FRAMES * TELEMETRY_FRAME_SIZE];
+    uint16_t length;
+    (void)context;
+    while (Scheduler_hasBudget(TELEMETRY_CHUNK_COST_US) &&
+           (length = Telemetry_read(chunk, sizeof(chunk))) > 0) {
+        HAL_UART_Transmit(&telemetryUart, chunk, length, TELEMETRY_UART_TIMEOUT_MS);
+    }
+}
+#endif
+
 /* === Public function implementation ========================================================== */
 
 int main(void) {
+    HAL_Init();
+#if TELEMETRY_ENABLED
+    /* The ring must be ready before the drivers report their first changes */
+    Telemetry_init();
+#endif
+    LCD_queueInit();
+    LCD_init();
+    LCD_calibrateTiming();
+    LCD_blit(&LCD_ASSET_ARROWS);
+    LCD_blit(&LCD_ASSET_BOOT);
+    Scheduler_init(boardMillis, LCD_portGetMicros);
+
+    /* Same order as test_app_tasks.c, which checks that every task gets to run */
+    Scheduler_addTask(controlTask, NULL, CONTROL_PERIOD_MS, CONTROL_OFFSET_MS, CONTROL_BUDGET_US);
+    Scheduler_addTask(displayTask, NULL, DISPLAY_PERIOD_MS, DISPLAY_OFFSET_MS, DISPLAY_BUDGET_US);
+    Scheduler_addTask(idleTask, NULL, IDLE_PERIOD_MS, IDLE_OFFSET_MS, IDLE_BUDGET_US);
+#if TELEMETRY_ENABLED
+    if (telemetryUartInit()) {
+        Scheduler_addTask(telemetryTask, NULL, TELEMETRY_PERIOD_MS, TELEMETRY_OFFSET_MS,
+                          TELEMETRY_BUDGET_US);
+    }
+#endif
+    Scheduler_addTask(busTask, NULL, BUS_PERIOD_MS, BUS_OFFSET_MS, BUS_BUDGET_US);
+
+    while (true) {
+        Scheduler_dispatch();
+    }
+    return 0;
 }
 
 /* === End of documentation ==================================================================== */
\ No newline at end of file
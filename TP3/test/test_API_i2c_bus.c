@@ -0,0 +1,302 @@
+/************************************************************************************************
+Copyright (c) 2025, Juan Manuel Guariste <juanmaguariste@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** @file test_API_i2c_bus.c
+ ** @brief Unit tests for the shared I2C bus manager.
+ **/
+
+/*
+    Requirements to be tested:
+    1- Queued transactions must be sent by priority, then by deadline.
+    2- A transaction must not be sent before its release time.
+    3- A transaction past its deadline must fail without using the bus.
+    4- A chunked transaction must be split and a more urgent one must go between its frames.
+    5- A blocking frame must first send the due transactions that are more urgent.
+    6- The bus time of every client must be accounted separately.
+    7- The client and transaction tables must be bounded.
+*/
+
+/* === Headers files inclusions ===============================================================
+ */
+#include "unity.h"
+#include "API_i2c_bus.h"
+
+/* === Macros definitions ======================================================================
+ */
+
+/**
+ *	@brief Bus time of one byte in the fake transfer, in microseconds.
+ */
+#define BYTE_US 100
+
+/**
+ *	@brief Size of the frame trace.
+ */
+#define TRACE_SIZE 16
+
+/* === Private data type declarations ==========================================================
+ */
+
+/* === Private variable declarations ===========================================================
+ */
+
+/**
+ *	@brief Fake time in microseconds.
+ */
+static uint32_t fakeUs;
+
+/**
+ *	@brief Addresses of the frames sent, in order.
+ */
+static uint8_t trace[TRACE_SIZE];
+
+/**
+ *	@brief Lengths of the frames sent, in order.
+ */
+static uint16_t traceLength[TRACE_SIZE];
+
+/**
+ *	@brief Number of frames sent.
+ */
+static uint8_t frames;
+
+/**
+ *	@brief Result of the last finished transaction.
+ */
+static I2C_ResultTypedef lastResult;
+
+/**
+ *	@brief Number of finished transactions.
+ */
+static uint8_t finished;
+
+/**
+ *	@brief Data buffer shared by the tests.
+ */
+static uint8_t data[32];
+
+/* === Private function declarations ===========================================================
+ */
+
+/* === Public variable definitions =============================================================
+ */
+
+/* === Private variable definitions ============================================================
+ */
+
+/* === Private function implementation =========================================================
+ */
+
+/**
+ * @brief Fake frame: records it and advances the clock by its bus time.
+ */
+static I2C_ResultTypedef fakeTransfer(uint8_t address, I2C_BusDirectionTypedef direction,
+                                      uint8_t *buffer, uint16_t length) {
+    (void)direction;
+    (void)buffer;
+    if (frames < TRACE_SIZE) {
+        trace[frames] = address;
+        traceLength[frames] = length;
+    }
+    frames++;
+    fakeUs += length * BYTE_US;
+    return (I2C_RESULT_OK);
+}
+
+/**
+ * @brief Fake millisecond tick.
+ */
+static uint32_t fakeMillis(void) {
+    return (fakeUs / 1000);
+}
+
+/**
+ * @brief Fake microsecond counter.
+ */
+static uint32_t fakeMicros(void) {
+    return (fakeUs);
+}
+
+/**
+ * @brief Completion callback, records the outcome.
+ */
+static void onDone(I2C_ResultTypedef result, void *context) {
+    (void)context;
+    lastResult = result;
+    finished++;
+}
+
+/**
+ * @brief Builds a transaction with no chunking, release or deadline.
+ *
+ * @param client Client number.
+ * @param address Device address.
+ * @param length Number of bytes.
+ * @param priority Priority of the transaction.
+ * @return I2C_TransactionTypedef The transaction.
+ */
+static I2C_TransactionTypedef transaction(uint8_t client, uint8_t address, uint16_t length,
+                                          uint8_t priority) {
+    I2C_TransactionTypedef result = {.client = client,
+                                     .address = address,
+                                     .direction = I2C_BUS_WRITE,
+                                     .data = data,
+                                     .length = length,
+                                     .priority = priority,
+                                     .done = onDone};
+    return (result);
+}
+
+/**
+ * @brief Initializes the test environment with two clients.
+ */
+void setUp(void) {
+    fakeUs = 5000;
+    frames = 0;
+    finished = 0;
+    lastResult = I2C_RESULT_ERROR;
+    I2C_busInit(fakeTransfer, fakeMillis, fakeMicros);
+    I2C_busRegisterClient();
+    I2C_busRegisterClient();
+}
+
+//! @test Requirement 1: Queued transactions must be sent by priority, then by deadline.
+void test_I2C_bus_orders_by_priority_and_deadline(void) {
+    I2C_TransactionTypedef low = transaction(0, 0x27, 1, I2C_BUS_PRIORITY_BACKGROUND);
+    I2C_TransactionTypedef late = transaction(1, 0x48, 1, I2C_BUS_PRIORITY_NORMAL);
+    I2C_TransactionTypedef soon = transaction(1, 0x49, 1, I2C_BUS_PRIORITY_NORMAL);
+    late.deadlineMs = 100;
+    soon.deadlineMs = 50;
+    TEST_ASSERT_TRUE(I2C_busSubmit(&low));
+    TEST_ASSERT_TRUE(I2C_busSubmit(&late));
+    TEST_ASSERT_TRUE(I2C_busSubmit(&soon));
+    while (I2C_busService()) {
+    }
+    TEST_ASSERT_EQUAL(3, frames);
+    TEST_ASSERT_EQUAL_HEX8(0x49, trace[0]);
+    TEST_ASSERT_EQUAL_HEX8(0x48, trace[1]);
+    TEST_ASSERT_EQUAL_HEX8(0x27, trace[2]);
+    TEST_ASSERT_EQUAL(3, finished);
+}
+
+//! @test Requirement 2: A transaction must not be sent before its release time.
+void test_I2C_bus_waits_for_release(void) {
+    I2C_TransactionTypedef read = transaction(1, 0x48, 2, I2C_BUS_PRIORITY_URGENT);
+    read.releaseMs = 8;
+    I2C_busSubmit(&read);
+    TEST_ASSERT_FALSE(I2C_busService());
+    fakeUs = 8000;
+    TEST_ASSERT_TRUE(I2C_busService());
+    TEST_ASSERT_EQUAL(1, frames);
+    TEST_ASSERT_EQUAL(I2C_RESULT_OK, lastResult);
+}
+
+//! @test Requirement 3: A transaction past its deadline must fail without using the bus.
+void test_I2C_bus_drops_missed_deadline(void) {
+    I2C_BusClientStatsTypedef stats;
+    I2C_TransactionTypedef read = transaction(1, 0x48, 2, I2C_BUS_PRIORITY_URGENT);
+    read.deadlineMs = 6;
+    I2C_busSubmit(&read);
+    fakeUs = 7000;
+    TEST_ASSERT_TRUE(I2C_busService());
+    TEST_ASSERT_EQUAL(0, frames);
+    TEST_ASSERT_EQUAL(I2C_RESULT_TIMEOUT, lastResult);
+    I2C_busGetClientStats(1, &stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.deadlineMisses);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.failures);
+}
+
+//! @test Requirement 4: A more urgent transaction must go between the frames of a chunked one.
+void test_I2C_bus_splits_chunked_transaction(void) {
+    I2C_BusClientStatsTypedef stats;
+    I2C_TransactionTypedef burst = transaction(0, 0x27, 10, I2C_BUS_PRIORITY_BACKGROUND);
+    I2C_TransactionTypedef read = transaction(1, 0x48, 2, I2C_BUS_PRIORITY_URGENT);
+    burst.chunk = 4;
+    I2C_busSubmit(&burst);
+    I2C_busService();
+    I2C_busSubmit(&read);
+    while (I2C_busService()) {
+    }
+    TEST_ASSERT_EQUAL(4, frames);
+    TEST_ASSERT_EQUAL_HEX8(0x27, trace[0]);
+    TEST_ASSERT_EQUAL_HEX8(0x48, trace[1]);
+    TEST_ASSERT_EQUAL(4, traceLength[2]);
+    TEST_ASSERT_EQUAL(2, traceLength[3]);
+    I2C_busGetClientStats(0, &stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.preemptions);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.transactions);
+    TEST_ASSERT_EQUAL_UINT32(10, stats.bytes);
+}
+
+//! @test Requirement 5: A blocking frame must first send the due transactions that are more urgent.
+void test_I2C_bus_blocking_frame_yields(void) {
+    uint8_t byte = 0x55;
+    I2C_TransactionTypedef read = transaction(1, 0x48, 2, I2C_BUS_PRIORITY_URGENT);
+    I2C_TransactionTypedef log = transaction(1, 0x50, 8, I2C_BUS_PRIORITY_BACKGROUND);
+    I2C_busSubmit(&log);
+    I2C_busSubmit(&read);
+    TEST_ASSERT_EQUAL(I2C_RESULT_OK,
+                      I2C_busTransfer(0, I2C_BUS_PRIORITY_NORMAL, 0x27, I2C_BUS_WRITE, &byte, 1));
+    TEST_ASSERT_EQUAL(2, frames);
+    TEST_ASSERT_EQUAL_HEX8(0x48, trace[0]);
+    TEST_ASSERT_EQUAL_HEX8(0x27, trace[1]);
+}
+
+//! @test Requirement 6: The bus time of every client must be accounted separately.
+void test_I2C_bus_accounts_occupancy(void) {
+    I2C_BusClientStatsTypedef stats;
+    I2C_TransactionTypedef read = transaction(1, 0x48, 5, I2C_BUS_PRIORITY_URGENT);
+    uint8_t byte = 0;
+    I2C_busResetStats();
+    for (uint8_t index = 0; index < 10; index++) {
+        I2C_busTransfer(0, I2C_BUS_PRIORITY_BACKGROUND, 0x27, I2C_BUS_WRITE, &byte, 1);
+    }
+    I2C_busSubmit(&read);
+    I2C_busService();
+    fakeUs += 8500;
+    I2C_busGetClientStats(0, &stats);
+    TEST_ASSERT_EQUAL_UINT32(1000, stats.busyUs);
+    TEST_ASSERT_EQUAL_UINT32(10, stats.transactions);
+    I2C_busGetClientStats(1, &stats);
+    TEST_ASSERT_EQUAL_UINT32(500, stats.busyUs);
+    TEST_ASSERT_EQUAL(100, I2C_busGetOccupancy(0));
+    TEST_ASSERT_EQUAL(50, I2C_busGetOccupancy(1));
+}
+
+//! @test Requirement 7: The client and transaction tables must be bounded.
+void test_I2C_bus_tables_are_bounded(void) {
+    I2C_TransactionTypedef write = transaction(0, 0x27, 1, I2C_BUS_PRIORITY_NORMAL);
+    I2C_TransactionTypedef unknown = transaction(3, 0x27, 1, I2C_BUS_PRIORITY_NORMAL);
+    for (uint8_t index = 2; index < I2C_BUS_MAX_CLIENTS; index++) {
+        TEST_ASSERT_EQUAL(index, I2C_busRegisterClient());
+    }
+    TEST_ASSERT_EQUAL(I2C_BUS_NO_CLIENT, I2C_busRegisterClient());
+    for (uint8_t index = 0; index < I2C_BUS_MAX_PENDING; index++) {
+        TEST_ASSERT_TRUE(I2C_busSubmit(&write));
+    }
+    TEST_ASSERT_FALSE(I2C_busSubmit(&write));
+    I2C_busInit(fakeTransfer, fakeMillis, fakeMicros);
+    I2C_busRegisterClient();
+    TEST_ASSERT_FALSE(I2C_busSubmit(&unknown));
+}
+
+/* === End of documentation ====================================================================
+ */
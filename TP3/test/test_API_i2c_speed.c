@@ -0,0 +1,154 @@
+/************************************************************************************************
+Copyright (c) 2025, Juan Manuel Guariste <juanmaguariste@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** @file test_API_i2c_speed.c
+ ** @brief Unit tests for the I2C clock negotiation module.
+ **/
+
+/*
+    Requirements to be tested:
+    1- The bus must start at the highest configured speed.
+    2- The speed must step down when too many transfers fail within the window.
+    3- Errors that have left the sliding window must not be counted.
+    4- The speed must never go below the lowest configured speed.
+    5- The speed must step back up after a run of clean transfers.
+    6- Each step down must make the next step up wait longer.
+    7- NACKs, timeouts and other errors must be counted separately.
+*/
+
+/* === Headers files inclusions ===============================================================
+ */
+#include "unity.h"
+#include "API_i2c_speed.h"
+
+/* === Macros definitions ======================================================================
+ */
+
+/* === Private data type declarations ==========================================================
+ */
+
+/* === Private variable declarations ===========================================================
+ */
+
+/**
+ *	@brief Speeds used by the tests, highest first.
+ */
+static const uint32_t SPEEDS[] = {400000, 200000, 100000};
+
+/* === Private function declarations ===========================================================
+ */
+
+/* === Public variable definitions =============================================================
+ */
+
+/* === Private variable definitions ============================================================
+ */
+
+/* === Private function implementation =========================================================
+ */
+
+/**
+ * @brief Records the same transfer result several times.
+ *
+ * @param result Result to record.
+ * @param count Number of transfers.
+ * @return uint32_t Number of times the negotiation asked for a new speed.
+ */
+static uint32_t recordMany(I2C_ResultTypedef result, uint32_t count) {
+    uint32_t changes = 0;
+    for (uint32_t index = 0; index < count; index++) {
+        changes += I2C_speedRecord(result);
+    }
+    return changes;
+}
+
+/**
+ * @brief Initializes the test environment.
+ */
+void setUp(void) {
+    I2C_speedInit(SPEEDS, sizeof(SPEEDS) / sizeof(SPEEDS[0]));
+}
+
+//! @test Requirement 1: The bus must start at the highest configured speed.
+void test_I2C_speed_starts_at_highest_speed(void) {
+    TEST_ASSERT_EQUAL_UINT32(400000, I2C_speedGetClock());
+}
+
+//! @test Requirement 2: The speed must step down after too many errors in the window.
+void test_I2C_speed_steps_down_on_errors(void) {
+    TEST_ASSERT_EQUAL(0, recordMany(I2C_RESULT_NACK, I2C_SPEED_STEP_DOWN_ERRORS - 1));
+    TEST_ASSERT_EQUAL_UINT32(400000, I2C_speedGetClock());
+    TEST_ASSERT_TRUE(I2C_speedRecord(I2C_RESULT_NACK));
+    TEST_ASSERT_EQUAL_UINT32(200000, I2C_speedGetClock());
+}
+
+//! @test Requirement 3: Errors that have left the sliding window must not be counted.
+void test_I2C_speed_window_forgets_old_errors(void) {
+    recordMany(I2C_RESULT_TIMEOUT, I2C_SPEED_STEP_DOWN_ERRORS - 1);
+    recordMany(I2C_RESULT_OK, I2C_SPEED_WINDOW);
+    TEST_ASSERT_FALSE(I2C_speedRecord(I2C_RESULT_TIMEOUT));
+    TEST_ASSERT_EQUAL_UINT32(400000, I2C_speedGetClock());
+}
+
+//! @test Requirement 4: The speed must never go below the lowest configured speed.
+void test_I2C_speed_stops_at_lowest_speed(void) {
+    TEST_ASSERT_EQUAL(2, recordMany(I2C_RESULT_ERROR, 10 * I2C_SPEED_STEP_DOWN_ERRORS));
+    TEST_ASSERT_EQUAL_UINT32(100000, I2C_speedGetClock());
+}
+
+//! @test Requirement 5: The speed must step back up after a run of clean transfers.
+void test_I2C_speed_steps_up_after_clean_run(void) {
+    recordMany(I2C_RESULT_NACK, I2C_SPEED_STEP_DOWN_ERRORS);
+    TEST_ASSERT_EQUAL(0, recordMany(I2C_RESULT_OK, 2 * I2C_SPEED_STEP_UP_TRANSFERS - 1));
+    TEST_ASSERT_TRUE(I2C_speedRecord(I2C_RESULT_OK));
+    TEST_ASSERT_EQUAL_UINT32(400000, I2C_speedGetClock());
+}
+
+//! @test Requirement 6: Each step down must make the next step up wait longer.
+void test_I2C_speed_backs_off_probing(void) {
+    recordMany(I2C_RESULT_NACK, I2C_SPEED_STEP_DOWN_ERRORS);
+    recordMany(I2C_RESULT_OK, 2 * I2C_SPEED_STEP_UP_TRANSFERS);
+    recordMany(I2C_RESULT_NACK, I2C_SPEED_STEP_DOWN_ERRORS);
+    TEST_ASSERT_EQUAL_UINT32(200000, I2C_speedGetClock());
+    TEST_ASSERT_EQUAL(0, recordMany(I2C_RESULT_OK, 2 * I2C_SPEED_STEP_UP_TRANSFERS));
+    TEST_ASSERT_EQUAL(1, recordMany(I2C_RESULT_OK, 2 * I2C_SPEED_STEP_UP_TRANSFERS));
+    TEST_ASSERT_EQUAL_UINT32(400000, I2C_speedGetClock());
+}
+
+//! @test Requirement 7: NACKs, timeouts and other errors must be counted separately.
+void test_I2C_speed_counts_errors(void) {
+    I2C_SpeedStatsTypedef stats;
+    I2C_speedRecord(I2C_RESULT_OK);
+    I2C_speedRecord(I2C_RESULT_NACK);
+    I2C_speedRecord(I2C_RESULT_TIMEOUT);
+    I2C_speedRecord(I2C_RESULT_ERROR);
+    I2C_speedGetStats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(400000, stats.clockSpeed);
+    TEST_ASSERT_EQUAL_UINT32(4, stats.transfers);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.nacks);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.timeouts);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.errors);
+    TEST_ASSERT_EQUAL(3, stats.windowErrors);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.stepDowns);
+}
+
+/* === End of documentation ====================================================================
+ */
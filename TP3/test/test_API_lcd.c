@@ -35,13 +35,40 @@ SPDX-License-Identifier: MIT
         3.5- On row 2, column 16
         3.6- On row 1, column 16
     4- It must be possible to print text.
+    5- It must be possible to calibrate the LCD timing using the busy flag:
+        5.1- Measured times plus a safety margin must be reported and used.
+        5.2- If the busy flag never clears, the default timing must be kept.
+    6- A failed write to the I2C expander must be retried.
+    7- When the retries are exhausted the LCD must be recovered without a full initialization:
+        7.1- The bus is freed, the interface resynchronized, the screen repainted from RAM and
+             the message sent again.
+        7.2- If the bus cannot be freed the operation must fail.
+        7.3- The recovery must not wait milliseconds per strobe, only the execution time of
+             every message, so it stays far below the cost of LCD_init().
+    8- It must be possible to control the backlight:
+        8.1- By default the change is applied with the next transfer, without extra writes.
+        8.2- On request it is applied at once with a single expander write without strobe.
+    9- It must be possible to turn the display off and on.
+    10- After a period of inactivity the backlight and then the display must turn off, and the
+        next LCD call must turn them back on.
+        10.1- Setting the backlight or the display also counts as activity.
+        10.2- A display turned off by the timer must stay off through a recovery.
+        10.3- The timer must also turn the backlight off when the display was already off.
+    11- UTF-8 text must be translated to the character ROM of the controller.
+    12- It must be possible to define a CGRAM glyph for a character missing from the ROM.
+    13- Drawing a frame must only send the cells that changed, with one cursor command for
+        every run of consecutive changes.
+    14- A precompiled asset must be streamed in bursts with the backlight applied, leaving the
+        RAM copy of the screen and the glyph bindings as the asset describes.
 */
 
 /* === Headers files inclusions ===============================================================
  */
 #include "unity.h"
 #include "API_lcd.h"
+#include "API_lcd_charset.h"
 #include "mock_API_lcd_port.h"
+#include "string.h"
 
 /* === Macros definitions ======================================================================
  */
@@ -68,6 +95,30 @@ static const uint8_t LCD_INIT_CMD[] = {_4BIT_MODE,
                                        DISPLAY_CONTROL | DISPLAY_ON,
                                        CLEAR_DISPLAY};
 
+/**
+ * @brief Values returned by the stubbed LCD_portReadByte and LCD_portGetMicros calls.
+ */
+static const uint8_t *readValues;
+static const uint32_t *microsValues;
+
+/**
+ * @brief Last delay requested through LCD_portDelayUs.
+ */
+static uint32_t lastDelayUs;
+
+/**
+ * @brief Number of millisecond delays and total of microsecond delays requested.
+ */
+static uint32_t delayMsCount;
+static uint32_t delayUsTotal;
+
+/**
+ * @brief Bytes written through LCD_portWriteBurst and number of bursts.
+ */
+static uint8_t burstBytes[64];
+static uint16_t burstLength;
+static uint32_t burstCount;
+
 /* === Private function declarations ===========================================================
  */
 
@@ -85,6 +136,76 @@ static const uint8_t LCD_INIT_CMD[] = {_4BIT_MODE,
  */
 void setUp(void) {
     LCD_portDelay_Ignore();
+    LCD_portDelayUs_Ignore();
+    backLight = 1;
+    LCD_setBacklight(true, false);
+    LCD_setIdleTimeouts(LCD_IDLE_DISABLED, LCD_IDLE_DISABLED);
+    LCD_charsetInit(LCD_CHARSET_ROM_A00);
+}
+
+/**
+ * @brief Stub for LCD_portReadByte returning the next value of readValues.
+ */
+static bool fakeReadByte(uint8_t * byte, int calls) {
+    *byte = readValues[calls];
+    return true;
+}
+
+/**
+ * @brief Stub for LCD_portGetMicros returning the next value of microsValues.
+ */
+static uint32_t fakeGetMicros(int calls) {
+    return microsValues[calls];
+}
+
+/**
+ * @brief Stub for LCD_portDelayUs recording the requested delay.
+ */
+static void fakeDelayUs(uint32_t delay, int calls) {
+    lastDelayUs = delay;
+}
+
+/**
+ * @brief Stub for LCD_portDelay counting the delays requested.
+ */
+static void countDelayMs(uint32_t delay, int calls) {
+    delayMsCount++;
+}
+
+/**
+ * @brief Stub for LCD_portDelayUs adding up the delays requested.
+ */
+static void sumDelayUs(uint32_t delay, int calls) {
+    delayUsTotal += delay;
+}
+
+/**
+ * @brief Stub for LCD_portWriteBurst recording the bytes written.
+ */
+static bool fakeWriteBurst(uint8_t * bytes, uint16_t length, int calls) {
+    memcpy(&burstBytes[burstLength], bytes, length);
+    burstLength += length;
+    burstCount++;
+    return true;
+}
+
+/**
+ * @brief Encodes a message as tools/lcd_assets.c does, without the backlight bit.
+ *
+ * @param stream Where to store the LCD_ASSET_BYTES_PER_MSG expander bytes.
+ * @param data Data to encode.
+ * @param rs Indicates whether the data is a COMMAND or DATA.
+ * @return uint16_t Number of bytes stored.
+ */
+static uint16_t LCD_encodeMsg(uint8_t * stream, uint8_t data, uint8_t rs) {
+    uint8_t high = (data & HIGH_NIBBLE_MASK) | rs;
+    uint8_t low = ((data & LOW_NIBBLE_MASK) << TO_HIGH_NIBBLE_SHIFT) | rs;
+    stream[0] = high | ENABLE;
+    stream[1] = high;
+    stream[2] = low | ENABLE;
+    stream[3] = low;
+    stream[4] = low;
+    return (LCD_ASSET_BYTES_PER_MSG);
 }
 
 /**
@@ -126,8 +247,24 @@ static void LCD_sendNibble_ExpectAndReturn(uint8_t data, uint8_t rs, bool ret_va
                                  ret_value);
 }
 
-//! @test Requirement 1: Test to verify the LCD initialization sequence.
-void test_LCD_initialization_sequence(void) {
+/**
+ * @brief Mock function simulating the behavior of the private LCD_readBusyFlag function.
+ *
+ * The value read is provided by the fakeReadByte stub.
+ */
+static void LCD_readBusyFlag_Expect(void) {
+    uint8_t idle = HIGH_NIBBLE_MASK | (backLight << BACKLIGHT_SHIFT) | READ_WRITE | COMMAND;
+    LCD_portWriteByte_ExpectAndReturn(idle, true);
+    LCD_portWriteByte_ExpectAndReturn(idle | ENABLE, true);
+    LCD_portWriteByte_ExpectAndReturn(idle, true);
+    LCD_portWriteByte_ExpectAndReturn(idle | ENABLE, true);
+    LCD_portWriteByte_ExpectAndReturn(idle, true);
+}
+
+/**
+ * @brief Expects the complete LCD initialization sequence.
+ */
+static void LCD_init_ExpectSequence(void) {
     port_init_ExpectAndReturn(true);
     LCD_sendNibble_ExpectAndReturn(CMD_INI1, COMMAND, true);
     LCD_sendNibble_ExpectAndReturn(CMD_INI1, COMMAND, true);
@@ -136,6 +273,56 @@ void test_LCD_initialization_sequence(void) {
     for (uint8_t indice = 0; indice < sizeof(LCD_INIT_CMD); indice++) {
         LCD_sendMsg_ExpectAndReturn(LCD_INIT_CMD[indice], COMMAND, true);
     }
+}
+
+/**
+ * @brief Expects the display to be repainted from a RAM copy holding text on row 1.
+ *
+ * @param text Text expected at the beginning of row 1, the rest of the screen is blank.
+ * @param cursor DDRAM address the cursor is expected to be restored to.
+ */
+static void LCD_repaint_Expect(const char * text, uint8_t cursor) {
+    LCD_sendMsg_ExpectAndReturn(LCD_ROW_1_ADDRESS | SET_DDRAM_ADDRESS, COMMAND, true);
+    for (uint8_t col = 0; col < LCD_MAX_COLUMNS; col++) {
+        LCD_sendMsg_ExpectAndReturn(*text ? *text++ : BLANK_CHAR, DATA, true);
+    }
+    LCD_sendMsg_ExpectAndReturn(LCD_ROW_2_ADDRESS | SET_DDRAM_ADDRESS, COMMAND, true);
+    for (uint8_t col = 0; col < LCD_MAX_COLUMNS; col++) {
+        LCD_sendMsg_ExpectAndReturn(BLANK_CHAR, DATA, true);
+    }
+    LCD_sendMsg_ExpectAndReturn(cursor | SET_DDRAM_ADDRESS, COMMAND, true);
+}
+
+/**
+ * @brief Initializes the LCD and prints a short text on row 1.
+ *
+ * @param text Text to print.
+ */
+static void LCD_initWithText(char * text) {
+    LCD_init_ExpectSequence();
+    TEST_ASSERT_EQUAL(LCD_OK, LCD_init());
+    LCD_sendMsg_ExpectAndReturn(CLEAR_DISPLAY, COMMAND, true);
+    LCD_sendMsg_ExpectAndReturn(LCD_ROW_1_ADDRESS | SET_DDRAM_ADDRESS, COMMAND, true);
+    for (int i = 0; text[i] != '\0'; i++) {
+        LCD_sendMsg_ExpectAndReturn(text[i], DATA, true);
+    }
+    TEST_ASSERT_EQUAL(LCD_OK, LCD_printText(text));
+}
+
+/**
+ * @brief Expects the first strobe of a transfer to fail on every retry.
+ *
+ * @param byte Expander byte whose strobe fails.
+ */
+static void LCD_writeExpander_ExpectFailure(uint8_t byte) {
+    for (uint8_t attempt = 0; attempt < LCD_WRITE_RETRIES; attempt++) {
+        LCD_portWriteByte_ExpectAndReturn(byte | ENABLE, false);
+    }
+}
+
+//! @test Requirement 1: Test to verify the LCD initialization sequence.
+void test_LCD_initialization_sequence(void) {
+    LCD_init_ExpectSequence();
     TEST_ASSERT_EQUAL(LCD_OK, LCD_init());
 }
 
@@ -200,5 +387,351 @@ void test_LCD_print_text_correctly(void) {
     TEST_ASSERT_EQUAL(LCD_OK, LCD_printText(text));
 }
 
+//! @test Requirement 5.1: Measured times plus a safety margin must be reported and used.
+void test_LCD_calibrate_timing_with_busy_flag(void) {
+    static const uint8_t reads[] = {BUSY_FLAG, 0, BUSY_FLAG, BUSY_FLAG, 0};
+    static const uint32_t micros[] = {1000, 1020, 1040, 2000, 2600, 3200, 3400};
+    LCD_TimingTypedef timing;
+    readValues = reads;
+    microsValues = micros;
+    LCD_portReadByte_Stub(fakeReadByte);
+    LCD_portGetMicros_Stub(fakeGetMicros);
+
+    LCD_sendMsg_ExpectAndReturn(' ', DATA, true);
+    LCD_readBusyFlag_Expect();
+    LCD_readBusyFlag_Expect();
+    LCD_sendMsg_ExpectAndReturn(CLEAR_DISPLAY, COMMAND, true);
+    LCD_readBusyFlag_Expect();
+    LCD_readBusyFlag_Expect();
+    LCD_readBusyFlag_Expect();
+    TEST_ASSERT_EQUAL(LCD_OK, LCD_calibrateTiming());
+
+    LCD_getTiming(&timing);
+    TEST_ASSERT_TRUE(timing.calibrated);
+    TEST_ASSERT_EQUAL_UINT32(40, timing.dataWriteMeasuredUs);
+    TEST_ASSERT_EQUAL_UINT32(1400, timing.clearHomeMeasuredUs);
+    TEST_ASSERT_EQUAL_UINT32(60, timing.dataWriteUs);
+    TEST_ASSERT_EQUAL_UINT32(2100, timing.clearHomeUs);
+
+    LCD_portDelayUs_Stub(fakeDelayUs);
+    LCD_sendMsg_ExpectAndReturn(CLEAR_DISPLAY, COMMAND, true);
+    TEST_ASSERT_EQUAL(LCD_OK, LCD_clear());
+    TEST_ASSERT_EQUAL_UINT32(2100, lastDelayUs);
+    LCD_sendMsg_ExpectAndReturn((LCD_ROW_2_ADDRESS + 3) | SET_DDRAM_ADDRESS, COMMAND, true);
+    TEST_ASSERT_EQUAL(LCD_OK, LCD_setCursor(LCD_ROW_2, 3));
+    TEST_ASSERT_EQUAL_UINT32(60, lastDelayUs);
+}
+
+//! @test Requirement 5.2: If the busy flag never clears, the default timing must be kept.
+void test_LCD_calibrate_timing_busy_timeout(void) {
+    static const uint8_t reads[] = {BUSY_FLAG, BUSY_FLAG};
+    static const uint32_t micros[] = {0, 10, LCD_BUSY_TIMEOUT_US};
+    LCD_TimingTypedef timing;
+    readValues = reads;
+    microsValues = micros;
+    LCD_portReadByte_Stub(fakeReadByte);
+    LCD_portGetMicros_Stub(fakeGetMicros);
+
+    LCD_sendMsg_ExpectAndReturn(' ', DATA, true);
+    LCD_readBusyFlag_Expect();
+    LCD_readBusyFlag_Expect();
+    TEST_ASSERT_EQUAL(LCD_FAIL, LCD_calibrateTiming());
+
+    LCD_getTiming(&timing);
+    TEST_ASSERT_FALSE(timing.calibrated);
+    TEST_ASSERT_EQUAL_UINT32(DELAY1ms * US_PER_MS, timing.dataWriteUs);
+    TEST_ASSERT_EQUAL_UINT32(DELAY1ms * US_PER_MS, timing.clearHomeUs);
+}
+
+//! @test Requirement 6: A failed write to the I2C expander must be retried.
+void test_LCD_failed_write_is_retried(void) {
+    uint8_t high = (CLEAR_DISPLAY & HIGH_NIBBLE_MASK) | (backLight << BACKLIGHT_SHIFT) | COMMAND;
+    LCD_RecoveryStatsTypedef before, after;
+    LCD_getRecoveryStats(&before);
+    LCD_portWriteByte_ExpectAndReturn(high | ENABLE, false);
+    LCD_portWriteByte_ExpectAndReturn(high | ENABLE, true);
+    LCD_portWriteByte_ExpectAndReturn(high, true);
+    LCD_sendByte_ExpectAndReturn((CLEAR_DISPLAY & LOW_NIBBLE_MASK) << TO_HIGH_NIBBLE_SHIFT |
+                                     (backLight << BACKLIGHT_SHIFT) | COMMAND,
+                                 true);
+    TEST_ASSERT_EQUAL(LCD_OK, LCD_clear());
+    LCD_getRecoveryStats(&after);
+    TEST_ASSERT_EQUAL_UINT32(before.retries + 1, after.retries);
+    TEST_ASSERT_EQUAL_UINT32(before.recoveries, after.recoveries);
+}
+
+//! @test Requirement 7.1: The LCD must be resynchronized and repainted after a failed transfer.
+void test_LCD_recovers_with_resync_and_repaint(void) {
+    uint8_t address = LCD_ROW_2_ADDRESS | SET_DDRAM_ADDRESS;
+    LCD_RecoveryStatsTypedef before, after;
+    LCD_initWithText("Hi");
+    LCD_getRecoveryStats(&before);
+
+    LCD_writeExpander_ExpectFailure((address & HIGH_NIBBLE_MASK) | (backLight << BACKLIGHT_SHIFT));
+    LCD_portBusRecovery_ExpectAndReturn(true);
+    LCD_sendNibble_ExpectAndReturn(CMD_INI1, COMMAND, true);
+    LCD_sendNibble_ExpectAndReturn(CMD_INI1, COMMAND, true);
+    LCD_sendNibble_ExpectAndReturn(CMD_INI1, COMMAND, true);
+    LCD_sendNibble_ExpectAndReturn(CMD_INI2, COMMAND, true);
+    LCD_sendMsg_ExpectAndReturn(_4BIT_MODE, COMMAND, true);
+    LCD_sendMsg_ExpectAndReturn(DISPLAY_CONTROL | DISPLAY_ON, COMMAND, true);
+    LCD_sendMsg_ExpectAndReturn(ENTRY_MODE_SET | AUTOINCREMENT, COMMAND, true);
+    LCD_repaint_Expect("Hi", LCD_ROW_1_ADDRESS + 2);
+    LCD_sendMsg_ExpectAndReturn(address, COMMAND, true);
+    TEST_ASSERT_EQUAL(LCD_OK, LCD_setCursor(LCD_ROW_2, LCD_COL_0));
+
+    LCD_getRecoveryStats(&after);
+    TEST_ASSERT_EQUAL_UINT32(before.recoveries + 1, after.recoveries);
+    TEST_ASSERT_EQUAL_UINT32(before.failures, after.failures);
+}
+
+//! @test Requirement 7.2: If the bus cannot be freed the operation must fail.
+void test_LCD_recovery_fails_when_bus_is_stuck(void) {
+    LCD_RecoveryStatsTypedef before, after;
+    LCD_initWithText("Hi");
+    LCD_getRecoveryStats(&before);
+
+    LCD_writeExpander_ExpectFailure((CLEAR_DISPLAY & HIGH_NIBBLE_MASK) |
+                                    (backLight << BACKLIGHT_SHIFT) | COMMAND);
+    LCD_portBusRecovery_ExpectAndReturn(false);
+    TEST_ASSERT_EQUAL(LCD_FAIL, LCD_clear());
+
+    LCD_getRecoveryStats(&after);
+    TEST_ASSERT_EQUAL_UINT32(before.failures + 1, after.failures);
+}
+
+//! @test Requirement 7.3: Only the message sent again may use the strobe delays, the recovery
+//! itself waits the execution times in microseconds.
+void test_LCD_recovery_is_bounded_in_time(void) {
+    uint8_t address = LCD_ROW_2_ADDRESS | SET_DDRAM_ADDRESS;
+    uint32_t messages = LCD_RESYNC_NIBBLES + 1 + 3 + LCD_FRAME_SIZE + LCD_CANTIDAD_FILAS + 1;
+    LCD_TimingTypedef timing;
+    LCD_initWithText("Hi");
+
+    delayMsCount = 0;
+    delayUsTotal = 0;
+    LCD_portDelay_Stub(countDelayMs);
+    LCD_portDelayUs_Stub(sumDelayUs);
+    LCD_writeExpander_ExpectFailure((address & HIGH_NIBBLE_MASK) | (backLight << BACKLIGHT_SHIFT));
+    LCD_portBusRecovery_ExpectAndReturn(true);
+    LCD_sendNibble_ExpectAndReturn(CMD_INI1, COMMAND, true);
+    LCD_sendNibble_ExpectAndReturn(CMD_INI1, COMMAND, true);
+    LCD_sendNibble_ExpectAndReturn(CMD_INI1, COMMAND, true);
+    LCD_sendNibble_ExpectAndReturn(CMD_INI2, COMMAND, true);
+    LCD_sendMsg_ExpectAndReturn(_4BIT_MODE, COMMAND, true);
+    LCD_sendMsg_ExpectAndReturn(DISPLAY_CONTROL | DISPLAY_ON, COMMAND, true);
+    LCD_sendMsg_ExpectAndReturn(ENTRY_MODE_SET | AUTOINCREMENT, COMMAND, true);
+    LCD_repaint_Expect("Hi", LCD_ROW_1_ADDRESS + 2);
+    LCD_sendMsg_ExpectAndReturn(address, COMMAND, true);
+    TEST_ASSERT_EQUAL(LCD_OK, LCD_setCursor(LCD_ROW_2, LCD_COL_0));
+
+    TEST_ASSERT_EQUAL_UINT32(4, delayMsCount);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(LCD_RECOVERY_CLEAR_HOME_US +
+                                         messages * LCD_RECOVERY_DATA_WRITE_US,
+                                     delayUsTotal);
+    LCD_getTiming(&timing);
+    TEST_ASSERT_FALSE(timing.calibrated);
+}
+
+//! @test Requirement 8.1: The backlight must change with the next transfer.
+void test_LCD_backlight_is_applied_lazily(void) {
+    TEST_ASSERT_EQUAL(LCD_OK, LCD_setBacklight(false, false));
+    backLight = 0;
+    LCD_sendMsg_ExpectAndReturn(CLEAR_DISPLAY, COMMAND, true);
+    TEST_ASSERT_EQUAL(LCD_OK, LCD_clear());
+}
+
+//! @test Requirement 8.2: The backlight must change at once with a single write.
+void test_LCD_backlight_is_applied_immediately(void) {
+    LCD_portWriteByte_ExpectAndReturn(0 << BACKLIGHT_SHIFT, true);
+    TEST_ASSERT_EQUAL(LCD_OK, LCD_setBacklight(false, true));
+    LCD_portWriteByte_ExpectAndReturn(1 << BACKLIGHT_SHIFT, true);
+    TEST_ASSERT_EQUAL(LCD_OK, LCD_setBacklight(true, true));
+}
+
+//! @test Requirement 9: It must be possible to turn the display off and on.
+void test_LCD_display_off_and_on(void) {
+    LCD_sendMsg_ExpectAndReturn(DISPLAY_CONTROL, COMMAND, true);
+    TEST_ASSERT_EQUAL(LCD_OK, LCD_setDisplay(false));
+    LCD_sendMsg_ExpectAndReturn(DISPLAY_CONTROL | DISPLAY_ON, COMMAND, true);
+    TEST_ASSERT_EQUAL(LCD_OK, LCD_setDisplay(true));
+}
+
+//! @test Requirement 10: Inactivity must turn the backlight and display off until the next call.
+void test_LCD_idle_timer_powers_down_and_wakes(void) {
+    LCD_setIdleTimeouts(1000, 5000);
+    TEST_ASSERT_EQUAL(LCD_OK, LCD_idleTask(100));
+    TEST_ASSERT_EQUAL(LCD_OK, LCD_idleTask(1099));
+    TEST_ASSERT_EQUAL(LCD_IDLE_ACTIVE, LCD_getIdleState());
+
+    LCD_portWriteByte_ExpectAndReturn(0 << BACKLIGHT_SHIFT, true);
+    TEST_ASSERT_EQUAL(LCD_OK, LCD_idleTask(1100));
+    TEST_ASSERT_EQUAL(LCD_IDLE_DIMMED, LCD_getIdleState());
+
+    backLight = 0;
+    LCD_sendMsg_ExpectAndReturn(DISPLAY_CONTROL, COMMAND, true);
+    TEST_ASSERT_EQUAL(LCD_OK, LCD_idleTask(5100));
+    TEST_ASSERT_EQUAL(LCD_IDLE_OFF, LCD_getIdleState());
+    TEST_ASSERT_EQUAL(LCD_OK, LCD_idleTask(9000));
+
+    backLight = 1;
+    LCD_sendMsg_ExpectAndReturn(DISPLAY_CONTROL | DISPLAY_ON, COMMAND, true);
+    LCD_sendMsg_ExpectAndReturn(CLEAR_DISPLAY, COMMAND, true);
+    TEST_ASSERT_EQUAL(LCD_OK, LCD_clear());
+    TEST_ASSERT_EQUAL(LCD_IDLE_ACTIVE, LCD_getIdleState());
+}
+
+//! @test Requirement 10.1: The backlight and display calls must wake the display.
+void test_LCD_backlight_and_display_calls_are_activity(void) {
+    LCD_setIdleTimeouts(1000, 5000);
+    TEST_ASSERT_EQUAL(LCD_OK, LCD_idleTask(0));
+    LCD_portWriteByte_ExpectAndReturn(0 << BACKLIGHT_SHIFT, true);
+    TEST_ASSERT_EQUAL(LCD_OK, LCD_idleTask(1000));
+    TEST_ASSERT_EQUAL(LCD_IDLE_DIMMED, LCD_getIdleState());
+
+    TEST_ASSERT_EQUAL(LCD_OK, LCD_setBacklight(true, false));
+    TEST_ASSERT_EQUAL(LCD_IDLE_ACTIVE, LCD_getIdleState());
+    TEST_ASSERT_EQUAL(LCD_OK, LCD_idleTask(1500));
+    TEST_ASSERT_EQUAL(LCD_OK, LCD_idleTask(2499));
+    TEST_ASSERT_EQUAL(LCD_IDLE_ACTIVE, LCD_getIdleState());
+
+    backLight = 0;
+    LCD_portWriteByte_ExpectAndReturn(0 << BACKLIGHT_SHIFT, true);
+    LCD_sendMsg_ExpectAndReturn(DISPLAY_CONTROL, COMMAND, true);
+    TEST_ASSERT_EQUAL(LCD_OK, LCD_idleTask(6500));
+    TEST_ASSERT_EQUAL(LCD_IDLE_OFF, LCD_getIdleState());
+
+    backLight = 1;
+    LCD_sendMsg_ExpectAndReturn(DISPLAY_CONTROL | DISPLAY_ON, COMMAND, true);
+    TEST_ASSERT_EQUAL(LCD_OK, LCD_setDisplay(true));
+    TEST_ASSERT_EQUAL(LCD_IDLE_ACTIVE, LCD_getIdleState());
+}
+
+//! @test Requirement 10.2: A recovery must not turn on a display turned off by the timer.
+void test_LCD_idle_off_survives_recovery(void) {
+    uint8_t off = DISPLAY_CONTROL;
+    LCD_initWithText("Hi");
+    LCD_setIdleTimeouts(LCD_IDLE_DISABLED, 1000);
+    TEST_ASSERT_EQUAL(LCD_OK, LCD_idleTask(0));
+
+    backLight = 0;
+    LCD_writeExpander_ExpectFailure((off & HIGH_NIBBLE_MASK) | COMMAND);
+    LCD_portBusRecovery_ExpectAndReturn(true);
+    LCD_sendNibble_ExpectAndReturn(CMD_INI1, COMMAND, true);
+    LCD_sendNibble_ExpectAndReturn(CMD_INI1, COMMAND, true);
+    LCD_sendNibble_ExpectAndReturn(CMD_INI1, COMMAND, true);
+    LCD_sendNibble_ExpectAndReturn(CMD_INI2, COMMAND, true);
+    LCD_sendMsg_ExpectAndReturn(_4BIT_MODE, COMMAND, true);
+    LCD_sendMsg_ExpectAndReturn(off, COMMAND, true);
+    LCD_sendMsg_ExpectAndReturn(ENTRY_MODE_SET | AUTOINCREMENT, COMMAND, true);
+    LCD_repaint_Expect("Hi", LCD_ROW_1_ADDRESS + 2);
+    LCD_sendMsg_ExpectAndReturn(off, COMMAND, true);
+    TEST_ASSERT_EQUAL(LCD_OK, LCD_idleTask(1000));
+    TEST_ASSERT_EQUAL(LCD_IDLE_OFF, LCD_getIdleState());
+
+    backLight = 1;
+    LCD_sendMsg_ExpectAndReturn(DISPLAY_CONTROL | DISPLAY_ON, COMMAND, true);
+    LCD_sendMsg_ExpectAndReturn(CLEAR_DISPLAY, COMMAND, true);
+    TEST_ASSERT_EQUAL(LCD_OK, LCD_clear());
+}
+
+//! @test Requirement 10.3: The timer must turn off the backlight of a display already off.
+void test_LCD_idle_off_darkens_a_display_already_off(void) {
+    LCD_sendMsg_ExpectAndReturn(DISPLAY_CONTROL, COMMAND, true);
+    TEST_ASSERT_EQUAL(LCD_OK, LCD_setDisplay(false));
+    LCD_setIdleTimeouts(LCD_IDLE_DISABLED, 1000);
+    TEST_ASSERT_EQUAL(LCD_OK, LCD_idleTask(0));
+
+    LCD_portWriteByte_ExpectAndReturn(0 << BACKLIGHT_SHIFT, true);
+    TEST_ASSERT_EQUAL(LCD_OK, LCD_idleTask(1000));
+    TEST_ASSERT_EQUAL(LCD_IDLE_OFF, LCD_getIdleState());
+    TEST_ASSERT_EQUAL(LCD_OK, LCD_idleTask(2000));
+}
+
+//! @test Requirement 11: UTF-8 text must be sent as character ROM codes.
+void test_LCD_print_utf8_text(void) {
+    LCD_sendMsg_ExpectAndReturn(CLEAR_DISPLAY, COMMAND, true);
+    LCD_sendMsg_ExpectAndReturn(LCD_ROW_1_ADDRESS | SET_DDRAM_ADDRESS, COMMAND, true);
+    LCD_sendMsg_ExpectAndReturn('2', DATA, true);
+    LCD_sendMsg_ExpectAndReturn(0xDF, DATA, true); // degree sign
+    LCD_sendMsg_ExpectAndReturn(0xEE, DATA, true); // n with tilde
+    LCD_sendMsg_ExpectAndReturn(LCD_CHARSET_REPLACEMENT, DATA, true);
+    TEST_ASSERT_EQUAL(LCD_OK, LCD_printText("2°ñé"));
+}
+
+//! @test Requirement 12: A glyph written to CGRAM must be used for its character.
+void test_LCD_define_glyph(void) {
+    static const uint8_t aAcute[LCD_GLYPH_ROWS] = {0x02, 0x04, 0x0E, 0x01, 0x0F, 0x11, 0x0F, 0x00};
+    LCD_initWithText("Hi");
+    LCD_sendMsg_ExpectAndReturn(SET_CGRAM_ADDRESS | (1 * LCD_GLYPH_ROWS), COMMAND, true);
+    for (uint8_t row = 0; row < LCD_GLYPH_ROWS; row++) {
+        LCD_sendMsg_ExpectAndReturn(aAcute[row], DATA, true);
+    }
+    LCD_sendMsg_ExpectAndReturn((LCD_ROW_1_ADDRESS + 2) | SET_DDRAM_ADDRESS, COMMAND, true);
+    TEST_ASSERT_EQUAL(LCD_OK, LCD_defineGlyph(1, aAcute, 0x00E1));
+    TEST_ASSERT_EQUAL(LCD_FAIL, LCD_defineGlyph(LCD_CHARSET_CGRAM_SLOTS, aAcute, 0x00E9));
+
+    LCD_sendMsg_ExpectAndReturn(CLEAR_DISPLAY, COMMAND, true);
+    LCD_sendMsg_ExpectAndReturn(LCD_ROW_1_ADDRESS | SET_DDRAM_ADDRESS, COMMAND, true);
+    LCD_sendMsg_ExpectAndReturn(0x01, DATA, true);
+    TEST_ASSERT_EQUAL(LCD_OK, LCD_printText("á"));
+}
+
+//! @test Requirement 13: A frame is drawn by sending only the cells that changed.
+void test_LCD_draw_frame_sends_only_changes(void) {
+    uint8_t frame[LCD_FRAME_SIZE];
+    LCD_initWithText("Hi");
+    memset(frame, BLANK_CHAR, sizeof(frame));
+    memcpy(frame, "Ho", 2);
+    memcpy(&frame[LCD_MAX_COLUMNS + 3], "ab", 2);
+    LCD_sendMsg_ExpectAndReturn((LCD_ROW_1_ADDRESS + 1) | SET_DDRAM_ADDRESS, COMMAND, true);
+    LCD_sendMsg_ExpectAndReturn('o', DATA, true);
+    LCD_sendMsg_ExpectAndReturn((LCD_ROW_2_ADDRESS + 3) | SET_DDRAM_ADDRESS, COMMAND, true);
+    LCD_sendMsg_ExpectAndReturn('a', DATA, true);
+    LCD_sendMsg_ExpectAndReturn('b', DATA, true);
+    TEST_ASSERT_EQUAL(LCD_OK, LCD_drawFrame(frame));
+    TEST_ASSERT_EQUAL(LCD_OK, LCD_drawFrame(frame));
+}
+
+//! @test Requirement 14: A precompiled asset is streamed in bursts and tracked in RAM.
+void test_LCD_blit_streams_asset(void) {
+    static const uint32_t glyphs[LCD_CHARSET_CGRAM_SLOTS] = {[3] = 0x2191};
+    uint8_t stream[7 * LCD_ASSET_BYTES_PER_MSG];
+    uint8_t frame[LCD_FRAME_SIZE];
+    uint16_t length = 0;
+    memset(frame, BLANK_CHAR, sizeof(frame));
+    memcpy(frame, "Ho", 2);
+    frame[LCD_MAX_COLUMNS] = 3;
+    frame[LCD_MAX_COLUMNS + 1] = '!';
+    length += LCD_encodeMsg(&stream[length], LCD_ROW_1_ADDRESS | SET_DDRAM_ADDRESS, COMMAND);
+    length += LCD_encodeMsg(&stream[length], 'H', DATA);
+    length += LCD_encodeMsg(&stream[length], 'o', DATA);
+    length += LCD_encodeMsg(&stream[length], LCD_ROW_2_ADDRESS | SET_DDRAM_ADDRESS, COMMAND);
+    length += LCD_encodeMsg(&stream[length], 3, DATA);
+    length += LCD_encodeMsg(&stream[length], '!', DATA);
+    length += LCD_encodeMsg(&stream[length], LCD_ROW_1_ADDRESS | SET_DDRAM_ADDRESS, COMMAND);
+    const LCD_AssetTypedef asset = {.stream = stream, .length = length, .frame = frame,
+                                    .glyphs = glyphs};
+    const LCD_AssetTypedef broken = {.stream = stream, .length = length - 1};
+
+    LCD_initWithText("Hi");
+    burstLength = 0;
+    burstCount = 0;
+    LCD_portWriteBurst_StubWithCallback(fakeWriteBurst);
+    TEST_ASSERT_EQUAL(LCD_OK, LCD_blit(&asset));
+    TEST_ASSERT_EQUAL(2, burstCount);
+    TEST_ASSERT_EQUAL(length, burstLength);
+    for (uint16_t index = 0; index < length; index++) {
+        TEST_ASSERT_EQUAL_HEX8(stream[index] | (backLight << BACKLIGHT_SHIFT), burstBytes[index]);
+    }
+    TEST_ASSERT_EQUAL(3, LCD_charsetMap(0x2191));
+    TEST_ASSERT_EQUAL(LCD_OK, LCD_drawFrame(frame));
+
+    frame[0] = 'X';
+    LCD_sendMsg_ExpectAndReturn('X', DATA, true);
+    TEST_ASSERT_EQUAL(LCD_OK, LCD_drawFrame(frame));
+    TEST_ASSERT_EQUAL(LCD_FAIL, LCD_blit(&broken));
+}
+
 /* === End of documentation ====================================================================
  */
@@ -0,0 +1,158 @@
+/************************************************************************************************
+Copyright (c) 2025, Juan Manuel Guariste <juanmaguariste@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** @file test_API_lcd_charset.c
+ ** @brief Unit tests for the UTF-8 to character ROM translation.
+ **/
+
+/*
+    Requirements to be tested:
+    1- ASCII must cost a single byte and map to the same code, except where the ROM differs.
+    2- Multi-byte characters must only produce a code when their last byte arrives.
+    3- Latin-1 letters and symbols must map to the codes of the selected ROM.
+    4- Invalid and overlong sequences must produce the replacement character, and a sequence
+       cut short must be dropped without swallowing the next character.
+    5- Characters missing from the ROM must fall back to the CGRAM glyph bound to them.
+*/
+
+/* === Headers files inclusions ===============================================================
+ */
+#include "unity.h"
+#include "API_lcd_charset.h"
+#include "string.h"
+
+/* === Macros definitions ======================================================================
+ */
+
+/* === Private data type declarations ==========================================================
+ */
+
+/* === Private variable declarations ===========================================================
+ */
+
+/* === Private function declarations ===========================================================
+ */
+
+/* === Public variable definitions =============================================================
+ */
+
+/* === Private variable definitions ============================================================
+ */
+
+/* === Private function implementation =========================================================
+ */
+
+/**
+ * @brief Decodes a whole string and collects the codes produced.
+ *
+ * @param text UTF-8 text to decode.
+ * @param codes Where to store the codes.
+ * @return uint8_t Number of codes produced.
+ */
+static uint8_t decodeText(const char * text, uint8_t * codes) {
+    LCD_Utf8DecoderTypedef decoder;
+    uint8_t count = 0;
+    LCD_charsetDecoderInit(&decoder);
+    for (size_t index = 0; index < strlen(text); index++) {
+        count += LCD_charsetDecode(&decoder, (uint8_t)text[index], &codes[count]);
+    }
+    return count;
+}
+
+/* === Public function implementation ==========================================================
+ */
+
+void setUp(void) {
+    LCD_charsetInit(LCD_CHARSET_ROM_A00);
+}
+
+//! @test Requirement 1: ASCII maps to itself, except the characters the A00 ROM lacks.
+void test_ascii_maps_to_itself(void) {
+    uint8_t codes[8];
+    TEST_ASSERT_EQUAL(5, decodeText("Az09~", codes));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY("Az09?", codes, 5);
+    TEST_ASSERT_EQUAL_HEX8(LCD_CHARSET_REPLACEMENT, LCD_charsetMap('\\'));
+    TEST_ASSERT_EQUAL_HEX8(0x03, LCD_charsetMap(0x03));
+
+    LCD_charsetInit(LCD_CHARSET_ROM_A02);
+    TEST_ASSERT_EQUAL_HEX8('\\', LCD_charsetMap('\\'));
+    TEST_ASSERT_EQUAL_HEX8('~', LCD_charsetMap('~'));
+}
+
+//! @test Requirement 2: A multi-byte character produces a single code with its last byte.
+void test_multibyte_characters_are_streamed(void) {
+    LCD_Utf8DecoderTypedef decoder;
+    uint8_t code = 0;
+    LCD_charsetDecoderInit(&decoder);
+    TEST_ASSERT_FALSE(LCD_charsetDecode(&decoder, 0xE2, &code)); // U+2192 right arrow
+    TEST_ASSERT_FALSE(LCD_charsetDecode(&decoder, 0x86, &code));
+    TEST_ASSERT_TRUE(LCD_charsetDecode(&decoder, 0x92, &code));
+    TEST_ASSERT_EQUAL_HEX8(0x7E, code);
+}
+
+//! @test Requirement 3: Spanish letters and symbols map to the codes of each ROM.
+void test_latin1_and_symbols_follow_the_rom(void) {
+    uint8_t codes[8];
+    TEST_ASSERT_EQUAL(5, decodeText("25°ñá", codes));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(((uint8_t[]){'2', '5', 0xDF, 0xEE, LCD_CHARSET_REPLACEMENT}),
+                                 codes, 5);
+    TEST_ASSERT_EQUAL(3, decodeText("µαΩ", codes));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(((uint8_t[]){0xE4, 0xE0, 0xF4}), codes, 3);
+
+    LCD_charsetInit(LCD_CHARSET_ROM_A02);
+    TEST_ASSERT_EQUAL(6, decodeText("¿Ñú°?≥", codes));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(((uint8_t[]){0xBF, 0xD1, 0xFA, 0xB0, '?', 0x1D}), codes, 6);
+    TEST_ASSERT_EQUAL_HEX8(LCD_CHARSET_REPLACEMENT, LCD_charsetMap(0x00D8));
+}
+
+//! @test Requirement 4: Malformed text never desynchronizes the decoder.
+void test_malformed_sequences(void) {
+    uint8_t codes[8];
+    // stray continuation, invalid lead byte of an overlong '/', its payload, invalid lead byte
+    TEST_ASSERT_EQUAL(4, decodeText("\x80\xC0\xAF\xFF", codes));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(((uint8_t[]){LCD_CHARSET_REPLACEMENT, LCD_CHARSET_REPLACEMENT,
+                                              LCD_CHARSET_REPLACEMENT, LCD_CHARSET_REPLACEMENT}),
+                                 codes, 4);
+    // overlong three-byte '/', surrogate
+    TEST_ASSERT_EQUAL(2, decodeText("\xE0\x80\xAF\xED\xA0\x80", codes));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(((uint8_t[]){LCD_CHARSET_REPLACEMENT, LCD_CHARSET_REPLACEMENT}),
+                                 codes, 2);
+    // a sequence cut short by the next character is dropped
+    TEST_ASSERT_EQUAL(1, decodeText("\xC3" "A\xE2\x86", codes));
+    TEST_ASSERT_EQUAL_HEX8('A', codes[0]);
+}
+
+//! @test Requirement 5: Characters missing from the ROM use the CGRAM glyph bound to them.
+void test_cgram_fallback(void) {
+    TEST_ASSERT_TRUE(LCD_charsetBindGlyph(2, 0x00E1));
+    TEST_ASSERT_TRUE(LCD_charsetBindGlyph(0, '\\'));
+    TEST_ASSERT_TRUE(LCD_charsetBindGlyph(3, 0x00F1));
+    TEST_ASSERT_FALSE(LCD_charsetBindGlyph(LCD_CHARSET_CGRAM_SLOTS, 0x00E9));
+    TEST_ASSERT_EQUAL_HEX8(2, LCD_charsetMap(0x00E1));
+    TEST_ASSERT_EQUAL_HEX8(0, LCD_charsetMap('\\'));
+    TEST_ASSERT_EQUAL_HEX8(0xEE, LCD_charsetMap(0x00F1)); // the ROM glyph wins
+    TEST_ASSERT_EQUAL_HEX8(LCD_CHARSET_REPLACEMENT, LCD_charsetMap(0x00E9));
+
+    LCD_charsetInit(LCD_CHARSET_ROM_A00);
+    TEST_ASSERT_EQUAL_HEX8(LCD_CHARSET_REPLACEMENT, LCD_charsetMap(0x00E1));
+}
+
+/* === End of documentation ==================================================================== */
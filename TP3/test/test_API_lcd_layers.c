@@ -0,0 +1,178 @@
+/************************************************************************************************
+Copyright (c) 2025, Juan Manuel Guariste <juanmaguariste@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** @file test_API_lcd_layers.c
+ ** @brief Unit tests for the LCD overlay layers.
+ **/
+
+/*
+    Requirements to be tested:
+    1- Text written to the base layer must be shown with the next render.
+    2- An opaque overlay must hide the whole base layer, a transparent one only its own cells.
+    3- Where overlays overlap, the one with the lowest priority value must be on top.
+    4- An overlay must close by itself after its timeout, showing the base layer as it was
+       updated while it was hidden.
+    5- A render without changes must not draw anything.
+    6- Invalid handles must be rejected and overlays are limited to LCD_LAYERS_MAX_OVERLAYS.
+*/
+
+/* === Headers files inclusions ===============================================================
+ */
+#include "unity.h"
+#include "API_lcd_layers.h"
+#include "API_lcd_charset.h"
+#include "mock_API_lcd.h"
+#include "string.h"
+
+/* === Macros definitions ======================================================================
+ */
+
+/* === Private data type declarations ==========================================================
+ */
+
+/* === Private variable declarations ===========================================================
+ */
+
+/**
+ * @brief Last frame drawn and number of frames drawn.
+ */
+static uint8_t drawn[LCD_FRAME_SIZE];
+static uint32_t drawCount;
+
+/* === Private function declarations ===========================================================
+ */
+
+/* === Public variable definitions =============================================================
+ */
+
+/* === Private variable definitions ============================================================
+ */
+
+/* === Private function implementation =========================================================
+ */
+
+/**
+ * @brief Stub for LCD_drawFrame recording the frame.
+ */
+static LCD_StatusTypedef fakeDrawFrame(const uint8_t * frame, int calls) {
+    memcpy(drawn, frame, sizeof(drawn));
+    drawCount++;
+    return LCD_OK;
+}
+
+/**
+ * @brief Checks one row of the last frame drawn.
+ *
+ * @param row Row to check.
+ * @param text Expected LCD_MAX_COLUMNS characters.
+ */
+static void assertRow(uint8_t row, const char * text) {
+    TEST_ASSERT_EQUAL_MEMORY(text, &drawn[row * LCD_MAX_COLUMNS], LCD_MAX_COLUMNS);
+}
+
+/* === Public function implementation ==========================================================
+ */
+
+void setUp(void) {
+    LCD_drawFrame_StubWithCallback(fakeDrawFrame);
+    LCD_charsetInit(LCD_CHARSET_ROM_A00);
+    LCD_layersInit();
+    drawCount = 0;
+}
+
+//! @test Requirement 1: Text written to the base layer is shown with the next render.
+void test_base_layer_is_rendered(void) {
+    LCD_layerWrite(LCD_LAYER_BASE, LCD_ROW_1, 0, "Temp 25");
+    LCD_layerWrite(LCD_LAYER_BASE, LCD_ROW_2, 10, "Modo AUTO");
+    TEST_ASSERT_EQUAL(LCD_OK, LCD_layersRender(0));
+    assertRow(LCD_ROW_1, "Temp 25         ");
+    assertRow(LCD_ROW_2, "          Modo A");
+}
+
+//! @test Requirement 2: Opaque overlays hide everything, transparent ones only their cells.
+void test_opaque_and_transparent_overlays(void) {
+    LCD_layerWrite(LCD_LAYER_BASE, LCD_ROW_1, 0, "Temp 25");
+    int8_t badge = LCD_layerOpen(LCD_LAYER_PRIORITY_NOTICE, LCD_LAYER_NO_TIMEOUT, false);
+    LCD_layerWrite(badge, LCD_ROW_1, 14, "!!");
+    LCD_layersRender(0);
+    assertRow(LCD_ROW_1, "Temp 25       !!");
+
+    int8_t alarm = LCD_layerOpen(LCD_LAYER_PRIORITY_ALARM, LCD_LAYER_NO_TIMEOUT, true);
+    LCD_layerWrite(alarm, LCD_ROW_2, 0, "ALARMA");
+    LCD_layersRender(0);
+    assertRow(LCD_ROW_1, "                ");
+    assertRow(LCD_ROW_2, "ALARMA          ");
+
+    LCD_layerClose(alarm);
+    LCD_layersRender(0);
+    assertRow(LCD_ROW_1, "Temp 25       !!");
+}
+
+//! @test Requirement 3: The overlay with the lowest priority value is on top.
+void test_priority_decides_overlapping_cells(void) {
+    int8_t alarm = LCD_layerOpen(LCD_LAYER_PRIORITY_ALARM, LCD_LAYER_NO_TIMEOUT, false);
+    int8_t notice = LCD_layerOpen(LCD_LAYER_PRIORITY_NOTICE, LCD_LAYER_NO_TIMEOUT, false);
+    LCD_layerWrite(alarm, LCD_ROW_1, 0, "AAA");
+    LCD_layerWrite(notice, LCD_ROW_1, 1, "nnnn");
+    LCD_layersRender(0);
+    assertRow(LCD_ROW_1, "AAAnn           ");
+}
+
+//! @test Requirement 4: Overlays time out and the base shows its latest contents.
+void test_overlay_times_out(void) {
+    LCD_layerWrite(LCD_LAYER_BASE, LCD_ROW_1, 0, "Temp 25");
+    int8_t alarm = LCD_layerOpen(LCD_LAYER_PRIORITY_ALARM, 3000, true);
+    LCD_layerWrite(alarm, LCD_ROW_1, 0, "Puerta abierta");
+    LCD_layersRender(1000);
+    LCD_layerWrite(LCD_LAYER_BASE, LCD_ROW_1, 5, "26°");
+    LCD_layersRender(3999);
+    TEST_ASSERT_TRUE(LCD_layerIsOpen(alarm));
+    assertRow(LCD_ROW_1, "Puerta abierta  ");
+
+    LCD_layersRender(4000);
+    TEST_ASSERT_FALSE(LCD_layerIsOpen(alarm));
+    assertRow(LCD_ROW_1, "Temp 26\xDF        ");
+}
+
+//! @test Requirement 5: A render without changes does not draw.
+void test_render_without_changes_does_not_draw(void) {
+    LCD_layerWrite(LCD_LAYER_BASE, LCD_ROW_1, 0, "Hola");
+    LCD_layersRender(0);
+    LCD_layersRender(10);
+    TEST_ASSERT_EQUAL(1, drawCount);
+    LCD_layerWrite(LCD_LAYER_BASE, LCD_ROW_1, 0, "Hola");
+    LCD_layersRender(20);
+    TEST_ASSERT_EQUAL(1, drawCount);
+}
+
+//! @test Requirement 6: Invalid handles fail and the overlays are limited.
+void test_invalid_handles_and_overlay_limit(void) {
+    for (uint8_t index = 0; index < LCD_LAYERS_MAX_OVERLAYS; index++) {
+        TEST_ASSERT_NOT_EQUAL(LCD_LAYER_NONE, LCD_layerOpen(index, LCD_LAYER_NO_TIMEOUT, false));
+    }
+    TEST_ASSERT_EQUAL(LCD_LAYER_NONE, LCD_layerOpen(0, LCD_LAYER_NO_TIMEOUT, false));
+    TEST_ASSERT_EQUAL(LCD_FAIL, LCD_layerWrite(LCD_LAYER_NONE, LCD_ROW_1, 0, "x"));
+    TEST_ASSERT_EQUAL(LCD_FAIL, LCD_layerWrite(LCD_LAYER_BASE, LCD_CANTIDAD_FILAS, 0, "x"));
+    LCD_layerClose(LCD_LAYER_BASE);
+    TEST_ASSERT_TRUE(LCD_layerIsOpen(LCD_LAYER_BASE));
+}
+
+/* === End of documentation ==================================================================== */
@@ -0,0 +1,189 @@
+/************************************************************************************************
+Copyright (c) 2025, Juan Manuel Guariste <juanmaguariste@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** @file test_API_lcd_pager.c
+ ** @brief Unit tests for the paginated message viewer.
+ **/
+
+/*
+    Requirements to be tested:
+    1- A message must be word-wrapped into rows without breaking words that fit in a row.
+    2- A word longer than a row must be split, and '\n' must force a new line.
+    3- Next and previous must flip the pages, wrapping around at both ends.
+    4- A flip must draw the new page through LCD_drawFrame(), composed from the original string.
+    5- The pages must advance by themselves after the dwell time, a manual flip restarts it.
+    6- UTF-8 characters must take a single cell.
+    7- Lines beyond LCD_PAGER_MAX_LINES must be dropped and reported.
+*/
+
+/* === Headers files inclusions ===============================================================
+ */
+#include "unity.h"
+#include "API_lcd_pager.h"
+#include "API_lcd_charset.h"
+#include "mock_API_lcd.h"
+#include "string.h"
+
+/* === Macros definitions ======================================================================
+ */
+
+/* === Private data type declarations ==========================================================
+ */
+
+/* === Private variable declarations ===========================================================
+ */
+
+/**
+ * @brief Last frame drawn and number of frames drawn.
+ */
+static uint8_t drawn[LCD_FRAME_SIZE];
+static uint32_t drawCount;
+
+static LCD_PagerTypedef pager;
+
+/* === Private function declarations ===========================================================
+ */
+
+/* === Public variable definitions =============================================================
+ */
+
+/* === Private variable definitions ============================================================
+ */
+
+/* === Private function implementation =========================================================
+ */
+
+/**
+ * @brief Stub for LCD_drawFrame recording the frame.
+ */
+static LCD_StatusTypedef fakeDrawFrame(const uint8_t * frame, int calls) {
+    memcpy(drawn, frame, sizeof(drawn));
+    drawCount++;
+    return LCD_OK;
+}
+
+/**
+ * @brief Checks one row of the last frame drawn.
+ *
+ * @param row Row to check.
+ * @param text Expected LCD_MAX_COLUMNS characters.
+ */
+static void assertRow(uint8_t row, const char * text) {
+    TEST_ASSERT_EQUAL_MEMORY(text, &drawn[row * LCD_MAX_COLUMNS], LCD_MAX_COLUMNS);
+}
+
+/* === Public function implementation ==========================================================
+ */
+
+void setUp(void) {
+    LCD_drawFrame_StubWithCallback(fakeDrawFrame);
+    LCD_charsetInit(LCD_CHARSET_ROM_A00);
+    drawCount = 0;
+}
+
+//! @test Requirement 1: Words that fit in a row are never broken.
+void test_message_is_word_wrapped(void) {
+    TEST_ASSERT_EQUAL(LCD_OK, LCD_pagerInit(&pager, "Falla de sensor de temperatura en zona 3",
+                                            LCD_PAGER_NO_DWELL));
+    TEST_ASSERT_EQUAL(2, LCD_pagerPageCount(&pager));
+    TEST_ASSERT_EQUAL(1, drawCount);
+    assertRow(LCD_ROW_1, "Falla de sensor ");
+    assertRow(LCD_ROW_2, "de temperatura  ");
+    LCD_pagerNext(&pager);
+    assertRow(LCD_ROW_1, "en zona 3       ");
+    assertRow(LCD_ROW_2, "                ");
+}
+
+//! @test Requirement 2: Long words are split and '\n' forces a new line.
+void test_long_words_and_line_breaks(void) {
+    LCD_pagerInit(&pager, "Sobretemperatura!!\nOK", LCD_PAGER_NO_DWELL);
+    assertRow(LCD_ROW_1, "Sobretemperatura");
+    assertRow(LCD_ROW_2, "!!              ");
+    LCD_pagerNext(&pager);
+    assertRow(LCD_ROW_1, "OK              ");
+}
+
+//! @test Requirement 3: Pages flip both ways and wrap around at the ends.
+void test_pages_wrap_around(void) {
+    LCD_pagerInit(&pager, "uno\ndos\ntres\ncuatro\ncinco", LCD_PAGER_NO_DWELL);
+    TEST_ASSERT_EQUAL(3, LCD_pagerPageCount(&pager));
+    LCD_pagerPrevious(&pager);
+    TEST_ASSERT_EQUAL(2, LCD_pagerPage(&pager));
+    assertRow(LCD_ROW_1, "cinco           ");
+    LCD_pagerNext(&pager);
+    TEST_ASSERT_EQUAL(0, LCD_pagerPage(&pager));
+    assertRow(LCD_ROW_1, "uno             ");
+    TEST_ASSERT_EQUAL(LCD_FAIL, LCD_pagerShow(&pager, 3));
+    TEST_ASSERT_EQUAL(LCD_OK, LCD_pagerShow(&pager, 1));
+    assertRow(LCD_ROW_2, "cuatro          ");
+}
+
+//! @test Requirement 4: Every flip draws a frame, and the string is not copied.
+void test_flip_draws_frame_from_string(void) {
+    char message[] = "primera\nlinea\nsegunda\npagina";
+    LCD_pagerInit(&pager, message, LCD_PAGER_NO_DWELL);
+    message[14] = 'S';
+    LCD_pagerNext(&pager);
+    TEST_ASSERT_EQUAL(2, drawCount);
+    assertRow(LCD_ROW_1, "Segunda         ");
+}
+
+//! @test Requirement 5: Pages advance after the dwell time, a manual flip restarts it.
+void test_auto_advance(void) {
+    LCD_pagerInit(&pager, "a\nb\nc\nd", 1000);
+    LCD_pagerTick(&pager, 5000);
+    LCD_pagerTick(&pager, 5999);
+    TEST_ASSERT_EQUAL(0, LCD_pagerPage(&pager));
+    LCD_pagerTick(&pager, 6000);
+    TEST_ASSERT_EQUAL(1, LCD_pagerPage(&pager));
+    LCD_pagerTick(&pager, 7000);
+    TEST_ASSERT_EQUAL(0, LCD_pagerPage(&pager));
+    LCD_pagerNext(&pager);
+    LCD_pagerTick(&pager, 7500);
+    LCD_pagerTick(&pager, 8000);
+    TEST_ASSERT_EQUAL(1, LCD_pagerPage(&pager));
+    LCD_pagerTick(&pager, 8500);
+    TEST_ASSERT_EQUAL(0, LCD_pagerPage(&pager));
+}
+
+//! @test Requirement 6: Multi-byte UTF-8 characters take one cell when wrapping.
+void test_utf8_characters_take_one_cell(void) {
+    LCD_pagerInit(&pager, "°°°°°°°°°°°°°°°° fin", LCD_PAGER_NO_DWELL);
+    TEST_ASSERT_EQUAL(1, LCD_pagerPageCount(&pager));
+    TEST_ASSERT_EQUAL_HEX8(LCD_charsetMap(0xB0), drawn[LCD_MAX_COLUMNS - 1]);
+    assertRow(LCD_ROW_2, "fin             ");
+}
+
+//! @test Requirement 7: Lines beyond the index are dropped and reported.
+void test_lines_beyond_index_are_dropped(void) {
+    static char message[LCD_PAGER_MAX_LINES * 2 + 3];
+    for (uint8_t line = 0; line <= LCD_PAGER_MAX_LINES; line++) {
+        message[line * 2] = 'x';
+        message[line * 2 + 1] = '\n';
+    }
+    LCD_pagerInit(&pager, message, LCD_PAGER_NO_DWELL);
+    TEST_ASSERT_TRUE(pager.truncated);
+    TEST_ASSERT_EQUAL(LCD_PAGER_MAX_LINES / LCD_CANTIDAD_FILAS, LCD_pagerPageCount(&pager));
+    TEST_ASSERT_EQUAL(LCD_FAIL, LCD_pagerInit(&pager, NULL, LCD_PAGER_NO_DWELL));
+}
+
+/* === End of documentation ====================================================================
+ */
@@ -0,0 +1,213 @@
+/************************************************************************************************
+Copyright (c) 2025, Juan Manuel Guariste <juanmaguariste@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** @file test_API_lcd_queue.c
+ ** @brief Unit tests for the LCD update queue module.
+ **/
+
+/*
+    Requirements to be tested:
+    1- A posted update must be popped back unchanged.
+    2- Popping from an empty queue must fail.
+    3- Updates must come out in the order they were posted.
+    4- Posting to a full queue must fail and count the update as dropped.
+    5- Text longer than a slot must be truncated and terminated.
+    6- Draining must apply each update through the LCD API, up to the requested amount.
+    7- Several producer threads posting concurrently must not lose or reorder updates.
+    8- An update the LCD API fails to apply must be counted as failed.
+*/
+
+/* === Headers files inclusions ===============================================================
+ */
+#include "unity.h"
+#include "API_lcd_queue.h"
+#include "mock_API_lcd.h"
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* === Macros definitions ======================================================================
+ */
+
+//! Number of producer threads used in the stress test
+#define STRESS_PRODUCERS    8
+//! Number of updates posted by each producer in the stress test
+#define STRESS_UPDATES      20000
+
+/* === Private data type declarations ==========================================================
+ */
+
+/* === Private variable declarations ===========================================================
+ */
+
+/* === Private function declarations ===========================================================
+ */
+
+/* === Public variable definitions =============================================================
+ */
+
+/* === Private variable definitions ============================================================
+ */
+
+/* === Private function implementation =========================================================
+ */
+
+/**
+ * @brief Producer thread for the stress test.
+ *
+ * Posts STRESS_UPDATES cursor updates tagged with its id and a sequence number. While the queue
+ * is full it yields the CPU and retries.
+ *
+ * @param arg Producer id.
+ */
+static void * producerThread(void * arg) {
+    LCD_UpdateTypedef update = {.type = LCD_UPDATE_CURSOR, .row = (uint8_t)(uintptr_t)arg};
+    for (uint32_t sequence = 0; sequence < STRESS_UPDATES; sequence++) {
+        snprintf(update.text, sizeof(update.text), "%u", (unsigned)sequence);
+        while (LCD_queuePost(&update) != LCD_OK) {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Initializes the test environment with an empty queue.
+ */
+void setUp(void) {
+    LCD_queueInit();
+}
+
+//! @test Requirement 1: A posted update must be popped back unchanged.
+void test_LCD_queue_post_and_pop(void) {
+    LCD_UpdateTypedef posted = {.type = LCD_UPDATE_CURSOR, .row = LCD_ROW_2, .col = 5};
+    LCD_UpdateTypedef popped;
+    TEST_ASSERT_EQUAL(LCD_OK, LCD_queuePost(&posted));
+    TEST_ASSERT_EQUAL(LCD_OK, LCD_queuePop(&popped));
+    TEST_ASSERT_EQUAL(LCD_UPDATE_CURSOR, popped.type);
+    TEST_ASSERT_EQUAL(LCD_ROW_2, popped.row);
+    TEST_ASSERT_EQUAL(5, popped.col);
+}
+
+//! @test Requirement 2: Popping from an empty queue must fail.
+void test_LCD_queue_pop_empty(void) {
+    LCD_UpdateTypedef popped;
+    TEST_ASSERT_EQUAL(LCD_FAIL, LCD_queuePop(&popped));
+}
+
+//! @test Requirement 3: Updates must come out in the order they were posted.
+void test_LCD_queue_keeps_order(void) {
+    LCD_UpdateTypedef update = {.type = LCD_UPDATE_CURSOR};
+    for (uint8_t index = 0; index < 3 * LCD_QUEUE_SLOTS; index++) {
+        update.col = index;
+        TEST_ASSERT_EQUAL(LCD_OK, LCD_queuePost(&update));
+        TEST_ASSERT_EQUAL(LCD_OK, LCD_queuePop(&update));
+        TEST_ASSERT_EQUAL(index, update.col);
+    }
+}
+
+//! @test Requirement 4: Posting to a full queue must fail and count the update as dropped.
+void test_LCD_queue_full(void) {
+    LCD_UpdateTypedef update = {.type = LCD_UPDATE_CLEAR};
+    for (uint8_t index = 0; index < LCD_QUEUE_SLOTS; index++) {
+        TEST_ASSERT_EQUAL(LCD_OK, LCD_queuePost(&update));
+    }
+    TEST_ASSERT_EQUAL(LCD_FAIL, LCD_queuePost(&update));
+    TEST_ASSERT_EQUAL(1, LCD_queueGetDropped());
+    TEST_ASSERT_EQUAL(LCD_OK, LCD_queuePop(&update));
+    TEST_ASSERT_EQUAL(LCD_OK, LCD_queuePost(&update));
+}
+
+//! @test Requirement 5: Text longer than a slot must be truncated and terminated.
+void test_LCD_queue_truncates_text(void) {
+    LCD_UpdateTypedef popped;
+    TEST_ASSERT_EQUAL(LCD_OK, LCD_queuePostText("0123456789ABCDEF0123456789ABCDEFextra"));
+    TEST_ASSERT_EQUAL(LCD_OK, LCD_queuePop(&popped));
+    TEST_ASSERT_EQUAL(LCD_UPDATE_TEXT, popped.type);
+    TEST_ASSERT_EQUAL_STRING("0123456789ABCDEF0123456789ABCDEF", popped.text);
+}
+
+//! @test Requirement 6: Draining must apply each update through the LCD API.
+void test_LCD_queue_drain_applies_updates(void) {
+    LCD_UpdateTypedef clear = {.type = LCD_UPDATE_CLEAR};
+    LCD_UpdateTypedef cursor = {.type = LCD_UPDATE_CURSOR, .row = LCD_ROW_2, .col = 3};
+    LCD_queuePost(&clear);
+    LCD_queuePost(&cursor);
+    LCD_queuePostText("Alarm");
+    LCD_clear_ExpectAndReturn(LCD_OK);
+    LCD_setCursor_ExpectAndReturn(LCD_ROW_2, 3, LCD_OK);
+    LCD_printText_ExpectAndReturn("Alarm", LCD_OK);
+    TEST_ASSERT_EQUAL(3, LCD_queueDrain(LCD_QUEUE_SLOTS));
+}
+
+//! @test Requirement 6: Draining must stop after the requested amount of updates.
+void test_LCD_queue_drain_is_bounded(void) {
+    LCD_UpdateTypedef clear = {.type = LCD_UPDATE_CLEAR};
+    LCD_queuePost(&clear);
+    LCD_queuePost(&clear);
+    LCD_clear_ExpectAndReturn(LCD_OK);
+    TEST_ASSERT_EQUAL(1, LCD_queueDrain(1));
+    LCD_clear_ExpectAndReturn(LCD_OK);
+    TEST_ASSERT_EQUAL(1, LCD_queueDrain(LCD_QUEUE_SLOTS));
+    TEST_ASSERT_EQUAL(0, LCD_queueDrain(LCD_QUEUE_SLOTS));
+}
+
+//! @test Requirement 7: Concurrent producers must not lose or reorder updates.
+void test_LCD_queue_many_producers_stress(void) {
+    pthread_t producers[STRESS_PRODUCERS];
+    uint32_t expected[STRESS_PRODUCERS] = {0};
+    uint32_t received = 0;
+    LCD_UpdateTypedef update;
+
+    for (uintptr_t id = 0; id < STRESS_PRODUCERS; id++) {
+        TEST_ASSERT_EQUAL(0, pthread_create(&producers[id], NULL, producerThread, (void *)id));
+    }
+    while (received < STRESS_PRODUCERS * STRESS_UPDATES) {
+        if (LCD_queuePop(&update) != LCD_OK) {
+            sched_yield();
+            continue;
+        }
+        TEST_ASSERT_LESS_THAN(STRESS_PRODUCERS, update.row);
+        TEST_ASSERT_EQUAL(expected[update.row], strtoul(update.text, NULL, 10));
+        expected[update.row]++;
+        received++;
+    }
+    for (uint8_t id = 0; id < STRESS_PRODUCERS; id++) {
+        pthread_join(producers[id], NULL);
+    }
+    TEST_ASSERT_EQUAL(LCD_FAIL, LCD_queuePop(&update));
+}
+
+//! @test Requirement 8: An update that fails on the bus must be counted as failed.
+void test_LCD_queue_drain_counts_failures(void) {
+    LCD_UpdateTypedef clear = {.type = LCD_UPDATE_CLEAR};
+    LCD_queuePost(&clear);
+    LCD_queuePostText("Alarm");
+    LCD_clear_ExpectAndReturn(LCD_FAIL);
+    LCD_printText_ExpectAndReturn("Alarm", LCD_OK);
+    TEST_ASSERT_EQUAL(2, LCD_queueDrain(LCD_QUEUE_SLOTS));
+    TEST_ASSERT_EQUAL(1, LCD_queueGetFailed());
+    TEST_ASSERT_EQUAL(0, LCD_queueGetDropped());
+}
+
+/* === End of documentation ====================================================================
+ */
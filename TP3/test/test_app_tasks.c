@@ -0,0 +1,149 @@
+/************************************************************************************************
+Copyright (c) 2025, Juan Manuel Guariste <juanmaguariste@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** @file test_app_tasks.c
+ ** @brief Unitary tests for the task table of the application.
+ **/
+
+/* === Headers files inclusions ===============================================================
+ */
+#include "unity.h"
+#include "scheduler.h"
+#include "app_tasks.h"
+
+/* === Macros definitions ======================================================================
+ */
+
+//! Length of the simulation, in milliseconds
+#define SIMULATION_MS 2000
+
+/* === Private data type declarations ==========================================================
+ */
+
+/**
+ * @brief Context of a fake task.
+ */
+typedef struct {
+    uint32_t costUs;   //!< Fixed time the task takes, advanced on the fake clock
+    uint32_t unitCost; //!< Cost of one unit of work, 0 for a task with fixed work
+    uint32_t units;    //!< Units of work done while the budget allowed
+} FakeTask_t;
+
+/* === Private variable declarations ===========================================================
+ */
+
+//! Fake time in microseconds
+static uint32_t fakeUs;
+
+/* === Private function declarations ===========================================================
+ */
+
+/* === Public variable definitions =============================================================
+ */
+
+/* === Private variable definitions ============================================================
+ */
+
+/* === Private function implementation =========================================================
+ */
+
+/**
+ * @brief Millisecond tick taken from the fake clock.
+ *
+ * @return uint32_t Fake time in milliseconds.
+ */
+static uint32_t fakeMillis(void) {
+    return fakeUs / 1000;
+}
+
+/**
+ * @brief Microsecond counter taken from the fake clock.
+ *
+ * @return uint32_t Fake time in microseconds.
+ */
+static uint32_t fakeMicros(void) {
+    return fakeUs;
+}
+
+/**
+ * @brief Fake task, it does units of work while the budget allows, as the display and bus
+ * tasks do, and then takes its fixed time.
+ *
+ * @param context Pointer to the FakeTask_t of the task.
+ */
+static void fakeTask(void * context) {
+    FakeTask_t * task = context;
+    while (task->unitCost != 0 && Scheduler_hasBudget(task->unitCost)) {
+        fakeUs += task->unitCost;
+        task->units++;
+    }
+    fakeUs += task->costUs;
+}
+
+/* === Public function implementation ==========================================================
+ */
+
+void setUp(void) {
+    fakeUs = 0;
+    Scheduler_init(fakeMillis, fakeMicros);
+}
+
+//! @test With the task table of main(), the display and the telemetry must drain their queues
+//! while the bus service keeps a backlog and the control loop is never delayed.
+void test_display_updates_with_bus_service(void) {
+    FakeTask_t control = {.costUs = 1000}, display = {.unitCost = DISPLAY_UPDATE_COST_US};
+    FakeTask_t idle = {.costUs = 200}, bus = {.unitCost = BUS_FRAME_COST_US};
+    FakeTask_t telemetry = {.unitCost = TELEMETRY_CHUNK_COST_US};
+    SchedulerStats_t stats;
+
+    int8_t id = Scheduler_addTask(fakeTask, &control, CONTROL_PERIOD_MS, CONTROL_OFFSET_MS,
+                                  CONTROL_BUDGET_US);
+    Scheduler_addTask(fakeTask, &display, DISPLAY_PERIOD_MS, DISPLAY_OFFSET_MS, DISPLAY_BUDGET_US);
+    Scheduler_addTask(fakeTask, &idle, IDLE_PERIOD_MS, IDLE_OFFSET_MS, IDLE_BUDGET_US);
+    Scheduler_addTask(fakeTask, &telemetry, TELEMETRY_PERIOD_MS, TELEMETRY_OFFSET_MS,
+                      TELEMETRY_BUDGET_US);
+    Scheduler_addTask(fakeTask, &bus, BUS_PERIOD_MS, BUS_OFFSET_MS, BUS_BUDGET_US);
+    while (fakeMillis() < SIMULATION_MS) {
+        if (!Scheduler_dispatch()) {
+            fakeUs = (fakeMillis() + 1) * 1000;
+        }
+    }
+
+    TEST_ASSERT_TRUE(Scheduler_getStats(id, &stats));
+    TEST_ASSERT_EQUAL(SIMULATION_MS / CONTROL_PERIOD_MS, stats.runs);
+    TEST_ASSERT_LESS_OR_EQUAL(1, stats.maxLatencyMs);
+    TEST_ASSERT_GREATER_OR_EQUAL(SIMULATION_MS / CONTROL_PERIOD_MS, display.units);
+    TEST_ASSERT_GREATER_THAN(0, telemetry.units);
+    TEST_ASSERT_GREATER_THAN(0, bus.units);
+}
+
+//! @test The budget of the display refresh must leave room for the updates of one run plus the
+//! overhead of the task, not just for the cost of a single update.
+void test_display_budget_fits_updates_per_run(void) {
+    FakeTask_t display = {.unitCost = DISPLAY_UPDATE_COST_US};
+
+    Scheduler_addTask(fakeTask, &display, DISPLAY_PERIOD_MS, DISPLAY_OFFSET_MS, DISPLAY_BUDGET_US);
+    fakeUs = DISPLAY_OFFSET_MS * 1000;
+    TEST_ASSERT_TRUE(Scheduler_dispatch());
+    TEST_ASSERT_EQUAL(DISPLAY_UPDATES_PER_RUN, display.units);
+}
+
+/* === End of documentation ==================================================================== */
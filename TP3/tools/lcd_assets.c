@@ -0,0 +1,457 @@
+/************************************************************************************************
+Copyright (c) 2025, Juan Manuel Guariste <juanmaguariste@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** @file lcd_assets.c
+ ** @brief Host compiler of the precompiled LCD screens and glyph sets
+ **
+ ** Usage: lcd_assets.elf <output> <description.lcd>...
+ **
+ ** Reads the descriptions and writes <output>.h and <output>.c with one LCD_AssetTypedef per
+ ** screen or glyph set, ready to be sent with LCD_blit(). Every message is encoded as the four
+ ** expander bytes the driver would send (both nibbles, with E high and then low) and a spacer
+ ** byte with E low that gives the controller time to execute it, leaving the backlight bit clear
+ ** since it is only known at run time. A description holds these lines:
+ **
+ **   # comment
+ **   glyphs <NAME>              starts a glyph set
+ **   glyph <slot> U+<hex>       a glyph for a code point, followed by LCD_GLYPH_ROWS rows of
+ **                              LCD_GLYPH_COLUMNS dots ('#' on, '.' off), the top row first
+ **   screen <NAME>              starts a screen, blank until text is placed on it
+ **   text <row> <col> "<UTF-8>" places a label, which must fit in the row
+ **
+ ** Text is translated with the character ROM selected by LCD_CHARSET_ROM; characters drawn with
+ ** a glyph must come after the glyph set that defines it.
+ **/
+
+/* === Headers files inclusions =============================================================== */
+
+#include "API_lcd.h"
+#include "API_lcd_charset.h"
+#include <ctype.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* === Macros definitions ====================================================================== */
+
+//! Maximum number of screens and glyph sets of all the descriptions
+#define MAX_ASSETS 64
+
+//! Maximum length of an asset name
+#define MAX_NAME 32
+
+//! Maximum length of a description line
+#define MAX_LINE 256
+
+//! Dots of every glyph row
+#define LCD_GLYPH_COLUMNS 5
+
+//! Messages of the longest asset: a full glyph set or a full screen, and the final cursor
+#define MAX_MESSAGES (LCD_CHARSET_CGRAM_SLOTS * (LCD_GLYPH_ROWS + 1) + 1)
+
+/* === Private data type declarations ========================================================== */
+
+/**
+ * @brief Screen or glyph set read from a description.
+ */
+typedef struct {
+    char name[MAX_NAME];                           //!< Name, the C symbol is LCD_ASSET_<name>
+    bool isScreen;                                 //!< true for a screen, false for a glyph set
+    uint8_t frame[LCD_FRAME_SIZE];                 //!< Character codes of a screen
+    uint32_t glyphs[LCD_CHARSET_CGRAM_SLOTS];      //!< Code point of every slot of a glyph set
+    uint8_t rows[LCD_CHARSET_CGRAM_SLOTS][LCD_GLYPH_ROWS]; //!< Dots of every slot
+} Asset_t;
+
+/**
+ * @brief Position in the description being read, for the error messages.
+ */
+typedef struct {
+    const char * file; //!< Name of the description
+    unsigned line;     //!< Line being read
+} Source_t;
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/**
+ * @brief Reports an error in a description and ends the program.
+ *
+ * @param source Position of the error.
+ *
+ * @param format printf format of the message, followed by its arguments.
+ */
+static void fail(const Source_t * source, const char * format, ...);
+
+/**
+ * @brief Reads a description, adding its assets to the list.
+ *
+ * @param file Name of the description.
+ */
+static void readDescription(const char * file);
+
+/**
+ * @brief Reads the next line that is not blank, skipping the comments if asked.
+ *
+ * @param input Description being read.
+ *
+ * @param source Position in the description, updated.
+ *
+ * @param line Where to store the line, without the end of line.
+ *
+ * @param comments true to skip the lines starting with '#', false inside a glyph where '#' is
+ * a dot.
+ *
+ * @return true if a line was read, false at the end of the description.
+ */
+static bool nextLine(FILE * input, Source_t * source, char * line, bool comments);
+
+/**
+ * @brief Starts a new asset.
+ *
+ * @param source Position of the asset in its description.
+ *
+ * @param name Name of the asset.
+ *
+ * @param isScreen true for a screen, false for a glyph set.
+ *
+ * @return Asset_t * The new asset.
+ */
+static Asset_t * addAsset(const Source_t * source, const char * name, bool isScreen);
+
+/**
+ * @brief Places a UTF-8 label on a screen.
+ *
+ * @param source Position of the label in its description.
+ *
+ * @param asset Screen.
+ *
+ * @param row Row of the first character.
+ *
+ * @param col Column of the first character.
+ *
+ * @param text Label.
+ */
+static void placeText(const Source_t * source, Asset_t * asset, unsigned row, unsigned col,
+                      const char * text);
+
+/**
+ * @brief Encodes a message as the four expander bytes of its two nibbles and a spacer.
+ *
+ * @param stream Where to append the bytes.
+ *
+ * @param data Data of the message.
+ *
+ * @param rs Register select flag (COMMAND = 0 or DATA = 1).
+ *
+ * @return size_t Number of bytes appended.
+ */
+static size_t encodeMessage(uint8_t * stream, uint8_t data, uint8_t rs);
+
+/**
+ * @brief Encodes an asset as the stream sent by LCD_blit().
+ *
+ * @param asset Asset to encode.
+ *
+ * @param stream Where to store the bytes.
+ *
+ * @return size_t Length of the stream.
+ */
+static size_t encodeAsset(const Asset_t * asset, uint8_t * stream);
+
+/**
+ * @brief Writes a table of bytes as a C initializer.
+ *
+ * @param output File being generated.
+ *
+ * @param bytes Bytes of the table.
+ *
+ * @param length Number of bytes.
+ */
+static void writeBytes(FILE * output, const uint8_t * bytes, size_t length);
+
+/**
+ * @brief Writes the generated header and source.
+ *
+ * @param base Name of the outputs, without extension.
+ */
+static void writeOutputs(const char * base);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+//! Assets of all the descriptions, in the order they were read
+static Asset_t assets[MAX_ASSETS];
+
+//! Number of assets read
+static unsigned assetCount;
+
+/* === Private function implementation ========================================================= */
+
+void fail(const Source_t * source, const char * format, ...) {
+    va_list arguments;
+    fprintf(stderr, "%s:%u: ", source->file, source->line);
+    va_start(arguments, format);
+    vfprintf(stderr, format, arguments);
+    va_end(arguments);
+    fputc('\n', stderr);
+    exit(EXIT_FAILURE);
+}
+
+bool nextLine(FILE * input, Source_t * source, char * line, bool comments) {
+    while (fgets(line, MAX_LINE, input) != NULL) {
+        source->line++;
+        line[strcspn(line, "\r\n")] = '\0';
+        const char * start = line;
+        while (isspace((unsigned char)*start)) {
+            start++;
+        }
+        if (*start != '\0' && !(comments && *start == '#')) {
+            return true;
+        }
+    }
+    return false;
+}
+
+Asset_t * addAsset(const Source_t * source, const char * name, bool isScreen) {
+    if (assetCount == MAX_ASSETS) {
+        fail(source, "more than %d assets", MAX_ASSETS);
+    }
+    if (strlen(name) >= MAX_NAME) {
+        fail(source, "name longer than %d characters", MAX_NAME - 1);
+    }
+    for (const char * next = name; *next != '\0'; next++) {
+        if (!isupper((unsigned char)*next) && !isdigit((unsigned char)*next) && *next != '_') {
+            fail(source, "name '%s' must be upper case letters, digits and '_'", name);
+        }
+    }
+    for (unsigned index = 0; index < assetCount; index++) {
+        if (strcmp(assets[index].name, name) == 0) {
+            fail(source, "asset '%s' defined twice", name);
+        }
+    }
+    Asset_t * asset = &assets[assetCount++];
+    strcpy(asset->name, name);
+    asset->isScreen = isScreen;
+    memset(asset->frame, BLANK_CHAR, sizeof(asset->frame));
+    return asset;
+}
+
+void placeText(const Source_t * source, Asset_t * asset, unsigned row, unsigned col,
+               const char * text) {
+    LCD_Utf8DecoderTypedef decoder;
+    uint8_t code;
+    LCD_charsetDecoderInit(&decoder);
+    if (row >= LCD_CANTIDAD_FILAS) {
+        fail(source, "row %u is off screen", row);
+    }
+    for (; *text != '\0'; text++) {
+        if (!LCD_charsetDecode(&decoder, (uint8_t)*text, &code)) {
+            continue;
+        }
+        if (col >= LCD_MAX_COLUMNS) {
+            fail(source, "text does not fit in the row");
+        }
+        asset->frame[row * LCD_MAX_COLUMNS + col++] = code;
+    }
+}
+
+void readDescription(const char * file) {
+    Source_t source = {.file = file, .line = 0};
+    char line[MAX_LINE];
+    char name[MAX_LINE];
+    Asset_t * asset = NULL;
+    FILE * input = fopen(file, "r");
+    if (input == NULL) {
+        fail(&source, "cannot be read");
+    }
+    while (nextLine(input, &source, line, true)) {
+        unsigned row;
+        unsigned col;
+        unsigned slot;
+        unsigned codePoint;
+        int used = 0;
+        if (sscanf(line, " glyphs %s", name) == 1) {
+            asset = addAsset(&source, name, false);
+        } else if (sscanf(line, " screen %s", name) == 1) {
+            asset = addAsset(&source, name, true);
+        } else if (sscanf(line, " glyph %u U+%x", &slot, &codePoint) == 2) {
+            if (asset == NULL || asset->isScreen) {
+                fail(&source, "glyph outside of a glyph set");
+            }
+            if (slot >= LCD_CHARSET_CGRAM_SLOTS || codePoint == LCD_CHARSET_NO_GLYPH) {
+                fail(&source, "invalid slot or code point");
+            }
+            asset->glyphs[slot] = codePoint;
+            for (uint8_t dotRow = 0; dotRow < LCD_GLYPH_ROWS; dotRow++) {
+                if (!nextLine(input, &source, line, false) || sscanf(line, " %s", name) != 1 ||
+                    strlen(name) != LCD_GLYPH_COLUMNS || strspn(name, "#.") != LCD_GLYPH_COLUMNS) {
+                    fail(&source, "expected a row of %d dots", LCD_GLYPH_COLUMNS);
+                }
+                for (uint8_t dot = 0; dot < LCD_GLYPH_COLUMNS; dot++) {
+                    asset->rows[slot][dotRow] = (uint8_t)(asset->rows[slot][dotRow] << 1) |
+                                                (name[dot] == '#');
+                }
+            }
+            LCD_charsetBindGlyph((uint8_t)slot, codePoint);
+        } else if (sscanf(line, " text %u %u \"%n", &row, &col, &used) == 2 && used > 0) {
+            char * text = &line[used];
+            char * end = strrchr(text, '"');
+            if (asset == NULL || !asset->isScreen) {
+                fail(&source, "text outside of a screen");
+            }
+            if (end == NULL) {
+                fail(&source, "unterminated text");
+            }
+            *end = '\0';
+            placeText(&source, asset, row, col, text);
+        } else {
+            fail(&source, "cannot understand '%s'", line);
+        }
+    }
+    fclose(input);
+}
+
+size_t encodeMessage(uint8_t * stream, uint8_t data, uint8_t rs) {
+    uint8_t high = (data & HIGH_NIBBLE_MASK) | rs;
+    uint8_t low = (uint8_t)((data & LOW_NIBBLE_MASK) << TO_HIGH_NIBBLE_SHIFT) | rs;
+    stream[0] = high | ENABLE;
+    stream[1] = high;
+    stream[2] = low | ENABLE;
+    stream[3] = low;
+    stream[4] = low;
+    return LCD_ASSET_BYTES_PER_MSG;
+}
+
+size_t encodeAsset(const Asset_t * asset, uint8_t * stream) {
+    static const uint8_t rowAddress[LCD_CANTIDAD_FILAS] = {LCD_ROW_1_ADDRESS, LCD_ROW_2_ADDRESS};
+    size_t length = 0;
+    if (asset->isScreen) {
+        for (uint8_t row = 0; row < LCD_CANTIDAD_FILAS; row++) {
+            length += encodeMessage(&stream[length], rowAddress[row] | SET_DDRAM_ADDRESS, COMMAND);
+            for (uint8_t col = 0; col < LCD_MAX_COLUMNS; col++) {
+                length += encodeMessage(&stream[length], asset->frame[row * LCD_MAX_COLUMNS + col],
+                                        DATA);
+            }
+        }
+    } else {
+        /* The CGRAM address auto-increments, consecutive slots share the address command */
+        int previous = -2;
+        for (uint8_t slot = 0; slot < LCD_CHARSET_CGRAM_SLOTS; slot++) {
+            if (asset->glyphs[slot] == LCD_CHARSET_NO_GLYPH) {
+                continue;
+            }
+            if (slot != previous + 1) {
+                length += encodeMessage(&stream[length],
+                                        SET_CGRAM_ADDRESS | (slot * LCD_GLYPH_ROWS), COMMAND);
+            }
+            for (uint8_t row = 0; row < LCD_GLYPH_ROWS; row++) {
+                length += encodeMessage(&stream[length], asset->rows[slot][row], DATA);
+            }
+            previous = slot;
+        }
+    }
+    /* LCD_blit() expects every stream to leave the cursor on the first cell of DDRAM */
+    length += encodeMessage(&stream[length], LCD_ROW_1_ADDRESS | SET_DDRAM_ADDRESS, COMMAND);
+    return length;
+}
+
+void writeBytes(FILE * output, const uint8_t * bytes, size_t length) {
+    for (size_t index = 0; index < length; index++) {
+        fprintf(output, "%s0x%02x,", (index % 12 == 0) ? "\n    " : " ", bytes[index]);
+    }
+    fprintf(output, "\n");
+}
+
+void writeOutputs(const char * base) {
+    char path[FILENAME_MAX];
+    const char * name = strrchr(base, '/') != NULL ? strrchr(base, '/') + 1 : base;
+    uint8_t stream[MAX_MESSAGES * LCD_ASSET_BYTES_PER_MSG];
+    Source_t position = {.file = path, .line = 0};
+
+    snprintf(path, sizeof(path), "%s.h", base);
+    FILE * header = fopen(path, "w");
+    if (header == NULL) {
+        fail(&position, "cannot be written");
+    }
+    fprintf(header, "/* Generated by lcd_assets.elf, do not edit */\n\n");
+    fprintf(header, "#ifndef LCD_ASSETS_H_\n#define LCD_ASSETS_H_\n\n#include \"API_lcd.h\"\n\n");
+    for (unsigned index = 0; index < assetCount; index++) {
+        fprintf(header, "extern const LCD_AssetTypedef LCD_ASSET_%s;\n", assets[index].name);
+    }
+    fprintf(header, "\n#endif /* LCD_ASSETS_H_ */\n");
+    fclose(header);
+
+    snprintf(path, sizeof(path), "%s.c", base);
+    FILE * table = fopen(path, "w");
+    if (table == NULL) {
+        fail(&position, "cannot be written");
+    }
+    fprintf(table, "/* Generated by lcd_assets.elf, do not edit */\n\n#include \"%s.h\"\n", name);
+    for (unsigned index = 0; index < assetCount; index++) {
+        const Asset_t * asset = &assets[index];
+        size_t length = encodeAsset(asset, stream);
+        fprintf(table, "\nstatic const uint8_t %s_STREAM[] = {", asset->name);
+        writeBytes(table, stream, length);
+        fprintf(table, "};\n");
+        if (asset->isScreen) {
+            fprintf(table, "\nstatic const uint8_t %s_FRAME[LCD_FRAME_SIZE] = {", asset->name);
+            writeBytes(table, asset->frame, LCD_FRAME_SIZE);
+            fprintf(table, "};\n");
+        } else {
+            fprintf(table, "\nstatic const uint32_t %s_GLYPHS[LCD_CHARSET_CGRAM_SLOTS] = {\n   ",
+                    asset->name);
+            for (uint8_t slot = 0; slot < LCD_CHARSET_CGRAM_SLOTS; slot++) {
+                fprintf(table, " 0x%04x,", (unsigned)asset->glyphs[slot]);
+            }
+            fprintf(table, "\n};\n");
+        }
+        fprintf(table, "\nconst LCD_AssetTypedef LCD_ASSET_%s = {\n", asset->name);
+        fprintf(table, "    .stream = %s_STREAM,\n    .length = sizeof(%s_STREAM),\n",
+                asset->name, asset->name);
+        if (asset->isScreen) {
+            fprintf(table, "    .frame = %s_FRAME,\n", asset->name);
+        } else {
+            fprintf(table, "    .glyphs = %s_GLYPHS,\n", asset->name);
+        }
+        fprintf(table, "};\n");
+    }
+    fclose(table);
+}
+
+/* === Public function implementation ========================================================== */
+
+int main(int argc, char * argv[]) {
+    if (argc < 3) {
+        fprintf(stderr, "usage: %s <output> <description.lcd>...\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    LCD_charsetInit(LCD_CHARSET_ROM);
+    for (int index = 2; index < argc; index++) {
+        readDescription(argv[index]);
+    }
+    writeOutputs(argv[1]);
+    return EXIT_SUCCESS;
+}
+
+/* === End of documentation ==================================================================== */
@@ -0,0 +1,172 @@
+/************************************************************************************************
+Copyright (c) 2025, Juan Manuel Guariste <juanmaguariste@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef PROFILE_H
+#define PROFILE_H
+
+/** @file profile.h
+ ** @brief Optional profiling probes with per-probe timing statistics
+ **
+ ** A probe measures the time from the line where it is placed to the end of the enclosing block,
+ ** whatever return path is taken. With PROFILE_ENABLED set to 0, the default, the probe macros
+ ** expand to nothing and the drivers carry no profiling code.
+ **/
+
+/* === Headers files inclusions ================================================================ */
+#include <stdint.h>
+#include <stdbool.h>
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+
+#ifndef PROFILE_ENABLED
+//! Compiles the probes in when set to 1
+#define PROFILE_ENABLED 0
+#endif
+
+//! Helper to build a unique identifier for every probe
+#define PROFILE_CONCAT_(first, second) first##second
+//! Helper to expand the line number before concatenating it
+#define PROFILE_CONCAT(first, second) PROFILE_CONCAT_(first, second)
+
+#if PROFILE_ENABLED
+
+//! Measures from this line to the end of the enclosing block, under a constant label
+#define PROFILE_SCOPE(name)                                                                       \
+    static ProfileProbe_t PROFILE_CONCAT(profileProbe, __LINE__) = {.label = (name)};             \
+    ProfileScope_t PROFILE_CONCAT(profileScope, __LINE__)                                         \
+        __attribute__((cleanup(Profile_leave))) = {&PROFILE_CONCAT(profileProbe, __LINE__),       \
+                                                   Profile_now()}
+
+#else
+
+//! Measures from this line to the end of the enclosing block, under a constant label
+#define PROFILE_SCOPE(name)
+
+#endif
+
+//! Measures the whole function, labeled with its name; must be the first line of the function
+#define PROFILE_FUNCTION() PROFILE_SCOPE(__func__)
+
+/* === Public data type declarations =========================================================== */
+
+/**
+ * @brief Function that returns a free-running time counter.
+ */
+typedef uint32_t (*ProfileClock_t)(void);
+
+/**
+ * @brief Function that writes one line of a dump.
+ */
+typedef void (*ProfileWrite_t)(const char * line);
+
+/**
+ * @brief Statistics of a probe, kept in a static variable at the place of the probe.
+ */
+typedef struct ProfileProbe_s {
+    const char * label;            //!< Name of the probe
+    uint32_t count;                //!< Number of measurements
+    uint32_t min;                  //!< Shortest measurement
+    uint32_t max;                  //!< Longest measurement
+    uint64_t total;                //!< Sum of all the measurements
+    bool listed;                   //!< The probe is in the list of probes
+    struct ProfileProbe_s * next;  //!< Next probe in the list of probes that have measured
+} ProfileProbe_t;
+
+/**
+ * @brief Measurement in progress, closed by Profile_leave() when it goes out of scope.
+ */
+typedef struct {
+    ProfileProbe_t * probe; //!< Probe that receives the measurement
+    uint32_t start;         //!< Counter value at the start of the measurement
+} ProfileScope_t;
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+
+/**
+ * @brief Selects the time counter and clears the statistics of every probe.
+ *
+ * On Cortex-M3/M4 the default counter is the DWT cycle counter, which is enabled here; on the
+ * host it is the monotonic clock in nanoseconds.
+ *
+ * @param clock Time counter to use, NULL for the default one.
+ *
+ * @return void
+ */
+void Profile_init(ProfileClock_t clock);
+
+/**
+ * @brief Reads the time counter.
+ *
+ * @return uint32_t Cycles on target, nanoseconds on the host.
+ */
+uint32_t Profile_now(void);
+
+/**
+ * @brief Closes a measurement and adds it to the statistics of its probe.
+ *
+ * Called by the cleanup of PROFILE_SCOPE(), not meant to be called directly.
+ *
+ * @param scope Measurement to close.
+ *
+ * @return void
+ */
+void Profile_leave(ProfileScope_t * scope);
+
+/**
+ * @brief Clears the statistics of every probe, the probes stay listed.
+ *
+ * @return void
+ */
+void Profile_reset(void);
+
+/**
+ * @brief Looks up a probe by label.
+ *
+ * @param label Label of the probe.
+ *
+ * @return const ProfileProbe_t* Statistics of the probe, NULL if it has not measured yet.
+ */
+const ProfileProbe_t * Profile_find(const char * label);
+
+/**
+ * @brief Writes a table with the count, min, max and mean of every probe, one line at a time.
+ *
+ * @param write Function that writes every line of the table.
+ *
+ * @return void
+ */
+void Profile_dump(ProfileWrite_t write);
+
+/* === End of documentation ==================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PROFILE_H */
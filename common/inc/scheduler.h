@@ -0,0 +1,153 @@
+/************************************************************************************************
+Copyright (c) 2025, Juan Manuel Guariste <juanmaguariste@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+/** @file scheduler.h
+ ** @brief Cooperative scheduler with periodic tasks, time budgets and run statistics
+ **/
+
+/* === Headers files inclusions ================================================================ */
+#include <stdint.h>
+#include <stdbool.h>
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+
+#ifndef SCHEDULER_MAX_TASKS
+//! Size of the task table
+#define SCHEDULER_MAX_TASKS 8
+#endif
+
+//! Task number returned when a task cannot be added
+#define SCHEDULER_NO_TASK (-1)
+
+/* === Public data type declarations =========================================================== */
+
+/**
+ * @brief Function of a task, it must do a bounded amount of work and return.
+ *
+ * @param context Pointer given when the task was added.
+ */
+typedef void (*SchedulerTask_t)(void * context);
+
+/**
+ * @brief Function that returns a free-running time counter.
+ */
+typedef uint32_t (*SchedulerClock_t)(void);
+
+/**
+ * @brief Run statistics of a task.
+ */
+typedef struct {
+    uint32_t runs;         //!< Number of times the task ran
+    uint32_t overruns;     //!< Runs that took longer than the budget
+    uint32_t missed;       //!< Releases skipped because the task started more than a period late
+    uint32_t lastUs;       //!< Duration of the last run, in microseconds
+    uint32_t maxUs;        //!< Longest run, in microseconds
+    uint64_t totalUs;      //!< Sum of the durations of every run, in microseconds
+    uint32_t maxLatencyMs; //!< Longest delay between a release and the start of the run
+} SchedulerStats_t;
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+
+/**
+ * @brief Initializes the scheduler with an empty task table.
+ *
+ * @param millis Millisecond tick source, it releases the tasks.
+ *
+ * @param micros Microsecond counter used to measure the runs, NULL to measure with the
+ * millisecond tick.
+ *
+ * @return void
+ */
+void Scheduler_init(SchedulerClock_t millis, SchedulerClock_t micros);
+
+/**
+ * @brief Adds a periodic task to the table.
+ *
+ * Tasks are prioritized in the order they are added: when several tasks are due, the one
+ * added first runs first.
+ *
+ * @param task Function of the task.
+ *
+ * @param context Pointer passed to the function on every run.
+ *
+ * @param periodMs Time between releases, at least 1 ms.
+ *
+ * @param offsetMs Delay of the first release from now, to spread tasks with the same period.
+ *
+ * @param budgetUs Maximum time a run is expected to take, in microseconds.
+ *
+ * @return int8_t Task number, SCHEDULER_NO_TASK if the table is full or the period is 0.
+ */
+int8_t Scheduler_addTask(SchedulerTask_t task, void * context, uint32_t periodMs,
+                         uint32_t offsetMs, uint32_t budgetUs);
+
+/**
+ * @brief Runs the highest priority task that is due, if any.
+ *
+ * Must be called from the main loop. Only one task runs per call, so a higher priority task
+ * released meanwhile waits at most for one run of a lower priority task.
+ *
+ * @return true if a task ran, false if no task was due.
+ */
+bool Scheduler_dispatch(void);
+
+/**
+ * @brief Checks if the running task can still do some work without missing a deadline.
+ *
+ * Tasks with a variable amount of work call it before each unit of work. It returns false when
+ * the work would exceed the budget of the task, or would still be running when a higher
+ * priority task is released.
+ *
+ * @param costUs Worst-case duration of the work, in microseconds.
+ *
+ * @return true if the work fits, false otherwise.
+ */
+bool Scheduler_hasBudget(uint32_t costUs);
+
+/**
+ * @brief Copies the run statistics of a task.
+ *
+ * @param task Task number returned by Scheduler_addTask().
+ *
+ * @param copy Where to copy the statistics.
+ *
+ * @return true if the task exists, false otherwise.
+ */
+bool Scheduler_getStats(int8_t task, SchedulerStats_t * copy);
+
+/* === End of documentation ==================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SCHEDULER_H */
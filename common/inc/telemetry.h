@@ -0,0 +1,229 @@
+/************************************************************************************************
+Copyright (c) 2025, Juan Manuel Guariste <juanmaguariste@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+/** @file telemetry.h
+ ** @brief Delta frames of the front panel state, for a host viewer
+ **
+ ** The drivers report every LED port and LCD cell they write. Only values that differ from the
+ ** mirror kept here become frames, which are queued in a lock-free ring and read out by the
+ ** context that owns the UART or the semihosting channel. Every frame has TELEMETRY_FRAME_SIZE
+ ** bytes: TELEMETRY_SYNC, the type, three payload bytes and the XOR of the type and payload.
+ **
+ ** | Type             | Payload                           |
+ ** |------------------|-----------------------------------|
+ ** | TELEMETRY_LEDS   | port, low byte, high byte         |
+ ** | TELEMETRY_CELL   | row, column, character            |
+ ** | TELEMETRY_CLEAR  | unused                            |
+ **/
+
+/* === Headers files inclusions ================================================================ */
+#include <stdint.h>
+#include <stdbool.h>
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+
+#ifndef TELEMETRY_ENABLED
+//! Compiles the driver hooks in when set to 1
+#define TELEMETRY_ENABLED 0
+#endif
+
+#ifndef TELEMETRY_SLOTS
+//! Frames the ring can hold, must be a power of two
+#define TELEMETRY_SLOTS 64
+#endif
+
+#ifndef TELEMETRY_LED_PORTS
+//! LED ports mirrored, from the first port of the default group
+#define TELEMETRY_LED_PORTS 4
+#endif
+
+#ifndef TELEMETRY_LCD_ROWS
+//! Rows of the mirrored display
+#define TELEMETRY_LCD_ROWS 2
+#endif
+
+#ifndef TELEMETRY_LCD_COLUMNS
+//! Columns of the mirrored display
+#define TELEMETRY_LCD_COLUMNS 16
+#endif
+
+//! Size of every frame, in bytes
+#define TELEMETRY_FRAME_SIZE 6
+
+//! First byte of every frame
+#define TELEMETRY_SYNC 0xA5
+
+//! Frame type of a LED port
+#define TELEMETRY_LEDS 'L'
+
+//! Frame type of a LCD cell
+#define TELEMETRY_CELL 'C'
+
+//! Frame type of a cleared LCD
+#define TELEMETRY_CLEAR 'X'
+
+#if TELEMETRY_ENABLED
+
+//! Reports the value written to a LED port
+#define TELEMETRY_LED_PORT(port, value) Telemetry_ledPort((port), (value))
+
+//! Reports the character written to a LCD cell
+#define TELEMETRY_LCD_CELL(row, column, character) Telemetry_lcdCell((row), (column), (character))
+
+//! Reports that the LCD was cleared
+#define TELEMETRY_LCD_CLEAR() Telemetry_lcdClear()
+
+#else
+
+//! Reports the value written to a LED port
+#define TELEMETRY_LED_PORT(port, value)
+
+//! Reports the character written to a LCD cell
+#define TELEMETRY_LCD_CELL(row, column, character)
+
+//! Reports that the LCD was cleared
+#define TELEMETRY_LCD_CLEAR()
+
+#endif
+
+/* === Public data type declarations =========================================================== */
+
+/**
+ * @brief Panel rebuilt from the frames by the host decoder.
+ */
+typedef struct {
+    uint16_t leds[TELEMETRY_LED_PORTS];                        //!< Value of every LED port
+    char cells[TELEMETRY_LCD_ROWS][TELEMETRY_LCD_COLUMNS];     //!< Character of every LCD cell
+    uint8_t frame[TELEMETRY_FRAME_SIZE];                       //!< Frame being received
+    uint8_t received;                                          //!< Bytes of the frame received
+    uint32_t frames;                                           //!< Valid frames decoded
+    uint32_t errors;                                           //!< Frames discarded
+} TelemetryPanel_t;
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+
+/**
+ * @brief Empties the ring and sets the mirror to dark LEDs and a blank display.
+ *
+ * Must be called before the drivers report anything.
+ *
+ * @return void
+ */
+void Telemetry_init(void);
+
+/**
+ * @brief Reports the value written to a LED port, queues a frame if it changed.
+ *
+ * Lock-free and safe from any context; when the ring is full the frame is dropped and the
+ * whole panel is sent again by Telemetry_read(). The frame is filled from the mirror once its
+ * slot is claimed, so when several contexts report the same port the last frame queued carries
+ * the last value reported.
+ *
+ * @param port Index of the port, ports beyond TELEMETRY_LED_PORTS are ignored.
+ *
+ * @param value Value written to the port.
+ *
+ * @return void
+ */
+void Telemetry_ledPort(uint8_t port, uint16_t value);
+
+/**
+ * @brief Reports the character written to a LCD cell, queues a frame if it changed.
+ *
+ * @param row Row of the cell.
+ *
+ * @param column Column of the cell.
+ *
+ * @param character Character written.
+ *
+ * @return void
+ */
+void Telemetry_lcdCell(uint8_t row, uint8_t column, char character);
+
+/**
+ * @brief Reports that the LCD was cleared, queues a single frame for the whole display.
+ *
+ * @return void
+ */
+void Telemetry_lcdClear(void);
+
+/**
+ * @brief Takes whole frames out of the ring, must only be called from a single context.
+ *
+ * After frames were dropped, the LED ports and LCD cells of the mirror are appended once the
+ * ring is empty, a few per call, until the host has the whole panel again.
+ *
+ * @param buffer Where to copy the frames.
+ *
+ * @param size Size of the buffer, only whole frames are copied.
+ *
+ * @return uint16_t Number of bytes copied.
+ */
+uint16_t Telemetry_read(uint8_t * buffer, uint16_t size);
+
+/**
+ * @brief Returns the number of frames dropped because the ring was full.
+ *
+ * @return uint32_t Dropped frames since Telemetry_init().
+ */
+uint32_t Telemetry_getDropped(void);
+
+/**
+ * @brief Sets a decoded panel to dark LEDs and a blank display.
+ *
+ * @param panel Panel to initialize.
+ *
+ * @return void
+ */
+void TelemetryPanel_init(TelemetryPanel_t * panel);
+
+/**
+ * @brief Feeds one received byte to the decoder.
+ *
+ * Bytes are discarded until a TELEMETRY_SYNC, and a frame with a wrong check byte or an
+ * unknown type is discarded, so the decoder recovers from a stream joined in the middle.
+ *
+ * @param panel Panel being rebuilt.
+ *
+ * @param byte Received byte.
+ *
+ * @return true if the byte completed a valid frame.
+ */
+bool TelemetryPanel_decode(TelemetryPanel_t * panel, uint8_t byte);
+
+/* === End of documentation ==================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TELEMETRY_H */
@@ -0,0 +1,182 @@
+/************************************************************************************************
+Copyright (c) 2025, Juan Manuel Guariste <juanmaguariste@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** @file profile.c
+ ** @brief Definition of the profiling probes
+ **/
+
+/* === Headers files inclusions =============================================================== */
+
+#if !(defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__)) && !defined(_POSIX_C_SOURCE)
+//! brief Makes clock_gettime() visible on the host with a strict C standard
+#define _POSIX_C_SOURCE 199309L
+#endif
+
+#include "profile.h"
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+#if !(defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__))
+#include <time.h>
+#endif
+
+/* === Macros definitions ====================================================================== */
+
+#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__)
+//! brief Debug exception and monitor control register
+#define DEMCR (*(volatile uint32_t *)0xE000EDFCU)
+//! brief Trace enable bit of DEMCR
+#define DEMCR_TRCENA (1UL << 24)
+//! brief DWT control register
+#define DWT_CTRL (*(volatile uint32_t *)0xE0001000U)
+//! brief Cycle counter enable bit of DWT_CTRL
+#define DWT_CTRL_CYCCNTENA (1UL << 0)
+//! brief DWT cycle counter
+#define DWT_CYCCNT (*(volatile uint32_t *)0xE0001004U)
+//! brief Unit of the default counter
+#define PROFILE_UNIT "cycles"
+#else
+//! brief Nanoseconds in a second
+#define NS_PER_S 1000000000UL
+//! brief Unit of the default counter
+#define PROFILE_UNIT "ns"
+#endif
+
+//! brief Size of a line of the dump
+#define LINE_SIZE 96
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+//! @brief Private list of the probes that have measured at least once
+static ProfileProbe_t * probes;
+
+//! @brief Private time counter selected by Profile_init(), NULL for the default one
+static ProfileClock_t profileClock;
+
+/* === Private function declarations =========================================================== */
+
+/**
+ * @brief Private function to read the default time counter of the platform.
+ *
+ * @return uint32_t Cycles on target, nanoseconds on the host.
+ */
+static uint32_t defaultClock(void);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__)
+
+uint32_t defaultClock(void) {
+    return DWT_CYCCNT;
+}
+
+#else
+
+uint32_t defaultClock(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32_t)((uint64_t)now.tv_sec * NS_PER_S + (uint64_t)now.tv_nsec);
+}
+
+#endif
+
+/* === Public function implementation ========================================================== */
+
+void Profile_init(ProfileClock_t clock) {
+    profileClock = clock;
+#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__)
+    if (clock == NULL) {
+        DEMCR |= DEMCR_TRCENA;
+        DWT_CTRL |= DWT_CTRL_CYCCNTENA;
+    }
+#endif
+    Profile_reset();
+}
+
+uint32_t Profile_now(void) {
+    return (profileClock != NULL) ? profileClock() : defaultClock();
+}
+
+void Profile_leave(ProfileScope_t * scope) {
+    uint32_t elapsed = Profile_now() - scope->start;
+    ProfileProbe_t * probe = scope->probe;
+
+    if (probe->count == 0) {
+        if (!probe->listed) {
+            probe->next = probes;
+            probes = probe;
+            probe->listed = true;
+        }
+        probe->min = elapsed;
+        probe->max = elapsed;
+    } else if (elapsed < probe->min) {
+        probe->min = elapsed;
+    } else if (elapsed > probe->max) {
+        probe->max = elapsed;
+    }
+    probe->count++;
+    probe->total += elapsed;
+}
+
+void Profile_reset(void) {
+    for (ProfileProbe_t * probe = probes; probe != NULL; probe = probe->next) {
+        probe->count = 0;
+        probe->min = 0;
+        probe->max = 0;
+        probe->total = 0;
+    }
+}
+
+const ProfileProbe_t * Profile_find(const char * label) {
+    for (ProfileProbe_t * probe = probes; probe != NULL; probe = probe->next) {
+        if (strcmp(probe->label, label) == 0) {
+            return probe;
+        }
+    }
+    return NULL;
+}
+
+void Profile_dump(ProfileWrite_t write) {
+    char line[LINE_SIZE];
+    const char * unit = (profileClock != NULL) ? "ticks" : PROFILE_UNIT;
+
+    snprintf(line, sizeof(line), "%-32s %10s %10s %10s %10s  (%s)", "probe", "count", "min",
+             "max", "mean", unit);
+    write(line);
+    for (ProfileProbe_t * probe = probes; probe != NULL; probe = probe->next) {
+        if (probe->count == 0) {
+            continue;
+        }
+        snprintf(line, sizeof(line), "%-32.32s %10lu %10lu %10lu %10lu", probe->label,
+                 (unsigned long)probe->count, (unsigned long)probe->min,
+                 (unsigned long)probe->max, (unsigned long)(probe->total / probe->count));
+        write(line);
+    }
+}
+
+/* === End of documentation ==================================================================== */
@@ -0,0 +1,206 @@
+/************************************************************************************************
+Copyright (c) 2025, Juan Manuel Guariste <juanmaguariste@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** @file scheduler.c
+ ** @brief Definition of the cooperative scheduler
+ **/
+
+/* === Headers files inclusions =============================================================== */
+
+#include "scheduler.h"
+#include <stddef.h>
+#include <string.h>
+
+/* === Macros definitions ====================================================================== */
+
+//! brief Microseconds in a millisecond
+#define US_PER_MS 1000
+
+/* === Private data type declarations ========================================================== */
+
+/**
+ * @brief Private entry of the task table.
+ */
+typedef struct {
+    SchedulerTask_t task;   //!< Function of the task
+    void * context;         //!< Pointer passed to the function
+    uint32_t periodMs;      //!< Time between releases
+    uint32_t budgetUs;      //!< Maximum expected duration of a run
+    uint32_t releaseMs;     //!< Time of the next release
+    SchedulerStats_t stats; //!< Run statistics
+} SchedulerEntry_t;
+
+/* === Private variable declarations =========================================================== */
+
+//! @brief Private task table, in priority order
+static SchedulerEntry_t tasks[SCHEDULER_MAX_TASKS];
+
+//! @brief Private number of tasks in the table
+static uint8_t taskCount;
+
+//! @brief Private millisecond tick source
+static SchedulerClock_t millisClock;
+
+//! @brief Private microsecond counter, NULL if runs are measured with the tick
+static SchedulerClock_t microsClock;
+
+//! @brief Private index of the task that is running, -1 when no task is running
+static int8_t running = SCHEDULER_NO_TASK;
+
+//! @brief Private start time of the running task, in microseconds
+static uint32_t runStartUs;
+
+/* === Private function declarations =========================================================== */
+
+/**
+ * @brief Private function to check that a time has been reached, with wrap-around.
+ *
+ * @param now Current time.
+ *
+ * @param time Time to check.
+ *
+ * @return true if now is at or after time.
+ */
+static bool timeReached(uint32_t now, uint32_t time);
+
+/**
+ * @brief Private function to read the microsecond counter.
+ *
+ * @return uint32_t Current time in microseconds.
+ */
+static uint32_t readMicros(void);
+
+/**
+ * @brief Private function to run a task and update its statistics.
+ *
+ * @param index Index of the task in the table.
+ *
+ * @param now Current time in milliseconds.
+ *
+ * @return void
+ */
+static void runTask(uint8_t index, uint32_t now);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+bool timeReached(uint32_t now, uint32_t time) {
+    return (int32_t)(now - time) >= 0;
+}
+
+uint32_t readMicros(void) {
+    return (microsClock != NULL) ? microsClock() : millisClock() * US_PER_MS;
+}
+
+void runTask(uint8_t index, uint32_t now) {
+    SchedulerEntry_t * entry = &tasks[index];
+    uint32_t latency = now - entry->releaseMs;
+    uint32_t skipped = latency / entry->periodMs;
+
+    entry->stats.missed += skipped;
+    entry->releaseMs += (skipped + 1) * entry->periodMs;
+    if (latency > entry->stats.maxLatencyMs) {
+        entry->stats.maxLatencyMs = latency;
+    }
+
+    running = index;
+    runStartUs = readMicros();
+    entry->task(entry->context);
+    uint32_t elapsed = readMicros() - runStartUs;
+    running = SCHEDULER_NO_TASK;
+
+    entry->stats.runs++;
+    entry->stats.lastUs = elapsed;
+    entry->stats.totalUs += elapsed;
+    if (elapsed > entry->stats.maxUs) {
+        entry->stats.maxUs = elapsed;
+    }
+    if (elapsed > entry->budgetUs) {
+        entry->stats.overruns++;
+    }
+}
+
+/* === Public function implementation ========================================================== */
+
+void Scheduler_init(SchedulerClock_t millis, SchedulerClock_t micros) {
+    memset(tasks, 0, sizeof(tasks));
+    taskCount = 0;
+    millisClock = millis;
+    microsClock = micros;
+    running = SCHEDULER_NO_TASK;
+}
+
+int8_t Scheduler_addTask(SchedulerTask_t task, void * context, uint32_t periodMs,
+                         uint32_t offsetMs, uint32_t budgetUs) {
+    if (task == NULL || periodMs == 0 || taskCount >= SCHEDULER_MAX_TASKS) {
+        return SCHEDULER_NO_TASK;
+    }
+    SchedulerEntry_t * entry = &tasks[taskCount];
+    entry->task = task;
+    entry->context = context;
+    entry->periodMs = periodMs;
+    entry->budgetUs = budgetUs;
+    entry->releaseMs = millisClock() + offsetMs;
+    memset(&entry->stats, 0, sizeof(entry->stats));
+    return (int8_t)taskCount++;
+}
+
+bool Scheduler_dispatch(void) {
+    uint32_t now = millisClock();
+    for (uint8_t index = 0; index < taskCount; index++) {
+        if (timeReached(now, tasks[index].releaseMs)) {
+            runTask(index, now);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool Scheduler_hasBudget(uint32_t costUs) {
+    if (running == SCHEDULER_NO_TASK) {
+        return true;
+    }
+    if (readMicros() - runStartUs + costUs > tasks[running].budgetUs) {
+        return false;
+    }
+    uint32_t now = millisClock();
+    for (int8_t index = 0; index < running; index++) {
+        /* The position inside the current millisecond is unknown, so count one less */
+        int32_t slackMs = (int32_t)(tasks[index].releaseMs - now) - 1;
+        if (slackMs < 0 || (uint32_t)slackMs * US_PER_MS < costUs) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool Scheduler_getStats(int8_t task, SchedulerStats_t * copy) {
+    if (task < 0 || task >= taskCount || copy == NULL) {
+        return false;
+    }
+    *copy = tasks[task].stats;
+    return true;
+}
+
+/* === End of documentation ==================================================================== */
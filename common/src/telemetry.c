@@ -0,0 +1,314 @@
+/************************************************************************************************
+Copyright (c) 2025, Juan Manuel Guariste <juanmaguariste@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** @file telemetry.c
+ ** @brief Definition of the front panel telemetry
+ **
+ ** The ring is a bounded multi-producer, single-consumer queue: a producer claims a slot by
+ ** advancing the tail with a compare-and-swap, writes the frame and publishes it by storing the
+ ** slot sequence. No locks are taken and nothing waits, so the driver hot paths only pay for a
+ ** comparison with the mirror and, when the value changed, for one slot claim.
+ **
+ ** The frame is filled from the mirror after the slot is claimed, not from the reported value.
+ ** Two producers of the same item may claim their slots in the opposite order they updated the
+ ** mirror, but the producer with the later slot reads the mirror after both updates, so the
+ ** last frame of an item always carries its last value.
+ **/
+
+/* === Headers files inclusions =============================================================== */
+
+#include "telemetry.h"
+#include <stdatomic.h>
+#include <stddef.h>
+#include <string.h>
+
+/* === Macros definitions ====================================================================== */
+
+//! brief Mask to wrap a position of the ring
+#define SLOT_MASK (TELEMETRY_SLOTS - 1)
+//! brief Character of a blank LCD cell
+#define BLANK_CELL ' '
+//! brief Position of the type in a frame
+#define FRAME_TYPE 1
+//! brief Position of the first payload byte in a frame
+#define FRAME_PAYLOAD 2
+//! brief Position of the check byte in a frame
+#define FRAME_CHECK 5
+//! brief Mirror items sent again after frames were dropped: every LED port and LCD cell
+#define RESYNC_ITEMS (TELEMETRY_LED_PORTS + TELEMETRY_LCD_ROWS * TELEMETRY_LCD_COLUMNS)
+//! brief Resync position when no resync is in progress
+#define RESYNC_DONE RESYNC_ITEMS
+//! brief Item of the frame that clears the display, past the mirror items
+#define CLEAR_ITEM RESYNC_ITEMS
+
+_Static_assert((TELEMETRY_SLOTS & SLOT_MASK) == 0, "TELEMETRY_SLOTS must be a power of two");
+
+/* === Private data type declarations ========================================================== */
+
+/**
+ * @brief Private slot of the ring.
+ */
+typedef struct {
+    atomic_uint_fast32_t sequence;       //!< Position the slot is ready for
+    uint8_t frame[TELEMETRY_FRAME_SIZE]; //!< Frame stored in the slot
+} TelemetrySlot_t;
+
+/* === Private variable declarations =========================================================== */
+
+//! @brief Private ring of frames
+static TelemetrySlot_t slots[TELEMETRY_SLOTS];
+
+//! @brief Private position where the next frame is queued
+static atomic_uint_fast32_t tail;
+
+//! @brief Private position of the next frame to read, only used by the consumer
+static uint32_t head;
+
+//! @brief Private number of dropped frames
+static atomic_uint_fast32_t dropped;
+
+//! @brief Private flag raised by a producer that dropped a frame
+static atomic_bool overflow;
+
+//! @brief Private next mirror item to send again, RESYNC_DONE if the host is in sync
+static uint16_t resync = RESYNC_DONE;
+
+//! @brief Private last value reported for every LED port
+static _Atomic uint16_t ledMirror[TELEMETRY_LED_PORTS];
+
+//! @brief Private last character reported for every LCD cell
+static _Atomic uint8_t cellMirror[TELEMETRY_LCD_ROWS][TELEMETRY_LCD_COLUMNS];
+
+/* === Private function declarations =========================================================== */
+
+/**
+ * @brief Private function to build a frame with its sync and check bytes.
+ *
+ * @param frame Where to build the frame.
+ *
+ * @param type Type of the frame.
+ *
+ * @param first First payload byte.
+ *
+ * @param second Second payload byte.
+ *
+ * @param third Third payload byte.
+ *
+ * @return void
+ */
+static void buildFrame(uint8_t * frame, uint8_t type, uint8_t first, uint8_t second,
+                       uint8_t third);
+
+/**
+ * @brief Private function to queue a frame, or drop it and ask for a resync if the ring is full.
+ *
+ * @param item Index of the mirror item the frame is built from, CLEAR_ITEM for a clear.
+ *
+ * @return void
+ */
+static void postFrame(uint16_t item);
+
+/**
+ * @brief Private function to build the frame of a mirror item from its current value.
+ *
+ * @param item Index of the item, LED ports first and then LCD cells by rows, CLEAR_ITEM for a
+ * clear of the display.
+ *
+ * @param frame Where to build the frame.
+ *
+ * @return void
+ */
+static void buildMirrorFrame(uint16_t item, uint8_t * frame);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+void buildFrame(uint8_t * frame, uint8_t type, uint8_t first, uint8_t second, uint8_t third) {
+    frame[0] = TELEMETRY_SYNC;
+    frame[FRAME_TYPE] = type;
+    frame[FRAME_PAYLOAD] = first;
+    frame[FRAME_PAYLOAD + 1] = second;
+    frame[FRAME_PAYLOAD + 2] = third;
+    frame[FRAME_CHECK] = type ^ first ^ second ^ third;
+}
+
+void postFrame(uint16_t item) {
+    uint_fast32_t position = atomic_load_explicit(&tail, memory_order_relaxed);
+    TelemetrySlot_t * slot;
+    for (;;) {
+        slot = &slots[position & SLOT_MASK];
+        uint_fast32_t sequence = atomic_load_explicit(&slot->sequence, memory_order_acquire);
+        int32_t difference = (int32_t)(sequence - position);
+        if (difference == 0) {
+            if (atomic_compare_exchange_weak_explicit(&tail, &position, position + 1,
+                                                      memory_order_seq_cst,
+                                                      memory_order_relaxed)) {
+                break;
+            }
+        } else if (difference < 0) {
+            atomic_fetch_add_explicit(&dropped, 1, memory_order_relaxed);
+            atomic_store_explicit(&overflow, true, memory_order_release);
+            return;
+        } else {
+            position = atomic_load_explicit(&tail, memory_order_relaxed);
+        }
+    }
+    buildMirrorFrame(item, slot->frame);
+    atomic_store_explicit(&slot->sequence, position + 1, memory_order_release);
+}
+
+void buildMirrorFrame(uint16_t item, uint8_t * frame) {
+    if (item == CLEAR_ITEM) {
+        buildFrame(frame, TELEMETRY_CLEAR, 0, 0, 0);
+        return;
+    }
+    if (item < TELEMETRY_LED_PORTS) {
+        uint16_t value = atomic_load(&ledMirror[item]);
+        buildFrame(frame, TELEMETRY_LEDS, (uint8_t)item, (uint8_t)value, (uint8_t)(value >> 8));
+        return;
+    }
+    item -= TELEMETRY_LED_PORTS;
+    uint8_t row = (uint8_t)(item / TELEMETRY_LCD_COLUMNS);
+    uint8_t column = (uint8_t)(item % TELEMETRY_LCD_COLUMNS);
+    buildFrame(frame, TELEMETRY_CELL, row, column, atomic_load(&cellMirror[row][column]));
+}
+
+/* === Public function implementation ========================================================== */
+
+void Telemetry_init(void) {
+    for (uint32_t index = 0; index < TELEMETRY_SLOTS; index++) {
+        atomic_store(&slots[index].sequence, index);
+    }
+    for (uint8_t port = 0; port < TELEMETRY_LED_PORTS; port++) {
+        atomic_store(&ledMirror[port], 0);
+    }
+    for (uint8_t row = 0; row < TELEMETRY_LCD_ROWS; row++) {
+        for (uint8_t column = 0; column < TELEMETRY_LCD_COLUMNS; column++) {
+            atomic_store(&cellMirror[row][column], BLANK_CELL);
+        }
+    }
+    atomic_store(&tail, 0);
+    atomic_store(&dropped, 0);
+    atomic_store(&overflow, false);
+    head = 0;
+    resync = RESYNC_DONE;
+}
+
+void Telemetry_ledPort(uint8_t port, uint16_t value) {
+    if (port >= TELEMETRY_LED_PORTS || atomic_exchange(&ledMirror[port], value) == value) {
+        return;
+    }
+    postFrame(port);
+}
+
+void Telemetry_lcdCell(uint8_t row, uint8_t column, char character) {
+    if (row >= TELEMETRY_LCD_ROWS || column >= TELEMETRY_LCD_COLUMNS ||
+        atomic_exchange(&cellMirror[row][column], (uint8_t)character) == (uint8_t)character) {
+        return;
+    }
+    postFrame(TELEMETRY_LED_PORTS + row * TELEMETRY_LCD_COLUMNS + column);
+}
+
+void Telemetry_lcdClear(void) {
+    for (uint8_t row = 0; row < TELEMETRY_LCD_ROWS; row++) {
+        for (uint8_t column = 0; column < TELEMETRY_LCD_COLUMNS; column++) {
+            atomic_store(&cellMirror[row][column], BLANK_CELL);
+        }
+    }
+    postFrame(CLEAR_ITEM);
+}
+
+uint16_t Telemetry_read(uint8_t * buffer, uint16_t size) {
+    uint16_t length = 0;
+    while (length + TELEMETRY_FRAME_SIZE <= size) {
+        TelemetrySlot_t * slot = &slots[head & SLOT_MASK];
+        if (atomic_load_explicit(&slot->sequence, memory_order_acquire) != head + 1) {
+            break;
+        }
+        memcpy(&buffer[length], slot->frame, TELEMETRY_FRAME_SIZE);
+        atomic_store_explicit(&slot->sequence, head + TELEMETRY_SLOTS, memory_order_release);
+        head++;
+        length += TELEMETRY_FRAME_SIZE;
+    }
+    if (atomic_exchange_explicit(&overflow, false, memory_order_acquire)) {
+        resync = 0;
+    }
+    /* A frame claimed before the mirror is read but still unpublished would arrive after the
+     * resync and overwrite it with an older value, so wait until every claimed slot was read */
+    if (resync < RESYNC_DONE && atomic_load_explicit(&tail, memory_order_acquire) != head) {
+        return length;
+    }
+    while (resync < RESYNC_DONE && length + TELEMETRY_FRAME_SIZE <= size) {
+        buildMirrorFrame(resync++, &buffer[length]);
+        length += TELEMETRY_FRAME_SIZE;
+    }
+    return length;
+}
+
+uint32_t Telemetry_getDropped(void) {
+    return (uint32_t)atomic_load_explicit(&dropped, memory_order_relaxed);
+}
+
+void TelemetryPanel_init(TelemetryPanel_t * panel) {
+    memset(panel, 0, sizeof(*panel));
+    memset(panel->cells, BLANK_CELL, sizeof(panel->cells));
+}
+
+bool TelemetryPanel_decode(TelemetryPanel_t * panel, uint8_t byte) {
+    if (panel->received == 0 && byte != TELEMETRY_SYNC) {
+        return false;
+    }
+    panel->frame[panel->received++] = byte;
+    if (panel->received < TELEMETRY_FRAME_SIZE) {
+        return false;
+    }
+    panel->received = 0;
+
+    const uint8_t * frame = panel->frame;
+    const uint8_t * payload = &frame[FRAME_PAYLOAD];
+    bool valid = (frame[FRAME_TYPE] ^ payload[0] ^ payload[1] ^ payload[2]) == frame[FRAME_CHECK];
+    if (valid && frame[FRAME_TYPE] == TELEMETRY_LEDS && payload[0] < TELEMETRY_LED_PORTS) {
+        panel->leds[payload[0]] = (uint16_t)(payload[1] | (payload[2] << 8));
+    } else if (valid && frame[FRAME_TYPE] == TELEMETRY_CELL && payload[0] < TELEMETRY_LCD_ROWS &&
+               payload[1] < TELEMETRY_LCD_COLUMNS) {
+        panel->cells[payload[0]][payload[1]] = (char)payload[2];
+    } else if (valid && frame[FRAME_TYPE] == TELEMETRY_CLEAR) {
+        memset(panel->cells, BLANK_CELL, sizeof(panel->cells));
+    } else {
+        panel->errors++;
+        /* Restart the search at the next sync byte inside the discarded frame */
+        for (uint8_t index = 1; index < TELEMETRY_FRAME_SIZE; index++) {
+            if (frame[index] == TELEMETRY_SYNC) {
+                memmove(panel->frame, &frame[index], TELEMETRY_FRAME_SIZE - index);
+                panel->received = TELEMETRY_FRAME_SIZE - index;
+                break;
+            }
+        }
+        return false;
+    }
+    panel->frames++;
+    return true;
+}
+
+/* === End of documentation ==================================================================== */
@@ -0,0 +1,160 @@
+/************************************************************************************************
+Copyright (c) 2025, Juan Manuel Guariste <juanmaguariste@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** @file test_profile.c
+ ** @brief Unitary tests for the profiling probes.
+ **/
+
+/* === Headers files inclusions ===============================================================
+ */
+#define PROFILE_ENABLED 1
+
+#include "unity.h"
+#include "profile.h"
+#include <string.h>
+
+/* === Macros definitions ======================================================================
+ */
+
+/* === Private data type declarations ==========================================================
+ */
+
+/* === Private variable declarations ===========================================================
+ */
+
+//! Fake time counter, advanced by the probed functions
+static uint32_t fakeTicks;
+
+//! Lines written by the last dump
+static char dump[4][96];
+
+//! Number of lines written by the last dump
+static uint8_t dumpLines;
+
+/* === Private function declarations ===========================================================
+ */
+
+/* === Public variable definitions =============================================================
+ */
+
+/* === Private variable definitions ============================================================
+ */
+
+/* === Private function implementation =========================================================
+ */
+
+/**
+ * @brief Fake time counter.
+ *
+ * @return uint32_t Fake time.
+ */
+static uint32_t fakeClock(void) {
+    return fakeTicks;
+}
+
+/**
+ * @brief Stores a line of a dump.
+ *
+ * @param line Line to store.
+ */
+static void storeLine(const char * line) {
+    if (dumpLines < sizeof(dump) / sizeof(dump[0])) {
+        strncpy(dump[dumpLines], line, sizeof(dump[0]) - 1);
+    }
+    dumpLines++;
+}
+
+/**
+ * @brief Probed function with two return paths.
+ *
+ * @param cost Time the function takes.
+ *
+ * @return uint32_t The cost, returned early when it is odd.
+ */
+static uint32_t probedFunction(uint32_t cost) {
+    PROFILE_FUNCTION();
+    fakeTicks += cost;
+    if (cost & 1) {
+        return cost;
+    }
+    {
+        PROFILE_SCOPE("inner block");
+        fakeTicks += 1;
+    }
+    return cost;
+}
+
+/* === Public function implementation ==========================================================
+ */
+
+void setUp(void) {
+    fakeTicks = 0;
+    dumpLines = 0;
+    memset(dump, 0, sizeof(dump));
+    Profile_init(fakeClock);
+}
+
+//! @test A probe must record count, min, max and total on every return path.
+void test_function_statistics(void) {
+    probedFunction(10);
+    probedFunction(3);
+    probedFunction(20);
+    const ProfileProbe_t * probe = Profile_find("probedFunction");
+    TEST_ASSERT_NOT_NULL(probe);
+    TEST_ASSERT_EQUAL(3, probe->count);
+    TEST_ASSERT_EQUAL(3, probe->min);
+    TEST_ASSERT_EQUAL(21, probe->max);
+    TEST_ASSERT_EQUAL(35, probe->total);
+}
+
+//! @test A scope probe must only measure its own block.
+void test_scope_statistics(void) {
+    probedFunction(10);
+    probedFunction(3);
+    const ProfileProbe_t * probe = Profile_find("inner block");
+    TEST_ASSERT_NOT_NULL(probe);
+    TEST_ASSERT_EQUAL(1, probe->count);
+    TEST_ASSERT_EQUAL(1, probe->max);
+}
+
+//! @test A reset must clear the statistics and the probes must keep measuring after it.
+void test_reset(void) {
+    probedFunction(10);
+    Profile_reset();
+    TEST_ASSERT_EQUAL(0, Profile_find("probedFunction")->count);
+    probedFunction(4);
+    probedFunction(4);
+    TEST_ASSERT_EQUAL(2, Profile_find("probedFunction")->count);
+    TEST_ASSERT_EQUAL(5, Profile_find("probedFunction")->min);
+    TEST_ASSERT_NULL(Profile_find("unknown probe"));
+}
+
+//! @test The dump must write a header and one line per probe that has measured.
+void test_dump(void) {
+    Profile_reset();
+    probedFunction(3);
+    Profile_dump(storeLine);
+    TEST_ASSERT_EQUAL(2, dumpLines);
+    TEST_ASSERT_NOT_NULL(strstr(dump[0], "mean"));
+    TEST_ASSERT_EQUAL(0, strncmp(dump[1], "probedFunction", strlen("probedFunction")));
+}
+
+/* === End of documentation ==================================================================== */
@@ -0,0 +1,220 @@
+/************************************************************************************************
+Copyright (c) 2025, Juan Manuel Guariste <juanmaguariste@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** @file test_scheduler.c
+ ** @brief Unitary tests for the cooperative scheduler.
+ **/
+
+/* === Headers files inclusions ===============================================================
+ */
+#include "unity.h"
+#include "scheduler.h"
+
+/* === Macros definitions ======================================================================
+ */
+
+/* === Private data type declarations ==========================================================
+ */
+
+/**
+ * @brief Context of a fake task.
+ */
+typedef struct {
+    uint32_t runs;     //!< Number of times the task ran
+    uint32_t costUs;   //!< Time the task takes, advanced on the fake clock
+    uint32_t lastRun;  //!< Millisecond of the last run
+    uint32_t units;    //!< Units of work done while the budget allowed
+    uint32_t unitCost; //!< Cost of one unit of work, 0 for a task with fixed work
+} FakeTask_t;
+
+/* === Private variable declarations ===========================================================
+ */
+
+//! Fake time in microseconds
+static uint32_t fakeUs;
+
+/* === Private function declarations ===========================================================
+ */
+
+/* === Public variable definitions =============================================================
+ */
+
+/* === Private variable definitions ============================================================
+ */
+
+/* === Private function implementation =========================================================
+ */
+
+/**
+ * @brief Millisecond tick taken from the fake clock.
+ *
+ * @return uint32_t Fake time in milliseconds.
+ */
+static uint32_t fakeMillis(void) {
+    return fakeUs / 1000;
+}
+
+/**
+ * @brief Microsecond counter taken from the fake clock.
+ *
+ * @return uint32_t Fake time in microseconds.
+ */
+static uint32_t fakeMicros(void) {
+    return fakeUs;
+}
+
+/**
+ * @brief Fake task, it advances the clock by its cost and does units of work while allowed.
+ *
+ * @param context Pointer to the FakeTask_t of the task.
+ */
+static void fakeTask(void * context) {
+    FakeTask_t * task = context;
+    task->runs++;
+    task->lastRun = fakeMillis();
+    while (task->unitCost != 0 && Scheduler_hasBudget(task->unitCost)) {
+        fakeUs += task->unitCost;
+        task->units++;
+    }
+    fakeUs += task->costUs;
+}
+
+/**
+ * @brief Runs the scheduler until a time, advancing the clock when no task is due.
+ *
+ * @param untilMs Millisecond where the run stops.
+ */
+static void runUntil(uint32_t untilMs) {
+    while (fakeMillis() < untilMs) {
+        if (!Scheduler_dispatch()) {
+            fakeUs = (fakeMillis() + 1) * 1000;
+        }
+    }
+}
+
+/* === Public function implementation ==========================================================
+ */
+
+void setUp(void) {
+    fakeUs = 0;
+    Scheduler_init(fakeMillis, fakeMicros);
+}
+
+//! @test A task must run once per period, starting after its offset.
+void test_periodic_release(void) {
+    FakeTask_t task = {0};
+    TEST_ASSERT_EQUAL(0, Scheduler_addTask(fakeTask, &task, 10, 5, 100));
+    runUntil(5);
+    TEST_ASSERT_EQUAL(0, task.runs);
+    runUntil(100);
+    TEST_ASSERT_EQUAL(10, task.runs);
+    TEST_ASSERT_EQUAL(95, task.lastRun);
+}
+
+//! @test The table must reject tasks without a function, without a period or beyond its size.
+void test_add_task_limits(void) {
+    FakeTask_t task = {0};
+    TEST_ASSERT_EQUAL(SCHEDULER_NO_TASK, Scheduler_addTask(NULL, &task, 10, 0, 100));
+    TEST_ASSERT_EQUAL(SCHEDULER_NO_TASK, Scheduler_addTask(fakeTask, &task, 0, 0, 100));
+    for (int index = 0; index < SCHEDULER_MAX_TASKS; index++) {
+        TEST_ASSERT_EQUAL(index, Scheduler_addTask(fakeTask, &task, 10, 0, 100));
+    }
+    TEST_ASSERT_EQUAL(SCHEDULER_NO_TASK, Scheduler_addTask(fakeTask, &task, 10, 0, 100));
+}
+
+//! @test When several tasks are due, the one added first must run first, one per dispatch.
+void test_priority_order(void) {
+    FakeTask_t high = {0}, low = {0};
+    Scheduler_addTask(fakeTask, &high, 10, 0, 100);
+    Scheduler_addTask(fakeTask, &low, 10, 0, 100);
+    TEST_ASSERT_TRUE(Scheduler_dispatch());
+    TEST_ASSERT_EQUAL(1, high.runs);
+    TEST_ASSERT_EQUAL(0, low.runs);
+    TEST_ASSERT_TRUE(Scheduler_dispatch());
+    TEST_ASSERT_EQUAL(1, low.runs);
+    TEST_ASSERT_FALSE(Scheduler_dispatch());
+}
+
+//! @test A run longer than the budget must be counted as an overrun and measured.
+void test_overrun_statistics(void) {
+    FakeTask_t task = {.costUs = 150};
+    SchedulerStats_t stats;
+    int8_t id = Scheduler_addTask(fakeTask, &task, 10, 0, 100);
+    runUntil(10);
+    task.costUs = 50;
+    runUntil(30);
+    TEST_ASSERT_TRUE(Scheduler_getStats(id, &stats));
+    TEST_ASSERT_EQUAL(3, stats.runs);
+    TEST_ASSERT_EQUAL(1, stats.overruns);
+    TEST_ASSERT_EQUAL(150, stats.maxUs);
+    TEST_ASSERT_EQUAL(50, stats.lastUs);
+    TEST_ASSERT_EQUAL(250, stats.totalUs);
+    TEST_ASSERT_FALSE(Scheduler_getStats(id + 1, &stats));
+}
+
+//! @test A task that starts more than a period late must skip the lost releases and count them.
+void test_missed_releases(void) {
+    FakeTask_t hog = {.costUs = 35000}, task = {0};
+    SchedulerStats_t stats;
+    Scheduler_addTask(fakeTask, &hog, 1000, 0, 100);
+    int8_t id = Scheduler_addTask(fakeTask, &task, 10, 0, 100);
+    runUntil(50);
+    TEST_ASSERT_TRUE(Scheduler_getStats(id, &stats));
+    TEST_ASSERT_EQUAL(3, stats.missed);
+    TEST_ASSERT_EQUAL(35, stats.maxLatencyMs);
+    TEST_ASSERT_EQUAL(2, task.runs);
+}
+
+//! @test A task with variable work must stop when its own budget is spent.
+void test_budget_limits_work(void) {
+    FakeTask_t task = {.unitCost = 300};
+    Scheduler_addTask(fakeTask, &task, 10, 0, 1000);
+    runUntil(1);
+    TEST_ASSERT_EQUAL(3, task.units);
+}
+
+//! @test A low priority task must not start work that runs into the release of a higher one.
+void test_budget_protects_higher_priority(void) {
+    FakeTask_t control = {.costUs = 100}, display = {.unitCost = 4000};
+    SchedulerStats_t stats;
+    int8_t id = Scheduler_addTask(fakeTask, &control, 10, 0, 1000);
+    Scheduler_addTask(fakeTask, &display, 1, 0, 100000);
+    runUntil(1000);
+    TEST_ASSERT_TRUE(Scheduler_getStats(id, &stats));
+    TEST_ASSERT_EQUAL(100, stats.runs);
+    TEST_ASSERT_EQUAL(0, stats.missed);
+    TEST_ASSERT_LESS_OR_EQUAL(1, stats.maxLatencyMs);
+    TEST_ASSERT_GREATER_THAN(0, display.units);
+}
+
+//! @test Without a microsecond counter the runs must be measured with the tick.
+void test_millisecond_measure(void) {
+    FakeTask_t task = {.costUs = 3000};
+    SchedulerStats_t stats;
+    Scheduler_init(fakeMillis, NULL);
+    int8_t id = Scheduler_addTask(fakeTask, &task, 10, 0, 1000);
+    runUntil(1);
+    Scheduler_getStats(id, &stats);
+    TEST_ASSERT_EQUAL(3000, stats.lastUs);
+    TEST_ASSERT_EQUAL(1, stats.overruns);
+}
+
+/* === End of documentation ==================================================================== */
@@ -0,0 +1,249 @@
+/************************************************************************************************
+Copyright (c) 2025, Juan Manuel Guariste <juanmaguariste@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** @file test_telemetry.c
+ ** @brief Unitary tests for the front panel telemetry.
+ **/
+
+/* === Headers files inclusions ===============================================================
+ */
+#include "unity.h"
+#include "telemetry.h"
+#include <pthread.h>
+#include <string.h>
+
+/* === Macros definitions ======================================================================
+ */
+
+//! Size of the buffer used to read the frames
+#define READ_SIZE (TELEMETRY_SLOTS * TELEMETRY_FRAME_SIZE)
+
+//! Number of changes written by every producer thread
+#define PRODUCER_ITERATIONS 20000
+
+/* === Private data type declarations ==========================================================
+ */
+
+/* === Private variable declarations ===========================================================
+ */
+static TelemetryPanel_t panel;
+
+static uint8_t buffer[READ_SIZE];
+
+//! Set by the consumer thread to stop
+static volatile bool producersDone;
+
+/* === Private function declarations ===========================================================
+ */
+
+/* === Public variable definitions =============================================================
+ */
+
+/* === Private variable definitions ============================================================
+ */
+
+/* === Private function implementation =========================================================
+ */
+
+/**
+ * @brief Reads every pending frame and feeds it to the decoder.
+ *
+ * @return uint16_t Number of bytes read.
+ */
+static uint16_t drain(void) {
+    uint16_t total = 0;
+    uint16_t length;
+    while ((length = Telemetry_read(buffer, sizeof(buffer))) > 0) {
+        for (uint16_t index = 0; index < length; index++) {
+            TelemetryPanel_decode(&panel, buffer[index]);
+        }
+        total += length;
+    }
+    return total;
+}
+
+/**
+ * @brief Thread that keeps changing its own LED port.
+ *
+ * @param arg Index of the port owned by the thread.
+ */
+static void * producerThread(void * arg) {
+    uint8_t port = (uint8_t)(uintptr_t)arg;
+    for (uint16_t iteration = 1; iteration <= PRODUCER_ITERATIONS; iteration++) {
+        Telemetry_ledPort(port, iteration);
+    }
+    return NULL;
+}
+
+/**
+ * @brief Thread that keeps changing the first LED port, shared with other threads.
+ *
+ * @param arg Offset of the values written by the thread, so every thread writes its own values.
+ */
+static void * sharedPortThread(void * arg) {
+    uint16_t offset = (uint16_t)(uintptr_t)arg;
+    for (uint16_t iteration = 1; iteration <= PRODUCER_ITERATIONS; iteration++) {
+        Telemetry_ledPort(0, (uint16_t)(offset + iteration));
+    }
+    return NULL;
+}
+
+/**
+ * @brief Thread that decodes the frames while the producers run.
+ *
+ * @param arg Not used.
+ */
+static void * consumerThread(void * arg) {
+    (void)arg;
+    while (!producersDone) {
+        drain();
+    }
+    drain();
+    return NULL;
+}
+
+/* === Public function implementation ==========================================================
+ */
+
+void setUp(void) {
+    Telemetry_init();
+    TelemetryPanel_init(&panel);
+    drain();
+}
+
+//! @test Only the writes that change a LCD cell must produce a frame.
+void test_frames_only_on_change(void) {
+    Telemetry_lcdCell(1, 3, 'A');
+    TEST_ASSERT_EQUAL(TELEMETRY_FRAME_SIZE, Telemetry_read(buffer, sizeof(buffer)));
+    TEST_ASSERT_EQUAL_HEX8(TELEMETRY_SYNC, buffer[0]);
+    TEST_ASSERT_EQUAL_HEX8(TELEMETRY_CELL, buffer[1]);
+    TEST_ASSERT_EQUAL_HEX8('A', buffer[4]);
+    Telemetry_lcdCell(1, 3, 'A');
+    Telemetry_lcdCell(0, 0, ' ');
+    TEST_ASSERT_EQUAL(0, Telemetry_read(buffer, sizeof(buffer)));
+}
+
+//! @test The decoder must rebuild the LEDs and the LCD cells from the frames.
+void test_panel_round_trip(void) {
+    Telemetry_ledPort(0, 0x8421);
+    Telemetry_lcdCell(0, 0, 'H');
+    Telemetry_lcdCell(0, 1, 'i');
+    Telemetry_lcdCell(1, 15, '!');
+    drain();
+    TEST_ASSERT_EQUAL_HEX16(0x8421, panel.leds[0]);
+    TEST_ASSERT_EQUAL_MEMORY("Hi              ", panel.cells[0], TELEMETRY_LCD_COLUMNS);
+    TEST_ASSERT_EQUAL('!', panel.cells[1][15]);
+    Telemetry_lcdClear();
+    Telemetry_lcdCell(1, 0, 'x');
+    TEST_ASSERT_EQUAL(2 * TELEMETRY_FRAME_SIZE, drain());
+    TEST_ASSERT_EQUAL(' ', panel.cells[0][0]);
+    TEST_ASSERT_EQUAL('x', panel.cells[1][0]);
+    TEST_ASSERT_EQUAL(0, panel.errors);
+}
+
+//! @test The reader must only copy whole frames.
+void test_read_whole_frames(void) {
+    Telemetry_ledPort(0, 1);
+    Telemetry_ledPort(1, 2);
+    TEST_ASSERT_EQUAL(TELEMETRY_FRAME_SIZE, Telemetry_read(buffer, 2 * TELEMETRY_FRAME_SIZE - 1));
+    TEST_ASSERT_EQUAL(TELEMETRY_FRAME_SIZE, Telemetry_read(buffer, TELEMETRY_FRAME_SIZE));
+    TEST_ASSERT_EQUAL(0, Telemetry_read(buffer, TELEMETRY_FRAME_SIZE - 1));
+}
+
+//! @test After the ring overflows the whole panel must be sent again.
+void test_overflow_resync(void) {
+    for (uint16_t value = 1; value <= 2 * TELEMETRY_SLOTS; value++) {
+        Telemetry_ledPort(0, value);
+    }
+    Telemetry_lcdCell(1, 2, 'z');
+    TEST_ASSERT_GREATER_THAN(0, Telemetry_getDropped());
+    drain();
+    TEST_ASSERT_EQUAL_HEX16(2 * TELEMETRY_SLOTS, panel.leds[0]);
+    TEST_ASSERT_EQUAL('z', panel.cells[1][2]);
+    TEST_ASSERT_EQUAL(0, Telemetry_read(buffer, sizeof(buffer)));
+}
+
+//! @test The decoder must skip garbage and corrupted frames and resume at the next sync byte.
+void test_decoder_recovers(void) {
+    const uint8_t stream[] = {
+        0x00, 0x13,                                      // garbage before the first frame
+        TELEMETRY_SYNC, TELEMETRY_LEDS, 0, 0x34, 0x12, 0x00, // bad check byte
+        TELEMETRY_SYNC, TELEMETRY_LEDS, 1, 0x34, 0x12, TELEMETRY_LEDS ^ 1 ^ 0x34 ^ 0x12,
+    };
+    for (uint8_t index = 0; index < sizeof(stream); index++) {
+        TelemetryPanel_decode(&panel, stream[index]);
+    }
+    TEST_ASSERT_EQUAL(1, panel.errors);
+    TEST_ASSERT_EQUAL(1, panel.frames);
+    TEST_ASSERT_EQUAL_HEX16(0x0000, panel.leds[0]);
+    TEST_ASSERT_EQUAL_HEX16(0x1234, panel.leds[1]);
+}
+
+//! @test Producers in several threads must never block and the panel must end in sync.
+void test_concurrent_producers(void) {
+    pthread_t producers[TELEMETRY_LED_PORTS];
+    pthread_t consumer;
+    producersDone = false;
+    pthread_create(&consumer, NULL, consumerThread, NULL);
+    for (uintptr_t port = 0; port < TELEMETRY_LED_PORTS; port++) {
+        pthread_create(&producers[port], NULL, producerThread, (void *)port);
+    }
+    for (uint8_t port = 0; port < TELEMETRY_LED_PORTS; port++) {
+        pthread_join(producers[port], NULL);
+    }
+    producersDone = true;
+    pthread_join(consumer, NULL);
+    drain();
+    for (uint8_t port = 0; port < TELEMETRY_LED_PORTS; port++) {
+        TEST_ASSERT_EQUAL_HEX16(PRODUCER_ITERATIONS, panel.leds[port]);
+    }
+    TEST_ASSERT_EQUAL(0, panel.errors);
+}
+
+//! @test Producers racing on the same LED port must leave the panel with the value of the
+//! mirror, the one sent again by a resync.
+void test_shared_port_ends_with_mirror_value(void) {
+    pthread_t producers[TELEMETRY_LED_PORTS];
+    pthread_t consumer;
+    producersDone = false;
+    pthread_create(&consumer, NULL, consumerThread, NULL);
+    for (uintptr_t index = 0; index < TELEMETRY_LED_PORTS; index++) {
+        pthread_create(&producers[index], NULL, sharedPortThread,
+                       (void *)(index * PRODUCER_ITERATIONS));
+    }
+    for (uint8_t index = 0; index < TELEMETRY_LED_PORTS; index++) {
+        pthread_join(producers[index], NULL);
+    }
+    producersDone = true;
+    pthread_join(consumer, NULL);
+    drain();
+    uint16_t shown = panel.leds[0];
+
+    for (uint16_t index = 0; index <= TELEMETRY_SLOTS; index++) {
+        Telemetry_lcdCell(0, 0, (index & 1) ? 'a' : 'b');
+    }
+    TEST_ASSERT_GREATER_THAN(0, Telemetry_getDropped());
+    drain();
+    TEST_ASSERT_EQUAL_HEX16(shown, panel.leds[0]);
+    TEST_ASSERT_EQUAL(0, panel.errors);
+}
+
+/* === End of documentation ==================================================================== */